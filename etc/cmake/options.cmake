@@ -30,6 +30,15 @@ find_package(PkgConfig)
 
 option(OTBR_DOC "Build documentation" OFF)
 
+option(OTBR_ASYNC_LOGGING "Write logs to syslog from a background thread" OFF)
+if (OTBR_ASYNC_LOGGING)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_ASYNC_LOGGING=1)
+endif()
+
+set(OTBR_LOG_LEVEL_MAX "DEBUG" CACHE STRING "The most verbose log level compiled into the binaries")
+set_property(CACHE OTBR_LOG_LEVEL_MAX PROPERTY STRINGS "EMERG" "ALERT" "CRIT" "ERR" "WARNING" "NOTICE" "INFO" "DEBUG")
+target_compile_definitions(otbr-config INTERFACE OTBR_LOG_LEVEL_MAX=OTBR_LOG_${OTBR_LOG_LEVEL_MAX})
+
 option(OTBR_BACKBONE_ROUTER "Enable Backbone Router" OFF)
 if (OTBR_BACKBONE_ROUTER)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_BACKBONE_ROUTER=1)
@@ -49,6 +58,9 @@ if (OTBR_DUA_ROUTING)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_DUA_ROUTING=1)
 endif()
 
+option(OTBR_FUZZ "Build the libFuzzer targets and instrument everything with sanitizers, requires Clang" OFF)
+set(OTBR_FUZZ_SANITIZERS "address,undefined" CACHE STRING "The sanitizers enabled by OTBR_FUZZ")
+
 option(OTBR_OPENWRT "Enable OpenWrt support" OFF)
 if(OTBR_OPENWRT)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_OPENWRT=1)
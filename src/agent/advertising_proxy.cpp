@@ -37,20 +37,35 @@
 
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
 
-#if !OTBR_ENABLE_MDNS_AVAHI && !OTBR_ENABLE_MDNS_MDNSSD && !OTBR_ENABLE_MDNS_MOJO
-#error "The Advertising Proxy requires OTBR_ENABLE_MDNS_AVAHI, OTBR_ENABLE_MDNS_MDNSSD or OTBR_ENABLE_MDNS_MOJO"
+#if !OTBR_ENABLE_MDNS_AVAHI && !OTBR_ENABLE_MDNS_MDNSSD && !OTBR_ENABLE_MDNS_MOJO && !OTBR_ENABLE_MDNS_NATIVE && \
+    !OTBR_ENABLE_MDNS_STUB
+#error "The Advertising Proxy requires an mDNS publisher: AVAHI, MDNSSD, MOJO, NATIVE or STUB"
 #endif
 
 #include <string>
+#include <vector>
 
 #include <assert.h>
+#include <time.h>
 
 #include "common/code_utils.hpp"
 #include "common/dns_utils.hpp"
 #include "common/logging.hpp"
+#include "common/metrics.hpp"
 
 namespace otbr {
 
+static Metrics::Counter   sSrpUpdates("otbr_srp_updates_total", "Number of SRP updates advertised.");
+static Metrics::Counter   sSrpUpdateFailures("otbr_srp_update_failures_total",
+                                           "Number of SRP updates failed to be advertised.");
+static Metrics::Histogram sMdnsPublishDuration("otbr_mdns_publish_duration_seconds",
+                                               "Time from receiving an SRP update to its mDNS publication result.");
+static Metrics::Counter   sMdnsConflicts("otbr_mdns_conflicts_total", "Number of mDNS name conflicts detected.");
+static Metrics::Counter   sMdnsRenames("otbr_mdns_renames_total", "Number of mDNS name conflicts renamed.");
+
+constexpr Milliseconds AdvertisingProxy::kReconcileTimeout;
+constexpr Milliseconds AdvertisingProxy::kSnapshotSaveDelay;
+
 static otError OtbrErrorToOtError(otbrError aError)
 {
     otError error;
@@ -92,6 +107,9 @@ static otError OtbrErrorToOtError(otbrError aError)
 AdvertisingProxy::AdvertisingProxy(Ncp::ControllerOpenThread &aNcp, Mdns::Publisher &aPublisher)
     : mNcp(aNcp)
     , mPublisher(aPublisher)
+    , mReconcileScheduled(false)
+    , mSnapshotRestored(false)
+    , mSnapshotSaveScheduled(false)
 {
 }
 
@@ -101,6 +119,15 @@ otbrError AdvertisingProxy::Start(void)
 
     mPublisher.SetPublishServiceHandler(PublishServiceHandler, this);
     mPublisher.SetPublishHostHandler(PublishHostHandler, this);
+    mPublisher.SetConflictHandler(ConflictHandler, this);
+
+    if (!mSnapshotRestored)
+    {
+        mSnapshotRestored = true;
+        RestoreSnapshot();
+    }
+
+    PublishSrpServerHosts();
 
     otbrLogInfo("Started");
 
@@ -111,6 +138,7 @@ void AdvertisingProxy::Stop()
 {
     mPublisher.SetPublishServiceHandler(nullptr, nullptr);
     mPublisher.SetPublishHostHandler(nullptr, nullptr);
+    mPublisher.SetConflictHandler(nullptr, nullptr);
 
     // Outstanding updates will fail on the SRP server because of timeout.
     // TODO: handle this case gracefully.
@@ -121,9 +149,365 @@ void AdvertisingProxy::Stop()
         otSrpServerSetServiceUpdateHandler(GetInstance(), nullptr, nullptr);
     }
 
+    // The registrations go away with the publisher, but the snapshot keeps them for the next start.
+    if (mSnapshotSaveScheduled)
+    {
+        SaveSnapshot();
+    }
+
+    mPublishedHosts.clear();
+    mPublishedServices.clear();
+    mStaleHosts.clear();
+    mStaleServices.clear();
+
     otbrLogInfo("Stopped");
 }
 
+void AdvertisingProxy::HandleNcpReset(void)
+{
+    // The outstanding updates belong to the SRP server of the finalized instance.
+    mOutstandingUpdates.clear();
+
+    MarkStale(Clock::now() + kReconcileTimeout);
+
+    otbrLogInfo("Keep %zu hosts and %zu services registered until SRP clients register again", mStaleHosts.size(),
+                mStaleServices.size());
+}
+
+void AdvertisingProxy::HandleMdnsReady(void)
+{
+    for (const auto &host : mPublishedHosts)
+    {
+        mPublisher.PublishHost(host.first.c_str(), host.second.mAddress.data(),
+                               static_cast<uint8_t>(host.second.mAddress.size()));
+    }
+
+    for (const auto &service : mPublishedServices)
+    {
+        const SrpSnapshot::Service &info = service.second;
+
+        mPublisher.PublishService(info.mHostName.c_str(), info.mPort, info.mName.c_str(), info.mType.c_str(),
+                                  MakeTxtList(info.mTxtData.data(), static_cast<uint16_t>(info.mTxtData.size())));
+    }
+}
+
+otbrError AdvertisingProxy::PublishHost(const SrpSnapshot::Host &aHost)
+{
+    otbrError error;
+
+    SuccessOrExit(error = mPublisher.PublishHost(aHost.mName.c_str(), aHost.mAddress.data(),
+                                                 static_cast<uint8_t>(aHost.mAddress.size())));
+
+    mPublishedHosts[aHost.mName] = aHost;
+    mStaleHosts.erase(aHost.mName);
+    ScheduleSnapshotSave();
+
+exit:
+    return error;
+}
+
+otbrError AdvertisingProxy::UnpublishHost(const std::string &aName)
+{
+    otbrError error = mPublisher.UnpublishHost(aName.c_str());
+
+    mPublishedHosts.erase(aName);
+    mStaleHosts.erase(aName);
+    ScheduleSnapshotSave();
+
+    return error;
+}
+
+otbrError AdvertisingProxy::PublishService(const SrpSnapshot::Service &aService)
+{
+    otbrError  error;
+    ServiceKey key(aService.mName, aService.mType);
+
+    SuccessOrExit(error = mPublisher.PublishService(
+                      aService.mHostName.c_str(), aService.mPort, aService.mName.c_str(), aService.mType.c_str(),
+                      MakeTxtList(aService.mTxtData.data(), static_cast<uint16_t>(aService.mTxtData.size()))));
+
+    mPublishedServices[key] = aService;
+    mStaleServices.erase(key);
+    ScheduleSnapshotSave();
+
+exit:
+    return error;
+}
+
+otbrError AdvertisingProxy::UnpublishService(const std::string &aName, const std::string &aType)
+{
+    otbrError  error = mPublisher.UnpublishService(aName.c_str(), aType.c_str());
+    ServiceKey key(aName, aType);
+
+    mPublishedServices.erase(key);
+    mStaleServices.erase(key);
+    ScheduleSnapshotSave();
+
+    return error;
+}
+
+uint64_t AdvertisingProxy::GetLeaseExpireTime(void)
+{
+    otSrpServerLeaseConfig leaseConfig;
+
+    // The lease granted to each client is not exposed, the maximum lease bounds it.
+    otSrpServerGetLeaseConfig(GetInstance(), &leaseConfig);
+
+    return static_cast<uint64_t>(time(nullptr)) + leaseConfig.mMaxLease;
+}
+
+void AdvertisingProxy::PublishSrpServerHosts(void)
+{
+    const otSrpServerHost *host = nullptr;
+    uint64_t               expireTime;
+
+    VerifyOrExit(GetInstance() != nullptr);
+    expireTime = GetLeaseExpireTime();
+
+    while ((host = otSrpServerGetNextHost(GetInstance(), host)) != nullptr)
+    {
+        const otIp6Address *      addresses;
+        uint8_t                   addressNum;
+        const otSrpServerService *service = nullptr;
+        SrpSnapshot::Host         hostInfo;
+        std::string               hostDomain;
+
+        addresses = otSrpServerHostGetAddresses(host, &addressNum);
+        if (otSrpServerHostIsDeleted(host) || addressNum == 0 ||
+            SplitFullHostName(otSrpServerHostGetFullName(host), hostInfo.mName, hostDomain) != OTBR_ERROR_NONE)
+        {
+            continue;
+        }
+
+        hostInfo.mAddress.assign(addresses[0].mFields.m8, addresses[0].mFields.m8 + sizeof(addresses[0].mFields.m8));
+        hostInfo.mExpireTime = expireTime;
+        PublishHost(hostInfo);
+
+        while ((service = otSrpServerHostGetNextService(host, service)) != nullptr)
+        {
+            SrpSnapshot::Service serviceInfo;
+            std::string          serviceDomain;
+            const uint8_t *      txtData;
+            uint16_t             txtLength = 0;
+
+            if (otSrpServerServiceIsDeleted(service) ||
+                SplitFullServiceInstanceName(otSrpServerServiceGetFullName(service), serviceInfo.mName,
+                                             serviceInfo.mType, serviceDomain) != OTBR_ERROR_NONE)
+            {
+                continue;
+            }
+
+            txtData                 = otSrpServerServiceGetTxtData(service, &txtLength);
+            serviceInfo.mHostName   = hostInfo.mName;
+            serviceInfo.mPort       = otSrpServerServiceGetPort(service);
+            serviceInfo.mExpireTime = expireTime;
+            serviceInfo.mTxtData.assign(txtData, txtData + txtLength);
+            PublishService(serviceInfo);
+        }
+    }
+
+exit:
+    return;
+}
+
+void AdvertisingProxy::MarkStale(Timepoint aDeadline)
+{
+    for (const auto &host : mPublishedHosts)
+    {
+        mStaleHosts[host.first] = aDeadline;
+    }
+
+    for (const auto &service : mPublishedServices)
+    {
+        mStaleServices[service.first] = aDeadline;
+    }
+
+    ScheduleReconcileTimer(aDeadline);
+}
+
+void AdvertisingProxy::WithdrawLeftOutServices(const std::string &aHostName, const std::vector<ServiceKey> &aRegistered)
+{
+    // Only the stale services are unknown to the SRP server, the others are removed by explicit SRP updates.
+    for (const ServiceKey &key : SrpSnapshot::FindLeftOutServices(mPublishedServices, aHostName, aRegistered))
+    {
+        if (mStaleServices.find(key) != mStaleServices.end())
+        {
+            otbrLogInfo("Unpublish SRP service no longer registered by host %s: %s.%s", aHostName.c_str(),
+                        key.first.c_str(), key.second.c_str());
+            UnpublishService(key.first, key.second);
+        }
+    }
+}
+
+void AdvertisingProxy::ScheduleReconcileTimer(Timepoint aTime)
+{
+    Timepoint now = Clock::now();
+
+    VerifyOrExit(!mReconcileScheduled || aTime < mReconcileTime);
+
+    mReconcileScheduled = true;
+    mReconcileTime      = aTime;
+    mNcp.PostTimerTask(aTime > now ? std::chrono::duration_cast<Milliseconds>(aTime - now) : Milliseconds::zero(),
+                       [this]() { HandleReconcileTimer(); });
+
+exit:
+    return;
+}
+
+void AdvertisingProxy::HandleReconcileTimer(void)
+{
+    Timepoint now = Clock::now();
+    Timepoint next;
+    bool      hasNext = false;
+
+    // Timers superseded by an earlier one are ignored.
+    VerifyOrExit(mReconcileScheduled && now >= mReconcileTime);
+    mReconcileScheduled = false;
+
+    for (auto it = mStaleServices.begin(); it != mStaleServices.end();)
+    {
+        ServiceKey key      = it->first;
+        Timepoint  deadline = it->second;
+
+        ++it;
+
+        if (deadline <= now)
+        {
+            otbrLogInfo("Unpublish stale SRP service: %s.%s", key.first.c_str(), key.second.c_str());
+            UnpublishService(key.first, key.second);
+        }
+        else if (!hasNext || deadline < next)
+        {
+            next    = deadline;
+            hasNext = true;
+        }
+    }
+
+    for (auto it = mStaleHosts.begin(); it != mStaleHosts.end();)
+    {
+        std::string name     = it->first;
+        Timepoint   deadline = it->second;
+
+        ++it;
+
+        if (deadline <= now)
+        {
+            otbrLogInfo("Unpublish stale SRP host: %s", name.c_str());
+            UnpublishHost(name);
+        }
+        else if (!hasNext || deadline < next)
+        {
+            next    = deadline;
+            hasNext = true;
+        }
+    }
+
+    if (hasNext)
+    {
+        ScheduleReconcileTimer(next);
+    }
+
+exit:
+    return;
+}
+
+void AdvertisingProxy::RestoreSnapshot(void)
+{
+    const char *                      path = mNcp.GetInstanceParams().GetSrpSnapshotFile();
+    std::vector<SrpSnapshot::Host>    hosts;
+    std::vector<SrpSnapshot::Service> services;
+    uint64_t                          nowTime = static_cast<uint64_t>(time(nullptr));
+    Timepoint                         now     = Clock::now();
+    otbrError                         error;
+
+    VerifyOrExit(path != nullptr && path[0] != '\0');
+    SuccessOrExit(mSnapshot.Open(path));
+
+    error = mSnapshot.Load(hosts, services);
+    VerifyOrExit(error == OTBR_ERROR_NONE, otbrLogResult(error, "Load SRP snapshot"));
+
+    // The restored registrations stay until SRP clients refresh them or their leases expire.
+    for (SrpSnapshot::Host &host : hosts)
+    {
+        Timepoint deadline;
+
+        if (host.mExpireTime <= nowTime || host.mAddress.size() != sizeof(otIp6Address))
+        {
+            continue;
+        }
+
+        deadline                    = now + std::chrono::seconds(host.mExpireTime - nowTime);
+        mStaleHosts[host.mName]     = deadline;
+        mPublishedHosts[host.mName] = std::move(host);
+        ScheduleReconcileTimer(deadline);
+    }
+
+    for (SrpSnapshot::Service &service : services)
+    {
+        ServiceKey key(service.mName, service.mType);
+        Timepoint  deadline;
+
+        if (service.mExpireTime <= nowTime || mPublishedHosts.find(service.mHostName) == mPublishedHosts.end())
+        {
+            continue;
+        }
+
+        deadline                = now + std::chrono::seconds(service.mExpireTime - nowTime);
+        mStaleServices[key]     = deadline;
+        mPublishedServices[key] = std::move(service);
+        ScheduleReconcileTimer(deadline);
+    }
+
+    otbrLogInfo("Restored %zu hosts and %zu services from SRP snapshot", mPublishedHosts.size(),
+                mPublishedServices.size());
+
+    // Otherwise they are published once the publisher is ready.
+    if (mPublisher.IsStarted())
+    {
+        HandleMdnsReady();
+    }
+
+exit:
+    return;
+}
+
+void AdvertisingProxy::ScheduleSnapshotSave(void)
+{
+    VerifyOrExit(mSnapshot.IsOpen() && !mSnapshotSaveScheduled);
+
+    // Changes of one SRP update, or of several close together, are saved at once.
+    mSnapshotSaveScheduled = true;
+    mNcp.PostTimerTask(kSnapshotSaveDelay, [this]() {
+        if (mSnapshotSaveScheduled)
+        {
+            SaveSnapshot();
+        }
+    });
+
+exit:
+    return;
+}
+
+void AdvertisingProxy::SaveSnapshot(void)
+{
+    std::vector<SrpSnapshot::Host>    hosts;
+    std::vector<SrpSnapshot::Service> services;
+
+    mSnapshotSaveScheduled = false;
+
+    for (const auto &host : mPublishedHosts)
+    {
+        hosts.push_back(host.second);
+    }
+
+    for (const auto &service : mPublishedServices)
+    {
+        services.push_back(service.second);
+    }
+
+    mSnapshot.Save(hosts, services);
+}
+
 void AdvertisingProxy::AdvertisingHandler(otSrpServerServiceUpdateId aId,
                                           const otSrpServerHost *    aHost,
                                           uint32_t                   aTimeout,
@@ -153,10 +537,14 @@ void AdvertisingProxy::AdvertisingHandler(otSrpServerServiceUpdateId aId,
     bool                      hostDeleted;
     const otSrpServerService *service;
     OutstandingUpdate *       update;
+    uint64_t                  expireTime = GetLeaseExpireTime();
 
     mOutstandingUpdates.resize(mOutstandingUpdates.size() + 1);
     update = &mOutstandingUpdates.back();
 
+    update->mId        = aId;
+    update->mStartTime = Clock::now();
+
     fullHostName = otSrpServerHostGetFullName(aHost);
 
     otbrLogInfo("Advertise SRP service updates: host=%s", fullHostName);
@@ -165,7 +553,6 @@ void AdvertisingProxy::AdvertisingHandler(otSrpServerServiceUpdateId aId,
     hostAddress = otSrpServerHostGetAddresses(aHost, &hostAddressNum);
     hostDeleted = otSrpServerHostIsDeleted(aHost);
 
-    update->mId = aId;
     update->mCallbackCount += !hostDeleted;
     update->mHostName = hostName;
 
@@ -177,15 +564,19 @@ void AdvertisingProxy::AdvertisingHandler(otSrpServerServiceUpdateId aId,
 
     if (!hostDeleted)
     {
+        SrpSnapshot::Host hostInfo;
+
         // TODO: select a preferred address or advertise all addresses from SRP client.
         otbrLogInfo("Publish SRP host: %s", fullHostName);
-        SuccessOrExit(error =
-                          mPublisher.PublishHost(hostName.c_str(), hostAddress[0].mFields.m8, sizeof(hostAddress[0])));
+        hostInfo.mName = hostName;
+        hostInfo.mAddress.assign(hostAddress[0].mFields.m8, hostAddress[0].mFields.m8 + sizeof(hostAddress[0]));
+        hostInfo.mExpireTime = expireTime;
+        SuccessOrExit(error = PublishHost(hostInfo));
     }
     else
     {
         otbrLogInfo("Unpublish SRP host: %s", fullHostName);
-        SuccessOrExit(error = mPublisher.UnpublishHost(hostName.c_str()));
+        SuccessOrExit(error = UnpublishHost(hostName));
     }
 
     service = nullptr;
@@ -202,19 +593,29 @@ void AdvertisingProxy::AdvertisingHandler(otSrpServerServiceUpdateId aId,
 
         if (!hostDeleted && !otSrpServerServiceIsDeleted(service))
         {
-            Mdns::Publisher::TxtList txtList = MakeTxtList(service);
+            SrpSnapshot::Service serviceInfo;
+            const uint8_t *      txtData;
+            uint16_t             txtLength = 0;
 
             otbrLogInfo("Publish SRP service: %s", fullServiceName);
-            SuccessOrExit(error = mPublisher.PublishService(hostName.c_str(), otSrpServerServiceGetPort(service),
-                                                            serviceName.c_str(), serviceType.c_str(), txtList));
+            txtData                 = otSrpServerServiceGetTxtData(service, &txtLength);
+            serviceInfo.mName       = serviceName;
+            serviceInfo.mType       = serviceType;
+            serviceInfo.mHostName   = hostName;
+            serviceInfo.mPort       = otSrpServerServiceGetPort(service);
+            serviceInfo.mExpireTime = expireTime;
+            serviceInfo.mTxtData.assign(txtData, txtData + txtLength);
+            SuccessOrExit(error = PublishService(serviceInfo));
         }
         else
         {
             otbrLogInfo("Unpublish SRP service: %s", fullServiceName);
-            SuccessOrExit(error = mPublisher.UnpublishService(serviceName.c_str(), serviceType.c_str()));
+            SuccessOrExit(error = UnpublishService(serviceName, serviceType));
         }
     }
 
+    WithdrawLeftOutServices(hostName, update->mServiceNames);
+
 exit:
     if (error != OTBR_ERROR_NONE || update->mCallbackCount == 0)
     {
@@ -223,8 +624,8 @@ exit:
             otbrLogInfo("Failed to advertise SRP service updates %p", aHost);
         }
 
+        HandleUpdateResult(*update, error);
         mOutstandingUpdates.pop_back();
-        otSrpServerHandleServiceUpdateResult(GetInstance(), aId, OtbrErrorToOtError(error));
     }
 }
 
@@ -251,7 +652,7 @@ void AdvertisingProxy::PublishServiceHandler(const char *aName, const char *aTyp
 
             if (aError != OTBR_ERROR_NONE || update->mCallbackCount == 1)
             {
-                otSrpServerHandleServiceUpdateResult(GetInstance(), update->mId, OtbrErrorToOtError(aError));
+                HandleUpdateResult(*update, aError);
                 mOutstandingUpdates.erase(update);
             }
             else
@@ -289,7 +690,7 @@ void AdvertisingProxy::PublishHostHandler(const char *aName, otbrError aError)
 
         if (aError != OTBR_ERROR_NONE || update->mCallbackCount == 1)
         {
-            otSrpServerHandleServiceUpdateResult(GetInstance(), update->mId, OtbrErrorToOtError(aError));
+            HandleUpdateResult(*update, aError);
             mOutstandingUpdates.erase(update);
         }
         else
@@ -306,17 +707,47 @@ exit:
     }
 }
 
-Mdns::Publisher::TxtList AdvertisingProxy::MakeTxtList(const otSrpServerService *aSrpService)
+void AdvertisingProxy::ConflictHandler(const char *aName, const char *aType, const char *aNewName, void *aContext)
+{
+    static_cast<AdvertisingProxy *>(aContext)->ConflictHandler(aName, aType, aNewName);
+}
+
+void AdvertisingProxy::ConflictHandler(const char *aName, const char *aType, const char *aNewName)
+{
+    OTBR_UNUSED_VARIABLE(aName);
+    OTBR_UNUSED_VARIABLE(aType);
+
+    sMdnsConflicts.Increment();
+
+    // The publisher logs the conflict. A renamed host or service still reports its publication result under the
+    // requested name, so the SRP update succeeds without the client having to pick another name and retry over the
+    // mesh.
+    if (aNewName != nullptr)
+    {
+        sMdnsRenames.Increment();
+    }
+}
+
+void AdvertisingProxy::HandleUpdateResult(const OutstandingUpdate &aUpdate, otbrError aError)
+{
+    sSrpUpdates.Increment();
+
+    if (aError != OTBR_ERROR_NONE)
+    {
+        sSrpUpdateFailures.Increment();
+    }
+
+    sMdnsPublishDuration.Observe(std::chrono::duration_cast<Microseconds>(Clock::now() - aUpdate.mStartTime));
+    otSrpServerHandleServiceUpdateResult(GetInstance(), aUpdate.mId, OtbrErrorToOtError(aError));
+}
+
+Mdns::Publisher::TxtList AdvertisingProxy::MakeTxtList(const uint8_t *aTxtData, uint16_t aTxtLength)
 {
-    const uint8_t *          txtData;
-    uint16_t                 txtDataLength = 0;
     otDnsTxtEntryIterator    iterator;
     otDnsTxtEntry            txtEntry;
     Mdns::Publisher::TxtList txtList;
 
-    txtData = otSrpServerServiceGetTxtData(aSrpService, &txtDataLength);
-
-    otDnsInitTxtEntryIterator(&iterator, txtData, txtDataLength);
+    otDnsInitTxtEntryIterator(&iterator, aTxtData, aTxtLength);
 
     while (otDnsGetNextTxtEntry(&iterator, &txtEntry) == OT_ERROR_NONE)
     {
@@ -36,12 +36,18 @@
 
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
 
+#include <map>
+#include <string>
+#include <utility>
+
 #include <stdint.h>
 
 #include <openthread/instance.h>
 #include <openthread/srp_server.h>
 
 #include "agent/ncp_openthread.hpp"
+#include "agent/srp_snapshot.hpp"
+#include "common/time.hpp"
 #include "mdns/mdns.hpp"
 
 namespace otbr {
@@ -74,10 +80,35 @@ public:
     /**
      * This method stops the Advertising Proxy.
      *
+     * The mDNS registrations are expected to be withdrawn by stopping the publisher as well.
+     *
      */
     void Stop();
 
+    /**
+     * This method handles a reset of the OpenThread instance while the mDNS publisher keeps running.
+     *
+     * The SRP server of the new instance starts empty, so the current mDNS registrations are kept until the SRP
+     * clients register again. Registrations which are not refreshed within kReconcileTimeout are withdrawn.
+     *
+     */
+    void HandleNcpReset(void);
+
+    /**
+     * This method publishes all known hosts and services again once the mDNS publisher is ready.
+     *
+     * This covers registrations restored from the snapshot before the publisher was ready and registrations dropped
+     * by a restarted mDNS daemon.
+     *
+     */
+    void HandleMdnsReady(void);
+
 private:
+    typedef SrpSnapshot::ServiceKey ServiceKey;
+
+    static constexpr Milliseconds kReconcileTimeout  = Milliseconds(120 * 1000);
+    static constexpr Milliseconds kSnapshotSaveDelay = Milliseconds(1000);
+
     struct OutstandingUpdate
     {
         typedef std::vector<std::pair<std::string, std::string>> ServiceNameList;
@@ -86,6 +117,7 @@ private:
         std::string                mHostName;          // The host name.
         ServiceNameList            mServiceNames;      // The list of service instance and name pair.
         uint32_t                   mCallbackCount = 0; // The number of callbacks which we are waiting for.
+        Timepoint                  mStartTime;         // The time when the update was received.
     };
 
     static void AdvertisingHandler(otSrpServerServiceUpdateId aId,
@@ -94,12 +126,32 @@ private:
                                    void *                     aContext);
     void        AdvertisingHandler(otSrpServerServiceUpdateId aId, const otSrpServerHost *aHost, uint32_t aTimeout);
 
-    static Mdns::Publisher::TxtList MakeTxtList(const otSrpServerService *aSrpService);
+    static Mdns::Publisher::TxtList MakeTxtList(const uint8_t *aTxtData, uint16_t aTxtLength);
 
     static void PublishServiceHandler(const char *aName, const char *aType, otbrError aError, void *aContext);
     void        PublishServiceHandler(const char *aName, const char *aType, otbrError aError);
     static void PublishHostHandler(const char *aName, otbrError aError, void *aContext);
     void        PublishHostHandler(const char *aName, otbrError aError);
+    static void ConflictHandler(const char *aName, const char *aType, const char *aNewName, void *aContext);
+    void        ConflictHandler(const char *aName, const char *aType, const char *aNewName);
+
+    void HandleUpdateResult(const OutstandingUpdate &aUpdate, otbrError aError);
+
+    otbrError PublishHost(const SrpSnapshot::Host &aHost);
+    otbrError UnpublishHost(const std::string &aName);
+    otbrError PublishService(const SrpSnapshot::Service &aService);
+    otbrError UnpublishService(const std::string &aName, const std::string &aType);
+    uint64_t  GetLeaseExpireTime(void);
+    void      PublishSrpServerHosts(void);
+
+    void MarkStale(Timepoint aDeadline);
+    void WithdrawLeftOutServices(const std::string &aHostName, const std::vector<ServiceKey> &aRegistered);
+    void ScheduleReconcileTimer(Timepoint aTime);
+    void HandleReconcileTimer(void);
+
+    void RestoreSnapshot(void);
+    void ScheduleSnapshotSave(void);
+    void SaveSnapshot(void);
 
     otInstance *GetInstance(void) { return mNcp.GetInstance(); }
 
@@ -111,6 +163,21 @@ private:
 
     // A vector that tracks outstanding updates.
     std::vector<OutstandingUpdate> mOutstandingUpdates;
+
+    // The hosts and services currently registered with the mDNS publisher.
+    std::map<std::string, SrpSnapshot::Host>  mPublishedHosts;
+    std::map<ServiceKey, SrpSnapshot::Service> mPublishedServices;
+
+    // The registrations which are not yet refreshed by SRP clients after an NCP reset or a restart, with the time
+    // when they are withdrawn.
+    std::map<std::string, Timepoint> mStaleHosts;
+    std::map<ServiceKey, Timepoint>  mStaleServices;
+    Timepoint                        mReconcileTime;
+    bool                             mReconcileScheduled;
+
+    SrpSnapshot mSnapshot;
+    bool        mSnapshotRestored;
+    bool        mSnapshotSaveScheduled;
 };
 
 } // namespace otbr
@@ -39,6 +39,7 @@
 
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/mainloop_profiler.hpp"
 
 namespace otbr {
 
@@ -63,8 +64,14 @@ exit:
 
 void AgentInstance::Update(MainloopContext &aMainloop)
 {
-    mNcp.Update(aMainloop);
-    mBorderAgent.Update(aMainloop);
+    {
+        OTBR_PROFILE_SECTION("ControllerOpenThread::Update");
+        mNcp.Update(aMainloop);
+    }
+    {
+        OTBR_PROFILE_SECTION("BorderAgent::Update");
+        mBorderAgent.Update(aMainloop);
+    }
 }
 
 void AgentInstance::Process(const MainloopContext &aMainloop)
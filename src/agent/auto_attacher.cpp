@@ -0,0 +1,96 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements resuming the saved Thread network after the agent starts.
+ */
+
+#include "agent/auto_attacher.hpp"
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace Ncp {
+
+constexpr Milliseconds AutoAttacher::kRetryInterval;
+
+AutoAttacher::AutoAttacher(TaskRunner &aTaskRunner, ResumeHandler aResumeHandler)
+    : mTaskRunner(aTaskRunner)
+    , mResumeHandler(std::move(aResumeHandler))
+    , mPending(false)
+    , mGeneration(0)
+{
+}
+
+void AutoAttacher::Start(void)
+{
+    mPending = true;
+    Schedule(Milliseconds::zero());
+}
+
+void AutoAttacher::HandleDatasetChanged(void)
+{
+    if (mPending)
+    {
+        Schedule(Milliseconds::zero());
+    }
+}
+
+void AutoAttacher::Schedule(Milliseconds aDelay)
+{
+    uint32_t generation = ++mGeneration;
+
+    // Only the latest attempt runs, so a retry scheduled earlier doesn't start another chain of retries.
+    mTaskRunner.Post(aDelay, [this, generation]() {
+        if (generation == mGeneration)
+        {
+            Process();
+        }
+    });
+}
+
+void AutoAttacher::Process(void)
+{
+    VerifyOrExit(mPending);
+
+    if (mResumeHandler())
+    {
+        mPending = false;
+    }
+    else
+    {
+        Schedule(kRetryInterval);
+    }
+
+exit:
+    return;
+}
+
+} // namespace Ncp
+} // namespace otbr
@@ -0,0 +1,117 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for resuming the saved Thread network after the agent starts.
+ */
+
+#ifndef OTBR_AGENT_AUTO_ATTACHER_HPP_
+#define OTBR_AGENT_AUTO_ATTACHER_HPP_
+
+#include <functional>
+
+#include <stdint.h>
+
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
+
+namespace otbr {
+namespace Ncp {
+
+/**
+ * This class resumes the saved Thread network once it is started.
+ *
+ * An attempt is scheduled on the task runner when started. A failed attempt is retried after a while, or right away
+ * when the dataset changes, until one of them succeeds or it is stopped.
+ *
+ */
+class AutoAttacher
+{
+public:
+    /**
+     * This function resumes the saved Thread network.
+     *
+     * @returns Whether the network is resumed.
+     *
+     */
+    typedef std::function<bool(void)> ResumeHandler;
+
+    static constexpr Milliseconds kRetryInterval = Milliseconds(1000); ///< The delay before retrying a failed attempt.
+
+    /**
+     * The constructor initializes the auto attacher.
+     *
+     * @param[in]  aTaskRunner     A reference to the task runner to schedule the attempts on.
+     * @param[in]  aResumeHandler  The handler to resume the network.
+     *
+     */
+    AutoAttacher(TaskRunner &aTaskRunner, ResumeHandler aResumeHandler);
+
+    /**
+     * This method starts resuming the network.
+     *
+     */
+    void Start(void);
+
+    /**
+     * This method stops resuming the network, the attempt already scheduled does nothing.
+     *
+     */
+    void Stop(void) { mPending = false; }
+
+    /**
+     * This method retries right away if the network is yet to be resumed.
+     *
+     * A failed attempt may succeed once the dataset changes, so this should be called on dataset changes.
+     *
+     */
+    void HandleDatasetChanged(void);
+
+    /**
+     * This method indicates whether the network is yet to be resumed.
+     *
+     * @returns Whether the network is yet to be resumed.
+     *
+     */
+    bool IsPending(void) const { return mPending; }
+
+private:
+    void Schedule(Milliseconds aDelay);
+    void Process(void);
+
+    TaskRunner &  mTaskRunner;
+    ResumeHandler mResumeHandler;
+    bool          mPending;
+    uint32_t      mGeneration;
+};
+
+} // namespace Ncp
+} // namespace otbr
+
+#endif // OTBR_AGENT_AUTO_ATTACHER_HPP_
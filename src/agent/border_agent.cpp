@@ -38,6 +38,7 @@
 #include <arpa/inet.h>
 #include <assert.h>
 #include <errno.h>
+#include <net/if.h>
 #include <netinet/in.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -56,6 +57,7 @@
 #include "common/byteswap.hpp"
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/mainloop_profiler.hpp"
 #include "common/tlv.hpp"
 #include "common/types.hpp"
 #include "utils/hex.hpp"
@@ -63,7 +65,22 @@
 
 namespace otbr {
 
-static const char kBorderAgentServiceType[] = "_meshcop._udp"; ///< Border agent service type of mDNS
+static const char kBorderAgentServiceType[]         = "_meshcop._udp"; ///< Border agent service type of mDNS
+static const char kBorderAgentServiceInstanceName[] = "OpenThread_BorderRouter"; ///< Base service instance name
+
+/**
+ * The minimum interval between two consecutive republications of the meshcop service.
+ *
+ * Changes that happen within the interval are coalesced into a single deferred update.
+ *
+ */
+static constexpr Milliseconds kMeshCopMinRepublishInterval = Milliseconds(1000);
+
+/**
+ * How long the mDNS registrations are kept after an NCP reset while waiting for Thread to come back up.
+ *
+ */
+static constexpr Milliseconds kNcpResetTimeout = Milliseconds(30 * 1000);
 
 /**
  * Locators
@@ -90,13 +107,17 @@ uint32_t BorderAgent::StateBitmap::ToUint32(void) const
 
 BorderAgent::BorderAgent(otbr::Ncp::ControllerOpenThread &aNcp)
     : mNcp(aNcp)
-#if OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO
-    , mPublisher(Mdns::Publisher::Create(AF_UNSPEC, /* aDomain */ nullptr, HandleMdnsState, this))
-#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
-    , mAdvertisingProxy(aNcp, *mPublisher)
-#endif
+#if OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO || OTBR_ENABLE_MDNS_NATIVE || \
+    OTBR_ENABLE_MDNS_STUB
+    , mPublisher(CreateMdnsPublisher())
 #else
     , mPublisher(nullptr)
+#endif
+    , mMeshCopPort(0)
+    , mMeshCopUpdateScheduled(false)
+    , mNcpResetPending(false)
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    , mAdvertisingProxy(aNcp, *mPublisher)
 #endif
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
     , mDiscoveryProxy(aNcp, *mPublisher)
@@ -107,9 +128,48 @@ BorderAgent::BorderAgent(otbr::Ncp::ControllerOpenThread &aNcp)
 {
 }
 
+Mdns::Publisher *BorderAgent::CreateMdnsPublisher(void)
+{
+    const InstanceParams &params         = mNcp.GetInstanceParams();
+    const char *          backboneIfName = params.GetBackboneIfName();
+    int                   protocol       = AF_UNSPEC;
+    uint32_t              interfaceIndex = 0;
+    Mdns::Publisher *     publisher;
+
+    if (params.IsMdnsBackboneOnly())
+    {
+        protocol = AF_INET6;
+
+        if (backboneIfName != nullptr && backboneIfName[0] != '\0')
+        {
+            interfaceIndex = if_nametoindex(backboneIfName);
+        }
+
+        if (interfaceIndex == 0)
+        {
+            otbrLogWarning("Backbone interface \"%s\" not found, mDNS is scoped to IPv6 only",
+                           backboneIfName != nullptr ? backboneIfName : "");
+        }
+        else
+        {
+            otbrLogInfo("mDNS is scoped to IPv6 on %s (index %u)", backboneIfName, interfaceIndex);
+        }
+    }
+
+    publisher = Mdns::Publisher::Create(protocol, /* aDomain */ nullptr, HandleMdnsState, this, interfaceIndex);
+
+    if (params.IsMdnsAutoRenameEnabled())
+    {
+        publisher->SetConflictPolicy(Mdns::Publisher::ConflictPolicy::kRename);
+    }
+
+    return publisher;
+}
+
 void BorderAgent::Init(void)
 {
     mNcp.AddThreadStateChangedCallback([this](otChangedFlags aFlags) { HandleThreadStateChanged(aFlags); });
+    mNcp.RegisterResetHandler([this]() { HandleNcpReset(); });
 
 #if OTBR_ENABLE_BACKBONE_ROUTER
     mBackboneAgent.Init();
@@ -134,7 +194,8 @@ otbrError BorderAgent::Start(void)
     // In case we didn't receive Thread down event.
     Stop();
 
-#if OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO
+#if OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO || OTBR_ENABLE_MDNS_NATIVE || \
+    OTBR_ENABLE_MDNS_STUB
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
     mAdvertisingProxy.Start();
 #endif
@@ -144,7 +205,10 @@ otbrError BorderAgent::Start(void)
     mDiscoveryProxy.Start();
 #endif
 
-#endif // OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO
+#endif // OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO || OTBR_ENABLE_MDNS_NATIVE ||
+       // OTBR_ENABLE_MDNS_STUB
+
+    mNcpResetPending = false;
 
 exit:
     otbrLogResult(error, "Start Thread Border Agent");
@@ -155,11 +219,18 @@ void BorderAgent::Stop(void)
 {
     otbrLogInfo("Stop Thread Border Agent");
 
-#if OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO
-    mPublisher->Stop();
+#if OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO || OTBR_ENABLE_MDNS_NATIVE || \
+    OTBR_ENABLE_MDNS_STUB
+    // The mDNS registrations outlive an NCP reset, Start() reconciles them once Thread is up again.
+    if (!mNcpResetPending)
+    {
+        mPublisher->Stop();
+        mServiceInstanceName.clear();
+        mMeshCopTxtData.clear();
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
-    mAdvertisingProxy.Stop();
+        mAdvertisingProxy.Stop();
 #endif
+    }
 
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
     mDiscoveryProxy.Stop();
@@ -189,7 +260,13 @@ void BorderAgent::HandleMdnsState(Mdns::Publisher::State aState)
     switch (aState)
     {
     case Mdns::Publisher::State::kReady:
+        // The mDNS daemon may have dropped all registrations, so
+        // forget what was published and publish again.
+        mMeshCopTxtData.clear();
         UpdateMeshCopService();
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+        mAdvertisingProxy.HandleMdnsReady();
+#endif
         break;
     default:
         otbrLogWarning("MDNS service not available!");
@@ -212,10 +289,14 @@ void BorderAgent::Update(MainloopContext &aMainloop)
 void BorderAgent::Process(const MainloopContext &aMainloop)
 {
 #if OTBR_ENABLE_BACKBONE_ROUTER
-    mBackboneAgent.Process(aMainloop);
+    {
+        OTBR_PROFILE_SECTION("BackboneAgent::Process");
+        mBackboneAgent.Process(aMainloop);
+    }
 #endif
     if (mPublisher != nullptr)
     {
+        OTBR_PROFILE_SECTION("Mdns::Publisher::Process");
         mPublisher->Process(aMainloop);
     }
 }
@@ -224,13 +305,15 @@ void BorderAgent::PublishMeshCopService(void)
 {
     StateBitmap              state;
     uint32_t                 stateUint32;
-    otInstance *             instance    = mNcp.GetInstance();
-    const otExtendedPanId *  extPanId    = otThreadGetExtendedPanId(instance);
-    const otExtAddress *     extAddr     = otLinkGetExtendedAddress(instance);
-    const char *             networkName = otThreadGetNetworkName(instance);
+    otInstance *             instance     = mNcp.GetInstance();
+    const otExtendedPanId *  extPanId     = otThreadGetExtendedPanId(instance);
+    const otExtAddress *     extAddr      = otLinkGetExtendedAddress(instance);
+    const char *             networkName  = otThreadGetNetworkName(instance);
+    uint16_t                 port         = otBorderAgentGetUdpPort(instance);
+    std::string              instanceName = GetServiceInstanceName();
     Mdns::Publisher::TxtList txtList{{"rv", "1"}};
-
-    otbrLogInfo("Publish meshcop service %s.%s.local.", networkName, kBorderAgentServiceType);
+    uint8_t                  txtData[kMaxMeshCopTxtDataSize];
+    uint16_t                 txtLength = sizeof(txtData);
 
     txtList.emplace_back("nn", networkName);
     txtList.emplace_back("xp", extPanId->m8, sizeof(extPanId->m8));
@@ -263,18 +346,25 @@ void BorderAgent::PublishMeshCopService(void)
 
     if (state.mThreadIfStatus == kThreadIfStatusActive)
     {
-        otError              error;
-        otOperationalDataset activeDataset;
-        uint64_t             activeTimestamp;
-        uint32_t             partitionId;
+        otError                  error;
+        otOperationalDatasetTlvs activeDatasetTlvs;
+        uint64_t                 activeTimestamp;
+        uint32_t                 partitionId;
 
-        if ((error = otDatasetGetActive(instance, &activeDataset)) != OT_ERROR_NONE)
+        // Only the timestamp is needed, so look it up in the raw TLVs instead of parsing the whole dataset.
+        if ((error = otDatasetGetActiveTlvs(instance, &activeDatasetTlvs)) != OT_ERROR_NONE)
         {
             otbrLogWarning("Failed to get active dataset: %s", otThreadErrorToString(error));
         }
+        else if (TlvReader(activeDatasetTlvs.mTlvs, activeDatasetTlvs.mLength)
+                     .FindUint64(Meshcop::kActiveTimestamp, activeTimestamp) != OTBR_ERROR_NONE)
+        {
+            otbrLogWarning("Failed to find active timestamp in active dataset");
+        }
         else
         {
-            activeTimestamp = htobe64(activeDataset.mActiveTimestamp);
+            // The upper 48 bits are the seconds, followed by 15 bits of ticks and the authoritative bit.
+            activeTimestamp = htobe64(activeTimestamp >> 16);
             txtList.emplace_back("at", reinterpret_cast<uint8_t *>(&activeTimestamp), sizeof(activeTimestamp));
         }
 
@@ -296,18 +386,45 @@ void BorderAgent::PublishMeshCopService(void)
     txtList.emplace_back("dn", otThreadGetDomainName(instance));
 #endif
 
-    mPublisher->PublishService(/* aHostName */ nullptr, otBorderAgentGetUdpPort(instance), networkName,
-                               kBorderAgentServiceType, txtList);
+    VerifyOrExit(Mdns::Publisher::EncodeTxtData(txtList, txtData, txtLength) == OTBR_ERROR_NONE,
+                 otbrLogWarning("Failed to encode meshcop TXT data"));
+
+    // Republishing an unchanged service only costs mDNS traffic.
+    VerifyOrExit(instanceName != mServiceInstanceName || port != mMeshCopPort || txtLength != mMeshCopTxtData.size() ||
+                 memcmp(txtData, mMeshCopTxtData.data(), txtLength) != 0);
+
+    // The service instance name doesn't depend on the network name, so the
+    // existing instance only has to be withdrawn when the name itself changes.
+    if (instanceName != mServiceInstanceName)
+    {
+        UnpublishMeshCopService();
+    }
+
+    otbrLogInfo("Publish meshcop service %s.%s.local. (network name %s)", instanceName.c_str(),
+                kBorderAgentServiceType, networkName);
+
+    SuccessOrExit(mPublisher->PublishService(/* aHostName */ nullptr, port, instanceName.c_str(),
+                                             kBorderAgentServiceType, txtList));
+
+    mServiceInstanceName = instanceName;
+    mMeshCopPort         = port;
+    mMeshCopTxtData.assign(txtData, txtData + txtLength);
+    mMeshCopPublishTime = Clock::now();
+
+exit:
+    return;
 }
 
 void BorderAgent::UnpublishMeshCopService(void)
 {
     assert(IsThreadStarted());
-    VerifyOrExit(!mNetworkName.empty());
+    VerifyOrExit(!mServiceInstanceName.empty());
 
-    otbrLogInfo("Unpublish meshcop service %s.%s.local.", mNetworkName.c_str(), kBorderAgentServiceType);
+    otbrLogInfo("Unpublish meshcop service %s.%s.local.", mServiceInstanceName.c_str(), kBorderAgentServiceType);
 
-    mPublisher->UnpublishService(mNetworkName.c_str(), kBorderAgentServiceType);
+    mPublisher->UnpublishService(mServiceInstanceName.c_str(), kBorderAgentServiceType);
+    mServiceInstanceName.clear();
+    mMeshCopTxtData.clear();
 
 exit:
     return;
@@ -315,32 +432,54 @@ exit:
 
 void BorderAgent::UpdateMeshCopService(void)
 {
-    assert(IsThreadStarted());
+    Milliseconds sinceLastPublish;
 
-    const char *networkName = otThreadGetNetworkName(mNcp.GetInstance());
+    assert(IsThreadStarted());
 
     VerifyOrExit(mPublisher->IsStarted(), mPublisher->Start());
     VerifyOrExit(IsPskcInitialized(), UnpublishMeshCopService());
 
-    // In case the Thread network name changes, we need to unpublish
-    // current meshcop service.
-    //
-    // TODO: don't use Thread network name as service instance name.
-    // The network name is a TXT entry of the `_meshcop._udp` service
-    // and we should only update the mDNS service entry when network name
-    // changes but not republish a new service instance.
-    if (mNetworkName != networkName)
+    // A deferred update is already pending and will pick up this change.
+    VerifyOrExit(!mMeshCopUpdateScheduled);
+
+    sinceLastPublish = std::chrono::duration_cast<Milliseconds>(Clock::now() - mMeshCopPublishTime);
+
+    if (!mMeshCopTxtData.empty() && sinceLastPublish < kMeshCopMinRepublishInterval)
     {
-        UnpublishMeshCopService();
+        mMeshCopUpdateScheduled = true;
+        mNcp.PostTimerTask(kMeshCopMinRepublishInterval - sinceLastPublish, [this]() { HandleMeshCopUpdateTimer(); });
+        ExitNow();
     }
 
     PublishMeshCopService();
-    mNetworkName = networkName;
 
 exit:
     return;
 }
 
+void BorderAgent::HandleMeshCopUpdateTimer(void)
+{
+    mMeshCopUpdateScheduled = false;
+
+    VerifyOrExit(mPublisher != nullptr && IsThreadStarted());
+    UpdateMeshCopService();
+
+exit:
+    return;
+}
+
+std::string BorderAgent::GetServiceInstanceName(void) const
+{
+    const otExtAddress *extAddr = otLinkGetExtendedAddress(mNcp.GetInstance());
+    char                name[sizeof(kBorderAgentServiceInstanceName) + sizeof("_XXXX")];
+
+    // Use the last two bytes of the extended address to tell
+    // border routers of the same network apart.
+    snprintf(name, sizeof(name), "%s_%02X%02X", kBorderAgentServiceInstanceName, extAddr->m8[6], extAddr->m8[7]);
+
+    return name;
+}
+
 void BorderAgent::HandleThreadStateChanged(otChangedFlags aFlags)
 {
     VerifyOrExit(mPublisher != nullptr);
@@ -370,6 +509,47 @@ exit:
     return;
 }
 
+void BorderAgent::HandleNcpReset(void)
+{
+    otbrLogInfo("NCP was reset, keep mDNS registrations while Thread restarts");
+
+#if OTBR_ENABLE_BACKBONE_ROUTER
+    mBackboneAgent.HandleNcpReset();
+#endif
+
+    VerifyOrExit(mPublisher != nullptr && mPublisher->IsStarted());
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    mAdvertisingProxy.HandleNcpReset();
+#endif
+
+    mNcpResetPending  = true;
+    mNcpResetDeadline = Clock::now() + kNcpResetTimeout;
+    mNcp.PostTimerTask(kNcpResetTimeout, [this]() { HandleNcpResetTimer(); });
+
+    if (IsThreadStarted())
+    {
+        Start();
+    }
+
+exit:
+    return;
+}
+
+void BorderAgent::HandleNcpResetTimer(void)
+{
+    // Thread is already up again, or a later reset has extended the deadline.
+    VerifyOrExit(mNcpResetPending && Clock::now() >= mNcpResetDeadline);
+
+    otbrLogWarning("Thread is not up %u seconds after NCP reset, withdraw mDNS registrations",
+                   static_cast<unsigned>(std::chrono::duration_cast<std::chrono::seconds>(kNcpResetTimeout).count()));
+    mNcpResetPending = false;
+    Stop();
+
+exit:
+    return;
+}
+
 bool BorderAgent::IsThreadStarted(void) const
 {
     otDeviceRole role = otThreadGetDeviceRole(mNcp.GetInstance());
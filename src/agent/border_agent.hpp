@@ -34,6 +34,7 @@
 #ifndef OTBR_AGENT_BORDER_AGENT_HPP_
 #define OTBR_AGENT_BORDER_AGENT_HPP_
 
+#include <string>
 #include <vector>
 
 #include <stdint.h>
@@ -43,6 +44,7 @@
 #include "agent/instance_params.hpp"
 #include "agent/ncp_openthread.hpp"
 #include "common/mainloop.hpp"
+#include "common/time.hpp"
 #include "mdns/mdns.hpp"
 
 #if OTBR_ENABLE_BACKBONE_ROUTER
@@ -100,6 +102,11 @@ public:
     void Process(const MainloopContext &aMainloop) override;
 
 private:
+    enum : uint16_t
+    {
+        kMaxMeshCopTxtDataSize = 512, ///< The max size of the encoded meshcop TXT data.
+    };
+
     enum : uint8_t
     {
         kConnectionModeDisabled = 0,
@@ -142,22 +149,38 @@ private:
         uint32_t ToUint32(void) const;
     };
 
-    otbrError   Start(void);
-    void        Stop(void);
-    static void HandleMdnsState(void *aContext, Mdns::Publisher::State aState);
-    void        HandleMdnsState(Mdns::Publisher::State aState);
-    void        PublishMeshCopService(void);
-    void        UnpublishMeshCopService(void);
-    void        UpdateMeshCopService(void);
+    otbrError        Start(void);
+    void             Stop(void);
+    Mdns::Publisher *CreateMdnsPublisher(void);
+    static void      HandleMdnsState(void *aContext, Mdns::Publisher::State aState);
+    void             HandleMdnsState(Mdns::Publisher::State aState);
+    void             PublishMeshCopService(void);
+    void             UnpublishMeshCopService(void);
+    void             UpdateMeshCopService(void);
+    void             HandleMeshCopUpdateTimer(void);
+    std::string      GetServiceInstanceName(void) const;
 
     void HandleThreadStateChanged(otChangedFlags aFlags);
+    void HandleNcpReset(void);
+    void HandleNcpResetTimer(void);
 
     bool IsThreadStarted(void) const;
     bool IsPskcInitialized(void) const;
 
     otbr::Ncp::ControllerOpenThread &mNcp;
     Mdns::Publisher *                mPublisher;
-    std::string                      mNetworkName;
+
+    // The state of the last published meshcop service, used to skip
+    // republishing when nothing has changed.
+    std::string          mServiceInstanceName;
+    uint16_t             mMeshCopPort;
+    std::vector<uint8_t> mMeshCopTxtData;
+    Timepoint            mMeshCopPublishTime;
+    bool                 mMeshCopUpdateScheduled;
+
+    // Whether the mDNS registrations are kept while Thread restarts after an NCP reset.
+    bool      mNcpResetPending;
+    Timepoint mNcpResetDeadline;
 
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
     AdvertisingProxy mAdvertisingProxy;
@@ -47,10 +47,18 @@
 #include "common/code_utils.hpp"
 #include "common/dns_utils.hpp"
 #include "common/logging.hpp"
+#include "common/metrics.hpp"
 
 namespace otbr {
 namespace Dnssd {
 
+static Metrics::Counter sSubscriptions("otbr_discovery_proxy_subscriptions_total",
+                                       "Number of DNS-SD subscriptions from Thread devices.");
+static Metrics::Counter sServicesDiscovered("otbr_discovery_proxy_services_discovered_total",
+                                            "Number of service instances discovered on the infrastructure link.");
+static Metrics::Counter sHostsDiscovered("otbr_discovery_proxy_hosts_discovered_total",
+                                         "Number of hosts discovered on the infrastructure link.");
+
 DiscoveryProxy::DiscoveryProxy(Ncp::ControllerOpenThread &aNcp, Mdns::Publisher &aPublisher)
     : mNcp(aNcp)
     , mMdnsPublisher(aPublisher)
@@ -94,6 +102,7 @@ void DiscoveryProxy::OnDiscoveryProxySubscribe(const char *aFullName)
     DnsNameInfo nameInfo = SplitFullDnsName(fullName);
 
     otbrLogInfo("subscribe: %s", fullName.c_str());
+    sSubscriptions.Increment();
 
     if (GetServiceSubscriptionCount(nameInfo) == 1)
     {
@@ -149,10 +158,15 @@ void DiscoveryProxy::OnServiceDiscovered(const std::string &
     otDnssdServiceInstanceInfo instanceInfo;
     const otDnssdQuery *       query = nullptr;
 
+    // Answers already sent can't be withdrawn, they expire with the capped TTL instead.
+    VerifyOrExit(!aInstanceInfo.mRemoved,
+                 otbrLogInfo("service removed: %s, instance %s", aType.c_str(), aInstanceInfo.mName.c_str()));
+
     otbrLogInfo("service discovered: %s, instance %s hostname %s addresses %zu port %d priority %d "
                 "weight %d",
                 aType.c_str(), aInstanceInfo.mName.c_str(), aInstanceInfo.mHostName.c_str(),
                 aInstanceInfo.mAddresses.size(), aInstanceInfo.mPort, aInstanceInfo.mPriority, aInstanceInfo.mWeight);
+    sServicesDiscovered.Increment();
 
     CheckServiceNameSanity(aType);
     CheckHostnameSanity(aInstanceInfo.mHostName);
@@ -216,6 +230,9 @@ void DiscoveryProxy::OnServiceDiscovered(const std::string &
             otDnssdQueryHandleDiscoveredServiceInstance(mNcp.GetInstance(), serviceFullName.c_str(), &instanceInfo);
         }
     }
+
+exit:
+    return;
 }
 
 void DiscoveryProxy::OnHostDiscovered(const std::string &                        aHostName,
@@ -227,6 +244,7 @@ void DiscoveryProxy::OnHostDiscovered(const std::string &
 
     otbrLogInfo("host discovered: %s hostname %s addresses %zu", aHostName.c_str(), aHostInfo.mHostName.c_str(),
                 aHostInfo.mAddresses.size());
+    sHostsDiscovered.Increment();
 
     if (resolvedHostName.empty())
     {
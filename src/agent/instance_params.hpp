@@ -39,17 +39,26 @@ namespace otbr {
 /**
  * This class represents the agent instance parameters.
  *
+ * Each agent instance holds its own parameters, so that several instances may live in one process.
+ *
  */
 class InstanceParams
 {
 public:
     /**
-     * This method gets the single `InstanceParams` instance.
-     *
-     * @returns  The single `InstanceParams` instance.
+     * This constructor initializes the parameters with no interfaces, no SRP snapshot file, no kernel route sync,
+     * unscoped mDNS and no mDNS auto-rename.
      *
      */
-    static InstanceParams &Get(void);
+    InstanceParams(void)
+        : mThreadIfName(nullptr)
+        , mBackboneIfName(nullptr)
+        , mSrpSnapshotFile(nullptr)
+        , mKernelRouteSync(false)
+        , mMdnsBackboneOnly(false)
+        , mMdnsAutoRename(false)
+    {
+    }
 
     /**
      * This method sets the Thread network interface name.
@@ -83,15 +92,77 @@ public:
      */
     const char *GetBackboneIfName(void) const { return mBackboneIfName; }
 
-private:
-    InstanceParams()
-        : mThreadIfName(nullptr)
-        , mBackboneIfName(nullptr)
-    {
-    }
+    /**
+     * This method sets the path of the SRP snapshot file.
+     *
+     * @param[in] aPath  The path of the SRP snapshot file, or nullptr to disable the snapshot.
+     *
+     */
+    void SetSrpSnapshotFile(const char *aPath) { mSrpSnapshotFile = aPath; }
+
+    /**
+     * This method gets the path of the SRP snapshot file.
+     *
+     * @returns The path of the SRP snapshot file, or nullptr if the snapshot is disabled.
+     *
+     */
+    const char *GetSrpSnapshotFile(void) const { return mSrpSnapshotFile; }
 
+    /**
+     * This method sets whether the network data routes are installed to the kernel routing table.
+     *
+     * @param[in] aEnabled  Whether to install the network data routes.
+     *
+     */
+    void SetKernelRouteSync(bool aEnabled) { mKernelRouteSync = aEnabled; }
+
+    /**
+     * This method indicates whether the network data routes are installed to the kernel routing table.
+     *
+     * @returns Whether to install the network data routes.
+     *
+     */
+    bool IsKernelRouteSyncEnabled(void) const { return mKernelRouteSync; }
+
+    /**
+     * This method sets whether mDNS publishes and browses only on the Backbone interface and over IPv6.
+     *
+     * @param[in] aEnabled  Whether to scope mDNS to the Backbone interface and IPv6.
+     *
+     */
+    void SetMdnsBackboneOnly(bool aEnabled) { mMdnsBackboneOnly = aEnabled; }
+
+    /**
+     * This method indicates whether mDNS publishes and browses only on the Backbone interface and over IPv6.
+     *
+     * @returns Whether mDNS is scoped to the Backbone interface and IPv6.
+     *
+     */
+    bool IsMdnsBackboneOnly(void) const { return mMdnsBackboneOnly; }
+
+    /**
+     * This method sets whether mDNS renames a conflicting host or service instead of withdrawing it.
+     *
+     * @param[in] aEnabled  Whether to rename on mDNS name conflicts.
+     *
+     */
+    void SetMdnsAutoRename(bool aEnabled) { mMdnsAutoRename = aEnabled; }
+
+    /**
+     * This method indicates whether mDNS renames a conflicting host or service instead of withdrawing it.
+     *
+     * @returns Whether to rename on mDNS name conflicts.
+     *
+     */
+    bool IsMdnsAutoRenameEnabled(void) const { return mMdnsAutoRename; }
+
+private:
     const char *mThreadIfName;
     const char *mBackboneIfName;
+    const char *mSrpSnapshotFile;
+    bool        mKernelRouteSync;
+    bool        mMdnsBackboneOnly;
+    bool        mMdnsAutoRename;
 };
 
 } // namespace otbr
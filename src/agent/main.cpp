@@ -32,13 +32,17 @@
 #include <mutex>
 #include <sstream>
 #include <thread>
+#include <vector>
 
 #include <errno.h>
+#include <fcntl.h>
 #include <getopt.h>
 #include <signal.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <strings.h>
 #include <unistd.h>
 
 #include <assert.h>
@@ -50,6 +54,8 @@
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
 #include "common/mainloop.hpp"
+#include "common/mainloop_profiler.hpp"
+#include "common/metrics.hpp"
 #include "common/types.hpp"
 #if OTBR_ENABLE_REST_SERVER
 #include "rest/rest_web_server.hpp"
@@ -82,10 +88,27 @@ enum
     OTBR_OPT_VERSION                 = 'V',
     OTBR_OPT_SHORTMAX                = 128,
     OTBR_OPT_RADIO_VERSION,
+    OTBR_OPT_LOG_TAG_LEVEL,
+    OTBR_OPT_SLOW_HANDLER_THRESHOLD,
+    OTBR_OPT_AUTO_ATTACH,
+    OTBR_OPT_WARM_RESET,
+    OTBR_OPT_REST_LISTEN_FD,
+    OTBR_OPT_SRP_SNAPSHOT,
+    OTBR_OPT_SYNC_KERNEL_ROUTES,
+    OTBR_OPT_MDNS_BACKBONE_ONLY,
+    OTBR_OPT_MDNS_AUTO_RENAME,
 };
 
-static jmp_buf sResetJump;
-static bool    sShouldTerminate = false;
+static jmp_buf               sResetJump;
+static bool                  sShouldTerminate   = false;
+static volatile sig_atomic_t sShouldDumpProfile = 0;
+static bool                  sWarmReset         = false;
+static bool                  sAutoAttachDone    = false;
+static ControllerOpenThread *sController        = nullptr;
+static int                   sRestListenFd      = -1;
+
+static otbr::Metrics::Histogram sMainloopProcessDuration("otbr_mainloop_process_duration_seconds",
+                                                         "Time spent processing events in one mainloop iteration.");
 
 void __gcov_flush();
 
@@ -99,6 +122,16 @@ static const struct option  kOptions[]   = {
     {"verbose", no_argument, nullptr, OTBR_OPT_VERBOSE},
     {"version", no_argument, nullptr, OTBR_OPT_VERSION},
     {"radio-version", no_argument, nullptr, OTBR_OPT_RADIO_VERSION},
+    {"log-tag-level", required_argument, nullptr, OTBR_OPT_LOG_TAG_LEVEL},
+    {"slow-handler-ms", required_argument, nullptr, OTBR_OPT_SLOW_HANDLER_THRESHOLD},
+    {"auto-attach", optional_argument, nullptr, OTBR_OPT_AUTO_ATTACH},
+    {"warm-reset", no_argument, nullptr, OTBR_OPT_WARM_RESET},
+    {"srp-snapshot", required_argument, nullptr, OTBR_OPT_SRP_SNAPSHOT},
+    {"sync-kernel-routes", no_argument, nullptr, OTBR_OPT_SYNC_KERNEL_ROUTES},
+    {"mdns-backbone-only", no_argument, nullptr, OTBR_OPT_MDNS_BACKBONE_ONLY},
+    {"mdns-auto-rename", no_argument, nullptr, OTBR_OPT_MDNS_AUTO_RENAME},
+    // Internal: the REST listening socket handed over by the previous process image on reset.
+    {"rest-listen-fd", required_argument, nullptr, OTBR_OPT_REST_LISTEN_FD},
     {0, 0, 0, 0}};
 
 static void HandleSignal(int aSignal)
@@ -107,12 +140,19 @@ static void HandleSignal(int aSignal)
     signal(aSignal, SIG_DFL);
 }
 
+static void HandleDumpProfileSignal(int aSignal)
+{
+    OTBR_UNUSED_VARIABLE(aSignal);
+
+    sShouldDumpProfile = 1;
+}
+
 static int Mainloop(otbr::AgentInstance &aInstance, const char *aInterfaceName)
 {
     int                   error         = EXIT_SUCCESS;
     ControllerOpenThread &ncpOpenThread = static_cast<ControllerOpenThread &>(aInstance.GetNcp());
 
-    OT_UNUSED_VARIABLE(ncpOpenThread);
+    sController = &ncpOpenThread;
 
 #if OTBR_ENABLE_DBUS_SERVER
     std::unique_ptr<DBusAgent> dbusAgent = std::unique_ptr<DBusAgent>(new DBusAgent(aInterfaceName, &ncpOpenThread));
@@ -121,18 +161,27 @@ static int Mainloop(otbr::AgentInstance &aInstance, const char *aInterfaceName)
     OTBR_UNUSED_VARIABLE(aInterfaceName);
 #endif
 #if OTBR_ENABLE_REST_SERVER
-    RestWebServer *restServer = RestWebServer::GetRestWebServer(&ncpOpenThread);
-    restServer->Init();
+    std::unique_ptr<RestWebServer> restServer = std::unique_ptr<RestWebServer>(new RestWebServer(&ncpOpenThread));
+    restServer->Init(sRestListenFd);
+    sRestListenFd = restServer->GetListenFd();
 #endif
     otbrLogInfo("Border router agent started.");
     // allow quitting elegantly
     signal(SIGTERM, HandleSignal);
+    // dump the mainloop profile on demand, the signal interrupts select() so it is dumped right away
+    signal(SIGUSR1, HandleDumpProfileSignal);
 
     while (!sShouldTerminate)
     {
         otbr::MainloopContext mainloop;
         int                   rval;
 
+        if (sShouldDumpProfile)
+        {
+            sShouldDumpProfile = 0;
+            otbr::MainloopProfiler::Get().Dump();
+        }
+
         mainloop.mMaxFd   = -1;
         mainloop.mTimeout = kPollTimeout;
 
@@ -143,11 +192,17 @@ static int Mainloop(otbr::AgentInstance &aInstance, const char *aInterfaceName)
         aInstance.Update(mainloop);
 
 #if OTBR_ENABLE_DBUS_SERVER
-        dbusAgent->Update(mainloop);
+        {
+            OTBR_PROFILE_SECTION("DBusAgent::Update");
+            dbusAgent->Update(mainloop);
+        }
 #endif
 
 #if OTBR_ENABLE_REST_SERVER
-        restServer->Update(mainloop);
+        {
+            OTBR_PROFILE_SECTION("RestWebServer::Update");
+            restServer->Update(mainloop);
+        }
 #endif
 
 #if OTBR_ENABLE_OPENWRT
@@ -160,19 +215,30 @@ static int Mainloop(otbr::AgentInstance &aInstance, const char *aInterfaceName)
 
         if (rval >= 0)
         {
+            otbr::Metrics::ScopedTimer processTimer(sMainloopProcessDuration);
+
 #if OTBR_ENABLE_OPENWRT
             sThreadMutex.lock();
-            UbusProcess(mainloop.mReadFdSet);
+            {
+                OTBR_PROFILE_SECTION("UbusProcess");
+                UbusProcess(mainloop.mReadFdSet);
+            }
 #endif
 
 #if OTBR_ENABLE_REST_SERVER
-            restServer->Process(mainloop);
+            {
+                OTBR_PROFILE_SECTION("RestWebServer::Process");
+                restServer->Process(mainloop);
+            }
 #endif
 
             aInstance.Process(mainloop);
 
 #if OTBR_ENABLE_DBUS_SERVER
-            dbusAgent->Process(mainloop);
+            {
+                OTBR_PROFILE_SECTION("DBusAgent::Process");
+                dbusAgent->Process(mainloop);
+            }
 #endif
         }
         else if (errno != EINTR)
@@ -186,16 +252,78 @@ static int Mainloop(otbr::AgentInstance &aInstance, const char *aInterfaceName)
         }
     }
 
+    sController = nullptr;
+
     return error;
 }
 
 static void PrintHelp(const char *aProgramName)
 {
-    fprintf(stderr, "Usage: %s [-I interfaceName] [-B backboneIfName] [-d DEBUG_LEVEL] [-v] RADIO_URL [RADIO_URL]\n",
+    fprintf(stderr,
+            "Usage: %s [-I interfaceName] [-B backboneIfName] [-d DEBUG_LEVEL] [--log-tag-level TAG=LEVEL] "
+            "[--slow-handler-ms MS] [--auto-attach[=0|1]] [--warm-reset] [--srp-snapshot PATH] "
+            "[--sync-kernel-routes] [--mdns-backbone-only] [--mdns-auto-rename] [-v] RADIO_URL [RADIO_URL]\n",
             aProgramName);
     fprintf(stderr, "%s", otSysGetRadioUrlHelpString());
 }
 
+static otbrError ParseInteger(const char *aArg, long aMin, long aMax, long &aValue)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    char *    end;
+
+    errno  = 0;
+    aValue = strtol(aArg, &end, 10);
+    VerifyOrExit(errno == 0 && end != aArg && *end == '\0', error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(aValue >= aMin && aValue <= aMax, error = OTBR_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
+static otbrError ParseLogLevel(const char *aArg, otbrLogLevel &aLevel)
+{
+    // Indexed by otbrLogLevel, these are the syslog level names.
+    static const char *const kLevelNames[] = {"EMERG", "ALERT", "CRIT", "ERR", "WARNING", "NOTICE", "INFO", "DEBUG"};
+
+    otbrError error = OTBR_ERROR_NONE;
+    long      level;
+
+    for (level = OTBR_LOG_EMERG; level <= OTBR_LOG_DEBUG; level++)
+    {
+        if (strcasecmp(aArg, kLevelNames[level]) == 0)
+        {
+            ExitNow();
+        }
+    }
+
+    SuccessOrExit(error = ParseInteger(aArg, OTBR_LOG_EMERG, OTBR_LOG_DEBUG, level));
+
+exit:
+    if (error == OTBR_ERROR_NONE)
+    {
+        aLevel = static_cast<otbrLogLevel>(level);
+    }
+
+    return error;
+}
+
+static otbrError ParseLogTagLevel(char *aArg)
+{
+    otbrError    error = OTBR_ERROR_NONE;
+    char *       level = strchr(aArg, '=');
+    otbrLogLevel logLevel;
+
+    VerifyOrExit(level != nullptr, error = OTBR_ERROR_INVALID_ARGS);
+    *level++ = '\0';
+
+    SuccessOrExit(error = ParseLogLevel(level, logLevel));
+    error = otbrLogSetTagLevel(aArg, logLevel);
+
+exit:
+    return error;
+}
+
 static void PrintVersion(void)
 {
     printf("%s\n", OTBR_PACKAGE_VERSION);
@@ -221,6 +349,11 @@ static int realmain(int argc, char *argv[])
     const char *              backboneInterfaceName = "";
     bool                      verbose               = false;
     bool                      printRadioVersion     = false;
+    bool                      enableAutoAttach      = true;
+    const char *              srpSnapshotFile       = nullptr;
+    bool                      syncKernelRoutes      = false;
+    bool                      mdnsBackboneOnly      = false;
+    bool                      mdnsAutoRename        = false;
     std::vector<const char *> radioUrls;
 
     std::set_new_handler(OnAllocateFailed);
@@ -234,8 +367,7 @@ static int realmain(int argc, char *argv[])
             break;
 
         case OTBR_OPT_DEBUG_LEVEL:
-            logLevel = static_cast<otbrLogLevel>(atoi(optarg));
-            VerifyOrExit(logLevel >= OTBR_LOG_EMERG && logLevel <= OTBR_LOG_DEBUG, ret = EXIT_FAILURE);
+            VerifyOrExit(ParseLogLevel(optarg, logLevel) == OTBR_ERROR_NONE, PrintHelp(argv[0]), ret = EXIT_FAILURE);
             break;
 
         case OTBR_OPT_INTERFACE_NAME:
@@ -260,6 +392,60 @@ static int realmain(int argc, char *argv[])
             printRadioVersion = true;
             break;
 
+        case OTBR_OPT_LOG_TAG_LEVEL:
+            VerifyOrExit(ParseLogTagLevel(optarg) == OTBR_ERROR_NONE, PrintHelp(argv[0]), ret = EXIT_FAILURE);
+            break;
+
+        case OTBR_OPT_SLOW_HANDLER_THRESHOLD:
+        {
+            long threshold;
+
+            VerifyOrExit(ParseInteger(optarg, 0, INT32_MAX, threshold) == OTBR_ERROR_NONE, PrintHelp(argv[0]),
+                         ret = EXIT_FAILURE);
+            otbr::MainloopProfiler::Get().SetSlowThreshold(otbr::Milliseconds(threshold));
+            break;
+        }
+
+        case OTBR_OPT_AUTO_ATTACH:
+        {
+            long autoAttach = 1;
+
+            VerifyOrExit(optarg == nullptr || ParseInteger(optarg, 0, 1, autoAttach) == OTBR_ERROR_NONE,
+                         PrintHelp(argv[0]), ret = EXIT_FAILURE);
+            enableAutoAttach = (autoAttach != 0);
+            break;
+        }
+
+        case OTBR_OPT_WARM_RESET:
+            sWarmReset = true;
+            break;
+
+        case OTBR_OPT_REST_LISTEN_FD:
+        {
+            long fd;
+
+            VerifyOrExit(ParseInteger(optarg, 0, INT32_MAX, fd) == OTBR_ERROR_NONE, PrintHelp(argv[0]),
+                         ret = EXIT_FAILURE);
+            sRestListenFd = static_cast<int>(fd);
+            break;
+        }
+
+        case OTBR_OPT_SRP_SNAPSHOT:
+            srpSnapshotFile = optarg;
+            break;
+
+        case OTBR_OPT_SYNC_KERNEL_ROUTES:
+            syncKernelRoutes = true;
+            break;
+
+        case OTBR_OPT_MDNS_BACKBONE_ONLY:
+            mdnsBackboneOnly = true;
+            break;
+
+        case OTBR_OPT_MDNS_AUTO_RENAME:
+            mdnsAutoRename = true;
+            break;
+
         default:
             PrintHelp(argv[0]);
             ExitNow(ret = EXIT_FAILURE);
@@ -280,11 +466,16 @@ static int realmain(int argc, char *argv[])
     }
 
     {
-        otbr::Ncp::ControllerOpenThread ncpOpenThread{interfaceName, radioUrls, backboneInterfaceName};
-        otbr::AgentInstance             instance(ncpOpenThread);
+        otbr::Ncp::ControllerOpenThread ncpOpenThread{interfaceName, radioUrls, backboneInterfaceName,
+                                                      enableAutoAttach};
+
+        // The parameters must be set before the agent instance, which creates the mDNS publisher.
+        ncpOpenThread.GetInstanceParams().SetSrpSnapshotFile(srpSnapshotFile);
+        ncpOpenThread.GetInstanceParams().SetKernelRouteSync(syncKernelRoutes);
+        ncpOpenThread.GetInstanceParams().SetMdnsBackboneOnly(mdnsBackboneOnly);
+        ncpOpenThread.GetInstanceParams().SetMdnsAutoRename(mdnsAutoRename);
 
-        otbr::InstanceParams::Get().SetThreadIfName(interfaceName);
-        otbr::InstanceParams::Get().SetBackboneIfName(backboneInterfaceName);
+        otbr::AgentInstance instance(ncpOpenThread);
 
         SuccessOrExit(ret = instance.Init());
 
@@ -311,11 +502,68 @@ void otPlatReset(otInstance *aInstance)
 {
     gPlatResetReason = OT_PLAT_RESET_REASON_SOFTWARE;
 
-    otInstanceFinalize(aInstance);
-    otSysDeinit();
+    if (sWarmReset && sController != nullptr)
+    {
+        // Only the OpenThread instance is restarted, sockets and mDNS registrations are kept. The instance
+        // cannot be finalized while OpenThread is still on the stack, so do it from the mainloop.
+        //
+        // Unlike a cold reset, this returns to the caller and the reset happens later. The agent keeps running with
+        // the same D-Bus connection, so D-Bus clients see the same as for the D-Bus Reset method, instead of the
+        // agent leaving and rejoining the bus. As with a re-exec, a network which was already resumed is left as
+        // OpenThread restores it.
+        otbrLogInfo("Warm reset");
+        sController->PostTimerTask(otbr::Milliseconds::zero(),
+                                   []() { sController->Reset(sController->IsAutoAttachPending()); });
+    }
+    else
+    {
+        // The controller is gone after the jump, so check here whether the network was resumed.
+        sAutoAttachDone = sController != nullptr && !sController->IsAutoAttachPending();
+
+        otInstanceFinalize(aInstance);
+        otSysDeinit();
+
+        longjmp(sResetJump, 1);
+        assert(false);
+    }
+}
+
+static void Reexec(int argc, char *argv[])
+{
+    static const char kAutoAttachOption[]   = "--auto-attach";
+    static const char kRestListenFdOption[] = "--rest-listen-fd=";
+
+    std::vector<char *> args;
+    char                noAutoAttach[] = "--auto-attach=0";
+    char                restListenFd[sizeof(kRestListenFdOption) + sizeof("-2147483648")];
+
+    args.push_back(argv[0]);
+
+    // Once the network is resumed, leave it as OpenThread restores it after the reset. Otherwise the new process
+    // image keeps trying to resume it.
+    if (sAutoAttachDone)
+    {
+        args.push_back(noAutoAttach);
+    }
+
+    // Hand the listening socket over so that REST clients are not refused while the agent restarts.
+    if (sRestListenFd >= 0 && fcntl(sRestListenFd, F_SETFD, 0) == 0)
+    {
+        snprintf(restListenFd, sizeof(restListenFd), "%s%d", kRestListenFdOption, sRestListenFd);
+        args.push_back(restListenFd);
+    }
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!(sAutoAttachDone && strncmp(argv[i], kAutoAttachOption, sizeof(kAutoAttachOption) - 1) == 0) &&
+            strncmp(argv[i], kRestListenFdOption, sizeof(kRestListenFdOption) - 1) != 0)
+        {
+            args.push_back(argv[i]);
+        }
+    }
 
-    longjmp(sResetJump, 1);
-    assert(false);
+    args.push_back(nullptr);
+    execvp(argv[0], args.data());
 }
 
 int main(int argc, char *argv[])
@@ -323,10 +571,12 @@ int main(int argc, char *argv[])
     if (setjmp(sResetJump))
     {
         alarm(0);
+        // Flush pending log messages before the process image is replaced.
+        otbrLogDeinit();
 #if OPENTHREAD_ENABLE_COVERAGE
         __gcov_flush();
 #endif
-        execvp(argv[0], argv);
+        Reexec(argc, argv);
     }
 
     return realmain(argc, argv);
@@ -48,6 +48,7 @@
 
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/mainloop_profiler.hpp"
 #include "common/types.hpp"
 
 #if OTBR_ENABLE_LEGACY
@@ -62,8 +63,12 @@ static const uint16_t kThreadVersion12 = 3; ///< Thread Version 1.2
 
 ControllerOpenThread::ControllerOpenThread(const char *                     aInterfaceName,
                                            const std::vector<const char *> &aRadioUrls,
-                                           const char *                     aBackboneInterfaceName)
+                                           const char *                     aBackboneInterfaceName,
+                                           bool                             aEnableAutoAttach)
     : mInstance(nullptr)
+    , mRouteManager(*this)
+    , mEnableAutoAttach(aEnableAutoAttach)
+    , mAutoAttacher(mTaskRunner, [this]() { return TryResumeNetwork(); })
 {
     VerifyOrDie(aRadioUrls.size() <= OT_PLATFORM_CONFIG_MAX_RADIO_URLS, "Too many Radio URLs!");
 
@@ -76,6 +81,9 @@ ControllerOpenThread::ControllerOpenThread(const char *                     aInt
         mConfig.mRadioUrls[mConfig.mRadioUrlNum++] = url;
     }
     mConfig.mSpeedUpFactor = 1;
+
+    mInstanceParams.SetThreadIfName(aInterfaceName);
+    mInstanceParams.SetBackboneIfName(aBackboneInterfaceName);
 }
 
 ControllerOpenThread::~ControllerOpenThread(void)
@@ -133,6 +141,11 @@ otbrError ControllerOpenThread::Init(void)
 
     mThreadHelper = std::unique_ptr<otbr::agent::ThreadHelper>(new otbr::agent::ThreadHelper(mInstance, this));
 
+    if (mEnableAutoAttach)
+    {
+        mAutoAttacher.Start();
+    }
+
 exit:
     return error;
 }
@@ -160,12 +173,32 @@ void ControllerOpenThread::HandleStateChanged(otChangedFlags aFlags)
         }
     }
 
+    // Refresh the routes first, so that the callbacks see the new network data routes.
+    mRouteManager.HandleStateChanged(aFlags);
+
     for (auto &stateCallback : mThreadStateChangedCallbacks)
     {
         stateCallback(aFlags);
     }
 
     mThreadHelper->StateChangedCallback(aFlags);
+
+    if (aFlags & (OT_CHANGED_ACTIVE_DATASET | OT_CHANGED_THREAD_PANID))
+    {
+        mAutoAttacher.HandleDatasetChanged();
+    }
+}
+
+bool ControllerOpenThread::TryResumeNetwork(void)
+{
+    otError error = mThreadHelper->TryResumeNetwork();
+
+    if (error != OT_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to resume Thread network: %s, retry later", otThreadErrorToString(error));
+    }
+
+    return error == OT_ERROR_NONE;
 }
 
 void ControllerOpenThread::Update(MainloopContext &aMainloop)
@@ -182,16 +215,17 @@ void ControllerOpenThread::Update(MainloopContext &aMainloop)
 
 void ControllerOpenThread::Process(const MainloopContext &aMainloop)
 {
-    otTaskletsProcess(mInstance);
-
-    otSysMainloopProcess(mInstance, &aMainloop);
-
-    mTaskRunner.Process(aMainloop);
+    {
+        OTBR_PROFILE_SECTION("otTaskletsProcess");
+        otTaskletsProcess(mInstance);
+    }
 
-    if (getenv("OTBR_NO_AUTO_ATTACH") == nullptr && mThreadHelper->TryResumeNetwork() == OT_ERROR_NONE)
     {
-        setenv("OTBR_NO_AUTO_ATTACH", "1", 0);
+        OTBR_PROFILE_SECTION("otSysMainloopProcess");
+        otSysMainloopProcess(mInstance, &aMainloop);
     }
+
+    mTaskRunner.Process(aMainloop);
 }
 
 void ControllerOpenThread::PostTimerTask(Milliseconds aDelay, TaskRunner::Task<void> aTask)
@@ -209,18 +243,20 @@ void ControllerOpenThread::AddThreadStateChangedCallback(ThreadStateChangedCallb
     mThreadStateChangedCallbacks.emplace_back(std::move(aCallback));
 }
 
-void ControllerOpenThread::Reset(void)
+void ControllerOpenThread::Reset(bool aResumeNetwork)
 {
     gPlatResetReason = OT_PLAT_RESET_REASON_SOFTWARE;
 
     otInstanceFinalize(mInstance);
     otSysDeinit();
+    mAutoAttacher.Stop();
+    mEnableAutoAttach = aResumeNetwork;
     Init();
+    mRouteManager.Refresh();
     for (auto &handler : mResetHandlers)
     {
         handler();
     }
-    unsetenv("OTBR_NO_AUTO_ATTACH");
 }
 
 const char *ControllerOpenThread::GetThreadVersion(void)
@@ -42,6 +42,9 @@
 #include <openthread/instance.h>
 #include <openthread/openthread-system.h>
 
+#include "agent/auto_attacher.hpp"
+#include "agent/instance_params.hpp"
+#include "agent/route_manager.hpp"
 #include "agent/thread_helper.hpp"
 #include "common/mainloop.hpp"
 #include "common/task_runner.hpp"
@@ -65,11 +68,13 @@ public:
      * @param[in]   aInterfaceName          A string of the NCP interface name.
      * @param[in]   aRadioUrls              The radio URLs (can be IEEE802.15.4 or TREL radio).
      * @param[in]   aBackboneInterfaceName  The Backbone network interface name.
+     * @param[in]   aEnableAutoAttach       Whether to resume the saved Thread network after initialization.
      *
      */
     ControllerOpenThread(const char *                     aInterfaceName,
                          const std::vector<const char *> &aRadioUrls,
-                         const char *                     aBackboneInterfaceName);
+                         const char *                     aBackboneInterfaceName,
+                         bool                             aEnableAutoAttach = true);
 
     /**
      * This method initalize the NCP controller.
@@ -95,6 +100,30 @@ public:
      */
     otbr::agent::ThreadHelper *GetThreadHelper(void) { return mThreadHelper.get(); }
 
+    /**
+     * This method returns the parameters of the agent instance served by this controller.
+     *
+     * @returns A reference to the instance parameters.
+     *
+     */
+    InstanceParams &GetInstanceParams(void) { return mInstanceParams; }
+
+    /**
+     * This method returns the route manager.
+     *
+     * @returns A reference to the route manager.
+     *
+     */
+    RouteManager &GetRouteManager(void) { return mRouteManager; }
+
+    /**
+     * This method returns the parameters of the agent instance served by this controller.
+     *
+     * @returns A const reference to the instance parameters.
+     *
+     */
+    const InstanceParams &GetInstanceParams(void) const { return mInstanceParams; }
+
     /**
      * This method updates the mainloop context.
      *
@@ -139,8 +168,22 @@ public:
     /**
      * This method resets the OpenThread instance.
      *
+     * Only the OpenThread instance is restarted, the registered reset handlers are called to rebind to the new one.
+     * This is what the D-Bus Reset method does, and with `--warm-reset` also what a reset requested by OpenThread
+     * through otPlatReset() does, in place of re-executing the agent.
+     *
+     * @param[in]  aResumeNetwork  Whether to resume the saved Thread network after the reset.
+     *
      */
-    void Reset(void);
+    void Reset(bool aResumeNetwork = true);
+
+    /**
+     * This method indicates whether an auto attach attempt is still outstanding.
+     *
+     * @returns Whether the saved Thread network is yet to be resumed.
+     *
+     */
+    bool IsAutoAttachPending(void) const { return mAutoAttacher.IsPending(); }
 
     /**
      * This method returns the Thread protocol version as a string.
@@ -159,6 +202,8 @@ private:
     }
     void HandleStateChanged(otChangedFlags aFlags);
 
+    bool TryResumeNetwork(void);
+
     static void HandleBackboneRouterDomainPrefixEvent(void *                            aContext,
                                                       otBackboneRouterDomainPrefixEvent aEvent,
                                                       const otIp6Prefix *               aDomainPrefix);
@@ -175,10 +220,14 @@ private:
     otInstance *mInstance;
 
     otPlatformConfig                           mConfig;
+    InstanceParams                             mInstanceParams;
     std::unique_ptr<otbr::agent::ThreadHelper> mThreadHelper;
+    RouteManager                               mRouteManager;
     std::vector<std::function<void(void)>>     mResetHandlers;
     TaskRunner                                 mTaskRunner;
     std::vector<ThreadStateChangedCallback>    mThreadStateChangedCallbacks;
+    bool                                       mEnableAutoAttach;
+    AutoAttacher                               mAutoAttacher;
 };
 
 } // namespace Ncp
@@ -0,0 +1,345 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the route manager.
+ */
+
+#define OTBR_LOG_TAG "ROUTE"
+
+#include "agent/route_manager.hpp"
+
+#include <functional>
+
+#include <openthread/border_router.h>
+#include <openthread/netdata.h>
+#include <openthread/thread.h>
+
+#include "agent/ncp_openthread.hpp"
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "utils/system_utils.hpp"
+
+namespace otbr {
+
+// Keeps the installed routes apart from those of OpenThread and `DuaRoutingManager`.
+static constexpr uint32_t kKernelRouteMetric = 512;
+
+static Route MakeRoute(const otBorderRouterConfig &aConfig)
+{
+    Route route;
+
+    route.mPrefix.Set(aConfig.mPrefix);
+    route.mRloc16       = aConfig.mRloc16;
+    route.mPreference   = aConfig.mPreference;
+    route.mOnMesh       = true;
+    route.mStable       = aConfig.mStable;
+    route.mPreferred    = aConfig.mPreferred;
+    route.mSlaac        = aConfig.mSlaac;
+    route.mDhcp         = aConfig.mDhcp;
+    route.mConfigure    = aConfig.mConfigure;
+    route.mDefaultRoute = aConfig.mDefaultRoute;
+
+    return route;
+}
+
+static Route MakeRoute(const otExternalRouteConfig &aConfig)
+{
+    Route route;
+
+    route.mPrefix.Set(aConfig.mPrefix);
+    route.mRloc16     = aConfig.mRloc16;
+    route.mPreference = aConfig.mPreference;
+    route.mStable     = aConfig.mStable;
+    route.mLocal      = aConfig.mNextHopIsThisDevice;
+
+    return route;
+}
+
+static bool IsSamePrefix(const otIp6Prefix &aLhs, const otIp6Prefix &aRhs)
+{
+    Ip6Prefix lhs;
+    Ip6Prefix rhs;
+
+    lhs.Set(aLhs);
+    rhs.Set(aRhs);
+
+    return lhs == rhs;
+}
+
+static bool FindLocalOnMeshPrefix(otInstance *aInstance, const otIp6Prefix &aPrefix, otBorderRouterConfig &aConfig)
+{
+    otNetworkDataIterator iterator = OT_NETWORK_DATA_ITERATOR_INIT;
+    bool                  found    = false;
+
+    while (!found && otBorderRouterGetNextOnMeshPrefix(aInstance, &iterator, &aConfig) == OT_ERROR_NONE)
+    {
+        found = IsSamePrefix(aConfig.mPrefix, aPrefix);
+    }
+
+    return found;
+}
+
+static bool FindLocalRoute(otInstance *aInstance, const otIp6Prefix &aPrefix, otExternalRouteConfig &aConfig)
+{
+    otNetworkDataIterator iterator = OT_NETWORK_DATA_ITERATOR_INIT;
+    bool                  found    = false;
+
+    while (!found && otBorderRouterGetNextRoute(aInstance, &iterator, &aConfig) == OT_ERROR_NONE)
+    {
+        found = IsSamePrefix(aConfig.mPrefix, aPrefix);
+    }
+
+    return found;
+}
+
+RouteManager::RouteManager(Ncp::ControllerOpenThread &aNcp)
+    : mNcp(aNcp)
+{
+}
+
+RouteManager::~RouteManager(void)
+{
+    for (const Route &route : mKernelRoutes.GetRoutes())
+    {
+        UpdateKernelRoute(route, /* aInstall */ false);
+    }
+}
+
+void RouteManager::HandleStateChanged(otChangedFlags aFlags)
+{
+    if (aFlags & (OT_CHANGED_THREAD_NETDATA | OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_RLOC_ADDED))
+    {
+        Refresh();
+    }
+}
+
+void RouteManager::Refresh(void)
+{
+    otInstance *          instance = mNcp.GetInstance();
+    uint16_t              rloc16   = otThreadGetRloc16(instance);
+    RouteTable            table;
+    otNetworkDataIterator iterator;
+    otBorderRouterConfig  prefixConfig;
+    otExternalRouteConfig routeConfig;
+
+    iterator = OT_NETWORK_DATA_ITERATOR_INIT;
+    while (otNetDataGetNextOnMeshPrefix(instance, &iterator, &prefixConfig) == OT_ERROR_NONE)
+    {
+        Route route = MakeRoute(prefixConfig);
+
+        route.mLocal = (route.mRloc16 == rloc16);
+        table.Add(route);
+    }
+
+    iterator = OT_NETWORK_DATA_ITERATOR_INIT;
+    while (otNetDataGetNextRoute(instance, &iterator, &routeConfig) == OT_ERROR_NONE)
+    {
+        table.Add(MakeRoute(routeConfig));
+    }
+
+    // The local network data may not have been registered to the leader yet.
+    iterator = OT_NETWORK_DATA_ITERATOR_INIT;
+    while (otBorderRouterGetNextOnMeshPrefix(instance, &iterator, &prefixConfig) == OT_ERROR_NONE)
+    {
+        Route route = MakeRoute(prefixConfig);
+
+        route.mRloc16 = rloc16;
+        route.mLocal  = true;
+        table.Add(route);
+    }
+
+    iterator = OT_NETWORK_DATA_ITERATOR_INIT;
+    while (otBorderRouterGetNextRoute(instance, &iterator, &routeConfig) == OT_ERROR_NONE)
+    {
+        Route route = MakeRoute(routeConfig);
+
+        route.mRloc16 = rloc16;
+        route.mLocal  = true;
+        table.Add(route);
+    }
+
+    mRouteTable = std::move(table);
+    otbrLogDebug("Route table refreshed: %zu routes", mRouteTable.GetSize());
+
+    if (mNcp.GetInstanceParams().IsKernelRouteSyncEnabled())
+    {
+        SyncKernelRoutes();
+    }
+}
+
+otError RouteManager::UpdateNetworkData(const NetworkDataUpdate &aUpdate, std::vector<otError> &aResults)
+{
+    otInstance *                           instance = mNcp.GetInstance();
+    otError                                error    = OT_ERROR_NONE;
+    size_t                                 index    = 0;
+    std::vector<std::function<void(void)>> undoList;
+
+    aResults.assign(aUpdate.GetSize(), OT_ERROR_ABORT);
+
+    for (const otBorderRouterConfig &config : aUpdate.mOnMeshPrefixesToAdd)
+    {
+        otBorderRouterConfig previous;
+        bool                 replaced = FindLocalOnMeshPrefix(instance, config.mPrefix, previous);
+
+        SuccessOrExit(error = otBorderRouterAddOnMeshPrefix(instance, &config));
+        undoList.emplace_back([instance, config, previous, replaced]() {
+            if (replaced)
+            {
+                otBorderRouterAddOnMeshPrefix(instance, &previous);
+            }
+            else
+            {
+                otBorderRouterRemoveOnMeshPrefix(instance, &config.mPrefix);
+            }
+        });
+        index++;
+    }
+
+    for (const otIp6Prefix &prefix : aUpdate.mOnMeshPrefixesToRemove)
+    {
+        otBorderRouterConfig previous;
+
+        VerifyOrExit(FindLocalOnMeshPrefix(instance, prefix, previous), error = OT_ERROR_NOT_FOUND);
+        SuccessOrExit(error = otBorderRouterRemoveOnMeshPrefix(instance, &prefix));
+        undoList.emplace_back([instance, previous]() { otBorderRouterAddOnMeshPrefix(instance, &previous); });
+        index++;
+    }
+
+    for (const otExternalRouteConfig &config : aUpdate.mExternalRoutesToAdd)
+    {
+        otExternalRouteConfig previous;
+        bool                  replaced = FindLocalRoute(instance, config.mPrefix, previous);
+
+        SuccessOrExit(error = otBorderRouterAddRoute(instance, &config));
+        undoList.emplace_back([instance, config, previous, replaced]() {
+            if (replaced)
+            {
+                otBorderRouterAddRoute(instance, &previous);
+            }
+            else
+            {
+                otBorderRouterRemoveRoute(instance, &config.mPrefix);
+            }
+        });
+        index++;
+    }
+
+    for (const otIp6Prefix &prefix : aUpdate.mExternalRoutesToRemove)
+    {
+        otExternalRouteConfig previous;
+
+        VerifyOrExit(FindLocalRoute(instance, prefix, previous), error = OT_ERROR_NOT_FOUND);
+        SuccessOrExit(error = otBorderRouterRemoveRoute(instance, &prefix));
+        undoList.emplace_back([instance, previous]() { otBorderRouterAddRoute(instance, &previous); });
+        index++;
+    }
+
+    // All entries are applied, a single registration bumps the network data version once.
+    aResults.assign(aResults.size(), OT_ERROR_NONE);
+    if (!undoList.empty())
+    {
+        SuccessOrExit(error = otBorderRouterRegister(instance));
+    }
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        // Revert in the reverse order, so that an entry changed twice in the batch gets back its original value.
+        for (auto undo = undoList.rbegin(); undo != undoList.rend(); ++undo)
+        {
+            (*undo)();
+        }
+
+        if (index < aResults.size())
+        {
+            aResults[index] = error;
+        }
+        else
+        {
+            aResults.assign(aResults.size(), error);
+        }
+    }
+
+    otbrLogResult(error == OT_ERROR_NONE ? OTBR_ERROR_NONE : OTBR_ERROR_OPENTHREAD, "Update network data: %zu entries",
+                  aResults.size());
+    Refresh();
+
+    return error;
+}
+
+void RouteManager::SyncKernelRoutes(void)
+{
+    RouteTable         routes;
+    std::vector<Route> added;
+    std::vector<Route> removed;
+
+    for (const Route &route : mRouteTable.GetRoutes())
+    {
+        Route kernelRoute;
+
+        // A default route from the Thread network must not take over the default route of the host.
+        if (route.mLocal || route.mPrefix.mLength == 0)
+        {
+            continue;
+        }
+
+        kernelRoute.mPrefix = route.mPrefix;
+        routes.Add(kernelRoute);
+    }
+
+    RouteTable::Diff(mKernelRoutes, routes, added, removed);
+
+    for (const Route &route : removed)
+    {
+        UpdateKernelRoute(route, /* aInstall */ false);
+    }
+
+    for (const Route &route : added)
+    {
+        UpdateKernelRoute(route, /* aInstall */ true);
+    }
+
+    mKernelRoutes = std::move(routes);
+}
+
+void RouteManager::UpdateKernelRoute(const Route &aRoute, bool aInstall)
+{
+    Ip6AddressString prefix(aRoute.mPrefix.mPrefix);
+    int              exitCode;
+
+    exitCode = SystemUtils::ExecuteCommand("ip -6 route %s %s/%u dev %s proto static metric %u",
+                                           aInstall ? "replace" : "del", prefix.AsCString(), aRoute.mPrefix.mLength,
+                                           mNcp.GetInstanceParams().GetThreadIfName(), kKernelRouteMetric);
+
+    otbrLogResult(exitCode == 0 ? OTBR_ERROR_NONE : OTBR_ERROR_ERRNO, "%s kernel route %s/%u",
+                  aInstall ? "Install" : "Remove", prefix.AsCString(), aRoute.mPrefix.mLength);
+}
+
+} // namespace otbr
@@ -0,0 +1,149 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the route manager which mirrors the Thread network data routes.
+ */
+
+#ifndef OTBR_AGENT_ROUTE_MANAGER_HPP_
+#define OTBR_AGENT_ROUTE_MANAGER_HPP_
+
+#include <vector>
+
+#include <openthread/instance.h>
+#include <openthread/netdata.h>
+
+#include "common/route_table.hpp"
+
+namespace otbr {
+
+namespace Ncp {
+class ControllerOpenThread;
+}
+
+/**
+ * This class keeps a route table of the on-mesh prefixes and external routes in the Thread network data.
+ *
+ * The table is refreshed when the network data changes, so that queries don't need to walk the network data. When
+ * enabled in the instance parameters, the routes announced by other border routers are also installed to the kernel
+ * routing table of the Thread network interface.
+ *
+ */
+class RouteManager
+{
+public:
+    /**
+     * This structure represents a batch of changes to the local network data.
+     *
+     */
+    struct NetworkDataUpdate
+    {
+        std::vector<otBorderRouterConfig>  mOnMeshPrefixesToAdd;    ///< The on-mesh prefixes to add or update.
+        std::vector<otIp6Prefix>           mOnMeshPrefixesToRemove; ///< The on-mesh prefixes to remove.
+        std::vector<otExternalRouteConfig> mExternalRoutesToAdd;    ///< The external routes to add or update.
+        std::vector<otIp6Prefix>           mExternalRoutesToRemove; ///< The external routes to remove.
+
+        /**
+         * This method returns the number of entries in the update.
+         *
+         * @returns The number of entries.
+         *
+         */
+        size_t GetSize(void) const
+        {
+            return mOnMeshPrefixesToAdd.size() + mOnMeshPrefixesToRemove.size() + mExternalRoutesToAdd.size() +
+                   mExternalRoutesToRemove.size();
+        }
+    };
+
+    /**
+     * This constructor initializes the route manager.
+     *
+     * @param[in]  aNcp  A reference to the NCP controller.
+     *
+     */
+    explicit RouteManager(Ncp::ControllerOpenThread &aNcp);
+
+    /**
+     * This destructor removes the routes installed to the kernel.
+     *
+     */
+    ~RouteManager(void);
+
+    /**
+     * This method handles Thread state changes.
+     *
+     * @param[in]  aFlags  The Thread state changed flags.
+     *
+     */
+    void HandleStateChanged(otChangedFlags aFlags);
+
+    /**
+     * This method rebuilds the route table from the network data and the local network data.
+     *
+     */
+    void Refresh(void);
+
+    /**
+     * This method applies a batch of changes to the local network data and registers it once.
+     *
+     * The changes are applied all or nothing: if any entry fails, the entries applied so far are reverted and nothing
+     * is registered.
+     *
+     * @param[in]   aUpdate   The changes to apply.
+     * @param[out]  aResults  The result of each entry, in the order of on-mesh prefixes to add, on-mesh prefixes to
+     *                        remove, external routes to add and external routes to remove. When the update fails, the
+     *                        failing entry reports its error and all other entries report OT_ERROR_ABORT.
+     *
+     * @retval OT_ERROR_NONE  Successfully applied and registered the changes.
+     * @retval ...            Failed to apply or register the changes.
+     *
+     */
+    otError UpdateNetworkData(const NetworkDataUpdate &aUpdate, std::vector<otError> &aResults);
+
+    /**
+     * This method returns the route table.
+     *
+     * @returns A reference to the route table.
+     *
+     */
+    const RouteTable &GetRouteTable(void) const { return mRouteTable; }
+
+private:
+    void SyncKernelRoutes(void);
+    void UpdateKernelRoute(const Route &aRoute, bool aInstall);
+
+    Ncp::ControllerOpenThread &mNcp;
+    RouteTable                 mRouteTable;
+    RouteTable                 mKernelRoutes;
+};
+
+} // namespace otbr
+
+#endif // OTBR_AGENT_ROUTE_MANAGER_HPP_
@@ -0,0 +1,430 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements the persistent snapshot of the Advertising Proxy.
+ */
+
+#define OTBR_LOG_TAG "ADPROXY"
+
+#include "agent/srp_snapshot.hpp"
+
+#include <algorithm>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/tlv.hpp"
+#include "utils/crc16.hpp"
+
+namespace otbr {
+
+namespace {
+
+enum : uint8_t
+{
+    kTlvHost    = 1,
+    kTlvService = 2,
+};
+
+enum : uint8_t
+{
+    kTlvName       = 1,
+    kTlvAddress    = 2,
+    kTlvExpireTime = 3,
+    kTlvType       = 4,
+    kTlvHostName   = 5,
+    kTlvPort       = 6,
+    kTlvTxtData    = 7,
+};
+
+// Large enough for a service with the longest DNS names and a full TXT record.
+constexpr size_t kMaxRecordSize = 4096;
+
+otbrError AppendString(TlvWriter &aWriter, uint8_t aType, const std::string &aString)
+{
+    return aWriter.Append(aType, aString.data(), static_cast<uint16_t>(aString.size()));
+}
+
+otbrError AppendBytes(TlvWriter &aWriter, uint8_t aType, const std::vector<uint8_t> &aBytes)
+{
+    return aWriter.Append(aType, aBytes.data(), static_cast<uint16_t>(aBytes.size()));
+}
+
+otbrError FindString(const TlvReader &aReader, uint8_t aType, std::string &aString)
+{
+    TlvInfo   tlv;
+    otbrError error = aReader.Find(aType, tlv);
+
+    if (error == OTBR_ERROR_NONE)
+    {
+        aString.assign(reinterpret_cast<const char *>(tlv.GetValue()), tlv.GetLength());
+    }
+
+    return error;
+}
+
+otbrError FindBytes(const TlvReader &aReader, uint8_t aType, std::vector<uint8_t> &aBytes)
+{
+    TlvInfo   tlv;
+    otbrError error = aReader.Find(aType, tlv);
+
+    if (error == OTBR_ERROR_NONE)
+    {
+        aBytes.assign(tlv.GetValue(), tlv.GetValue() + tlv.GetLength());
+    }
+
+    return error;
+}
+
+} // namespace
+
+constexpr size_t SrpSnapshot::kHeaderSize;
+constexpr size_t SrpSnapshot::kFileSize;
+
+SrpSnapshot::SrpSnapshot(void)
+    : mData(nullptr)
+{
+}
+
+SrpSnapshot::~SrpSnapshot(void)
+{
+    Close();
+}
+
+otbrError SrpSnapshot::Open(const char *aPath)
+{
+    otbrError   error = OTBR_ERROR_NONE;
+    int         fd    = -1;
+    struct stat st;
+    void *      data;
+    FileHeader  header;
+
+    Close();
+
+    fd = open(aPath, O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    VerifyOrExit(fd != -1, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(fstat(fd, &st) == 0, error = OTBR_ERROR_ERRNO);
+
+    if (static_cast<size_t>(st.st_size) != kFileSize)
+    {
+        // Either a new file or one of an incompatible layout, the extended area reads as zeros.
+        VerifyOrExit(ftruncate(fd, 0) == 0 && ftruncate(fd, kFileSize) == 0, error = OTBR_ERROR_ERRNO);
+    }
+
+    data = mmap(nullptr, kFileSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    VerifyOrExit(data != MAP_FAILED, error = OTBR_ERROR_ERRNO);
+    mData = static_cast<uint8_t *>(data);
+
+    memcpy(&header, mData, sizeof(header));
+    if (header.mMagic != kMagic || header.mVersion != kVersion || header.mSlotSize != kSlotSize)
+    {
+        memset(mData, 0, kFileSize);
+
+        header.mMagic    = kMagic;
+        header.mVersion  = kVersion;
+        header.mSlotSize = kSlotSize;
+        header.mReserved = 0;
+        memcpy(mData, &header, sizeof(header));
+    }
+
+exit:
+    if (fd != -1)
+    {
+        close(fd);
+    }
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to open SRP snapshot %s: %s", aPath, strerror(errno));
+    }
+
+    return error;
+}
+
+void SrpSnapshot::Close(void)
+{
+    if (mData != nullptr)
+    {
+        munmap(mData, kFileSize);
+        mData = nullptr;
+    }
+}
+
+uint16_t SrpSnapshot::ComputeCrc(const SlotHeader &aHeader, const uint8_t *aPayload)
+{
+    Crc16 crc(Crc16::kCcitt);
+
+    crc.Init();
+    crc.Update(reinterpret_cast<const uint8_t *>(&aHeader.mSequence), sizeof(aHeader.mSequence));
+    crc.Update(reinterpret_cast<const uint8_t *>(&aHeader.mLength), sizeof(aHeader.mLength));
+    crc.Update(aPayload, aHeader.mLength);
+
+    return crc.Get();
+}
+
+void SrpSnapshot::Invalidate(void)
+{
+    for (uint8_t i = 0; i < kSlotCount; i++)
+    {
+        uint8_t *slot = GetSlot(i);
+
+        memset(slot, 0, sizeof(SlotHeader));
+        Sync(slot, sizeof(SlotHeader));
+    }
+}
+
+otbrError SrpSnapshot::Sync(const uint8_t *aStart, size_t aLength)
+{
+    // msync() requires a page aligned address. The mapping itself is page aligned but the slots are only
+    // aligned to 4K, which is less than a page on kernels with 16K or 64K pages.
+    size_t    pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t    offset   = static_cast<size_t>(aStart - mData);
+    size_t    start    = offset - offset % pageSize;
+    otbrError error    = OTBR_ERROR_NONE;
+
+    VerifyOrExit(msync(mData + start, offset - start + aLength, MS_SYNC) == 0, error = OTBR_ERROR_ERRNO);
+
+exit:
+    return error;
+}
+
+bool SrpSnapshot::IsSlotValid(uint8_t aIndex) const
+{
+    const uint8_t *slot = GetSlot(aIndex);
+    SlotHeader     header;
+
+    memcpy(&header, slot, sizeof(header));
+
+    return header.mSequence != 0 && header.mLength <= kSlotSize - sizeof(SlotHeader) &&
+           header.mCrc == ComputeCrc(header, slot + sizeof(SlotHeader));
+}
+
+int SrpSnapshot::FindLatestSlot(void) const
+{
+    int      latest         = -1;
+    uint32_t latestSequence = 0;
+
+    for (uint8_t i = 0; i < kSlotCount; i++)
+    {
+        SlotHeader header;
+
+        if (!IsSlotValid(i))
+        {
+            continue;
+        }
+
+        memcpy(&header, GetSlot(i), sizeof(header));
+
+        // Sequence numbers are compared with wrap-around.
+        if (latest == -1 || static_cast<int32_t>(header.mSequence - latestSequence) > 0)
+        {
+            latest         = i;
+            latestSequence = header.mSequence;
+        }
+    }
+
+    return latest;
+}
+
+otbrError SrpSnapshot::Load(std::vector<Host> &aHosts, std::vector<Service> &aServices) const
+{
+    otbrError      error = OTBR_ERROR_NONE;
+    int            index;
+    const uint8_t *slot;
+    SlotHeader     header;
+
+    VerifyOrExit(IsOpen() && (index = FindLatestSlot()) != -1, error = OTBR_ERROR_NOT_FOUND);
+
+    slot = GetSlot(static_cast<uint8_t>(index));
+    memcpy(&header, slot, sizeof(header));
+
+    {
+        TlvReader reader(slot + sizeof(SlotHeader), header.mLength);
+
+        SuccessOrExit(error = reader.Validate());
+
+        // Records of unknown types are skipped.
+        for (const TlvInfo &tlv : reader)
+        {
+            TlvReader record(tlv.GetValue(), tlv.GetLength());
+
+            if (tlv.GetType() == kTlvHost)
+            {
+                Host host;
+
+                SuccessOrExit(error = ParseHost(record, host));
+                aHosts.push_back(std::move(host));
+            }
+            else if (tlv.GetType() == kTlvService)
+            {
+                Service service;
+
+                SuccessOrExit(error = ParseService(record, service));
+                aServices.push_back(std::move(service));
+            }
+        }
+    }
+
+exit:
+    return error;
+}
+
+otbrError SrpSnapshot::ParseHost(const TlvReader &aRecord, Host &aHost)
+{
+    otbrError error;
+
+    SuccessOrExit(error = FindString(aRecord, kTlvName, aHost.mName));
+    SuccessOrExit(error = FindBytes(aRecord, kTlvAddress, aHost.mAddress));
+    SuccessOrExit(error = aRecord.FindUint64(kTlvExpireTime, aHost.mExpireTime));
+
+exit:
+    return error == OTBR_ERROR_NOT_FOUND ? OTBR_ERROR_PARSE : error;
+}
+
+otbrError SrpSnapshot::ParseService(const TlvReader &aRecord, Service &aService)
+{
+    otbrError error;
+
+    SuccessOrExit(error = FindString(aRecord, kTlvName, aService.mName));
+    SuccessOrExit(error = FindString(aRecord, kTlvType, aService.mType));
+    SuccessOrExit(error = FindString(aRecord, kTlvHostName, aService.mHostName));
+    SuccessOrExit(error = aRecord.FindUint16(kTlvPort, aService.mPort));
+    SuccessOrExit(error = FindBytes(aRecord, kTlvTxtData, aService.mTxtData));
+    SuccessOrExit(error = aRecord.FindUint64(kTlvExpireTime, aService.mExpireTime));
+
+exit:
+    return error == OTBR_ERROR_NOT_FOUND ? OTBR_ERROR_PARSE : error;
+}
+
+otbrError SrpSnapshot::Save(const std::vector<Host> &aHosts, const std::vector<Service> &aServices)
+{
+    otbrError  error  = OTBR_ERROR_NONE;
+    int        latest = FindLatestSlot();
+    uint8_t    index  = (latest == 0) ? 1 : 0;
+    uint8_t *  slot;
+    SlotHeader header;
+    uint8_t    record[kMaxRecordSize];
+
+    VerifyOrExit(IsOpen(), error = OTBR_ERROR_INVALID_ARGS);
+
+    slot = GetSlot(index);
+
+    {
+        TlvWriter writer(slot + sizeof(SlotHeader), kSlotSize - sizeof(SlotHeader));
+
+        for (const Host &host : aHosts)
+        {
+            TlvWriter recordWriter(record, sizeof(record));
+
+            SuccessOrExit(error = AppendString(recordWriter, kTlvName, host.mName));
+            SuccessOrExit(error = AppendBytes(recordWriter, kTlvAddress, host.mAddress));
+            SuccessOrExit(error = recordWriter.AppendUint64(kTlvExpireTime, host.mExpireTime));
+            SuccessOrExit(error = writer.Append(kTlvHost, record, static_cast<uint16_t>(recordWriter.GetLength())));
+        }
+
+        for (const Service &service : aServices)
+        {
+            TlvWriter recordWriter(record, sizeof(record));
+
+            SuccessOrExit(error = AppendString(recordWriter, kTlvName, service.mName));
+            SuccessOrExit(error = AppendString(recordWriter, kTlvType, service.mType));
+            SuccessOrExit(error = AppendString(recordWriter, kTlvHostName, service.mHostName));
+            SuccessOrExit(error = recordWriter.AppendUint16(kTlvPort, service.mPort));
+            SuccessOrExit(error = AppendBytes(recordWriter, kTlvTxtData, service.mTxtData));
+            SuccessOrExit(error = recordWriter.AppendUint64(kTlvExpireTime, service.mExpireTime));
+            SuccessOrExit(error =
+                              writer.Append(kTlvService, record, static_cast<uint16_t>(recordWriter.GetLength())));
+        }
+
+        header.mLength = static_cast<uint32_t>(writer.GetLength());
+    }
+
+    if (latest == -1)
+    {
+        header.mSequence = 1;
+    }
+    else
+    {
+        SlotHeader latestHeader;
+
+        memcpy(&latestHeader, GetSlot(static_cast<uint8_t>(latest)), sizeof(latestHeader));
+        // Zero marks a slot which was never written.
+        header.mSequence = (latestHeader.mSequence + 1 == 0) ? 1 : latestHeader.mSequence + 1;
+    }
+
+    header.mReserved = 0;
+    header.mCrc      = ComputeCrc(header, slot + sizeof(SlotHeader));
+
+    // The header is written last, a torn write of either part fails the CRC and the other slot is used.
+    memcpy(slot, &header, sizeof(header));
+
+    // Only the written part of this slot is synced.
+    SuccessOrExit(error = Sync(slot, sizeof(SlotHeader) + header.mLength));
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to save SRP snapshot: %s", otbrErrorString(error));
+
+        if (IsOpen() && error != OTBR_ERROR_ERRNO)
+        {
+            // The previous snapshot no longer matches what is published, so it must not be restored either.
+            Invalidate();
+        }
+    }
+
+    return error;
+}
+
+std::vector<SrpSnapshot::ServiceKey> SrpSnapshot::FindLeftOutServices(const std::map<ServiceKey, Service> &aServices,
+                                                                      const std::string &                  aHostName,
+                                                                      const std::vector<ServiceKey> &      aRegistered)
+{
+    std::vector<ServiceKey> leftOut;
+
+    for (const auto &service : aServices)
+    {
+        if (service.second.mHostName == aHostName &&
+            std::find(aRegistered.begin(), aRegistered.end(), service.first) == aRegistered.end())
+        {
+            leftOut.push_back(service.first);
+        }
+    }
+
+    return leftOut;
+}
+
+} // namespace otbr
@@ -0,0 +1,206 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the persistent snapshot of the Advertising Proxy.
+ */
+
+#ifndef OTBR_AGENT_SRP_SNAPSHOT_HPP_
+#define OTBR_AGENT_SRP_SNAPSHOT_HPP_
+
+#include "openthread-br/config.h"
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/types.hpp"
+
+namespace otbr {
+
+class TlvReader;
+
+/**
+ * This class persists the hosts and services published by the Advertising Proxy.
+ *
+ * The snapshot is kept in a memory-mapped file with two slots which are written alternately. Each slot is protected
+ * by a sequence number and a CRC, so a crash while saving leaves the previous snapshot intact.
+ *
+ */
+class SrpSnapshot
+{
+public:
+    /**
+     * This structure represents a published host.
+     *
+     */
+    struct Host
+    {
+        std::string          mName;       ///< The host name.
+        std::vector<uint8_t> mAddress;    ///< The IPv6 address.
+        uint64_t             mExpireTime; ///< The lease expiry in seconds since the Unix epoch.
+    };
+
+    /**
+     * This structure represents a published service.
+     *
+     */
+    struct Service
+    {
+        std::string          mName;       ///< The service instance name.
+        std::string          mType;       ///< The service type.
+        std::string          mHostName;   ///< The host name.
+        uint16_t             mPort;       ///< The port number.
+        std::vector<uint8_t> mTxtData;    ///< The encoded TXT data.
+        uint64_t             mExpireTime; ///< The lease expiry in seconds since the Unix epoch.
+    };
+
+    typedef std::pair<std::string, std::string> ServiceKey; ///< The service instance name and type.
+
+    SrpSnapshot(void);
+    ~SrpSnapshot(void);
+
+    /**
+     * This method opens the snapshot file, creating it if it doesn't exist.
+     *
+     * @param[in]  aPath  The path of the snapshot file.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully opened the snapshot file.
+     * @retval OTBR_ERROR_ERRNO  Failed to open or map the snapshot file.
+     *
+     */
+    otbrError Open(const char *aPath);
+
+    /**
+     * This method closes the snapshot file.
+     *
+     */
+    void Close(void);
+
+    /**
+     * This method indicates whether the snapshot file is open.
+     *
+     * @returns Whether the snapshot file is open.
+     *
+     */
+    bool IsOpen(void) const { return mData != nullptr; }
+
+    /**
+     * This method loads the latest valid snapshot.
+     *
+     * @param[out]  aHosts     A reference to the vector to receive the hosts.
+     * @param[out]  aServices  A reference to the vector to receive the services.
+     *
+     * @retval OTBR_ERROR_NONE       Successfully loaded the snapshot.
+     * @retval OTBR_ERROR_NOT_FOUND  There is no valid snapshot.
+     * @retval OTBR_ERROR_PARSE      The snapshot is malformed.
+     *
+     */
+    otbrError Load(std::vector<Host> &aHosts, std::vector<Service> &aServices) const;
+
+    /**
+     * This method saves a snapshot.
+     *
+     * @param[in]  aHosts     The hosts.
+     * @param[in]  aServices  The services.
+     *
+     * If the snapshot doesn't fit into a slot, both slots are invalidated so that a stale snapshot isn't restored.
+     *
+     * @retval OTBR_ERROR_NONE          Successfully saved the snapshot.
+     * @retval OTBR_ERROR_INVALID_ARGS  The snapshot doesn't fit into the file.
+     * @retval OTBR_ERROR_ERRNO         Failed to sync the snapshot to the file.
+     *
+     */
+    otbrError Save(const std::vector<Host> &aHosts, const std::vector<Service> &aServices);
+
+    /**
+     * This static method finds the services of a host which are left out of its latest registration.
+     *
+     * The SRP server knows nothing of the services restored from a snapshot, so a restored service which the host
+     * doesn't register again is gone from the SRP client too.
+     *
+     * @param[in]  aServices    The services, keyed by their service instance names and types.
+     * @param[in]  aHostName    The host name.
+     * @param[in]  aRegistered  The service instance names and types in the latest registration of the host.
+     *
+     * @returns The keys of the services of @p aHostName which are not in @p aRegistered.
+     *
+     */
+    static std::vector<ServiceKey> FindLeftOutServices(const std::map<ServiceKey, Service> &aServices,
+                                                      const std::string &                  aHostName,
+                                                      const std::vector<ServiceKey> &      aRegistered);
+
+private:
+    enum : uint32_t
+    {
+        kMagic     = 0x6f747372, ///< "otsr"
+        kVersion   = 1,
+        kSlotSize  = 64 * 1024,
+        kSlotCount = 2,
+    };
+
+    struct FileHeader
+    {
+        uint32_t mMagic;
+        uint32_t mVersion;
+        uint32_t mSlotSize;
+        uint32_t mReserved;
+    };
+
+    struct SlotHeader
+    {
+        uint32_t mSequence;
+        uint32_t mLength;
+        uint16_t mCrc;
+        uint16_t mReserved;
+    };
+
+    static constexpr size_t kHeaderSize = 4096;
+    static constexpr size_t kFileSize   = kHeaderSize + kSlotSize * kSlotCount;
+
+    uint8_t *        GetSlot(uint8_t aIndex) { return mData + kHeaderSize + kSlotSize * aIndex; }
+    const uint8_t *  GetSlot(uint8_t aIndex) const { return mData + kHeaderSize + kSlotSize * aIndex; }
+    void             Invalidate(void);
+    otbrError        Sync(const uint8_t *aStart, size_t aLength);
+    bool             IsSlotValid(uint8_t aIndex) const;
+    int              FindLatestSlot(void) const;
+    static uint16_t  ComputeCrc(const SlotHeader &aHeader, const uint8_t *aPayload);
+    static otbrError ParseHost(const TlvReader &aRecord, Host &aHost);
+    static otbrError ParseService(const TlvReader &aRecord, Service &aService);
+
+    uint8_t *mData;
+};
+
+} // namespace otbr
+
+#endif // OTBR_AGENT_SRP_SNAPSHOT_HPP_
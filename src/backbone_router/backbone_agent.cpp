@@ -50,6 +50,7 @@ BackboneAgent::BackboneAgent(otbr::Ncp::ControllerOpenThread &aNcp)
     , mBackboneRouterState(OT_BACKBONE_ROUTER_STATE_DISABLED)
 #if OTBR_ENABLE_DUA_ROUTING
     , mNdProxyManager(aNcp)
+    , mDuaRoutingManager(aNcp.GetInstanceParams())
 #endif
 {
 }
@@ -57,11 +58,25 @@ BackboneAgent::BackboneAgent(otbr::Ncp::ControllerOpenThread &aNcp)
 void BackboneAgent::Init(void)
 {
     mNcp.AddThreadStateChangedCallback([this](otChangedFlags aFlags) { HandleThreadStateChanged(aFlags); });
+#if OTBR_ENABLE_DUA_ROUTING
+    mNdProxyManager.Init();
+#endif
+
+    RegisterCallbacks();
+}
+
+void BackboneAgent::HandleNcpReset(void)
+{
+    // The new instance starts as a disabled Backbone Router and reports its state changes again.
+    RegisterCallbacks();
+}
+
+void BackboneAgent::RegisterCallbacks(void)
+{
     otBackboneRouterSetDomainPrefixCallback(mNcp.GetInstance(), &BackboneAgent::HandleBackboneRouterDomainPrefixEvent,
                                             this);
 #if OTBR_ENABLE_DUA_ROUTING
     otBackboneRouterSetNdProxyCallback(mNcp.GetInstance(), &BackboneAgent::HandleBackboneRouterNdProxyEvent, this);
-    mNdProxyManager.Init();
 #endif
 
     otBackboneRouterSetEnabled(mNcp.GetInstance(), /* aEnabled */ true);
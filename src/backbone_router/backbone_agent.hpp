@@ -77,6 +77,12 @@ public:
      */
     void Init(void);
 
+    /**
+     * This method registers the Backbone agent with a new OpenThread instance after a reset.
+     *
+     */
+    void HandleNcpReset(void);
+
     /**
      * This method updates the mainloop context.
      *
@@ -94,6 +100,7 @@ public:
     void Process(const MainloopContext &aMainloop) override;
 
 private:
+    void        RegisterCallbacks(void);
     void        OnBecomePrimary(void);
     void        OnResignPrimary(void);
     bool        IsPrimary(void) const { return mBackboneRouterState == OT_BACKBONE_ROUTER_STATE_PRIMARY; }
@@ -65,9 +65,12 @@ public:
     /**
      * This constructor initializes a DUA routing manager instance.
      *
+     * @param[in]  aInstanceParams  A reference to the parameters of the agent instance.
+     *
      */
-    explicit DuaRoutingManager()
-        : mEnabled(false)
+    explicit DuaRoutingManager(const InstanceParams &aInstanceParams)
+        : mInstanceParams(aInstanceParams)
+        , mEnabled(false)
     {
     }
 
@@ -89,8 +92,9 @@ private:
     void AddPolicyRouteToBackbone(void);
     void DelPolicyRouteToBackbone(void);
 
-    Ip6Prefix mDomainPrefix;
-    bool      mEnabled : 1;
+    const InstanceParams &mInstanceParams;
+    Ip6Prefix             mDomainPrefix;
+    bool                  mEnabled : 1;
 };
 
 /**
@@ -0,0 +1,76 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements parsing of ICMPv6 Neighbor Discovery packets.
+ */
+
+#include "backbone_router/nd_packet.hpp"
+
+#include <string.h>
+
+#include <netinet/icmp6.h>
+#include <netinet/in.h>
+#include <netinet/ip6.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace BackboneRouter {
+
+otbrError ParseNeighborSolicitation(const uint8_t *aPacket, size_t aLength, NeighborSolicitInfo &aInfo)
+{
+    otbrError                  error = OTBR_ERROR_NONE;
+    struct ip6_hdr             ip6header;
+    struct nd_neighbor_solicit ns;
+
+    VerifyOrExit(aPacket != nullptr && aLength >= sizeof(ip6header), error = OTBR_ERROR_PARSE);
+
+    // The payload comes from NFQUEUE without any alignment guarantee, so copy the headers out.
+    memcpy(&ip6header, aPacket, sizeof(ip6header));
+    VerifyOrExit(ip6header.ip6_nxt == IPPROTO_ICMPV6, error = OTBR_ERROR_NOT_FOUND);
+
+    // Other ICMPv6 messages may be shorter than a Neighbor Solicitation, so the type is checked first.
+    VerifyOrExit(aLength > sizeof(ip6header), error = OTBR_ERROR_PARSE);
+    VerifyOrExit(aPacket[sizeof(ip6header)] == ND_NEIGHBOR_SOLICIT, error = OTBR_ERROR_NOT_FOUND);
+
+    VerifyOrExit(aLength >= sizeof(ip6header) + sizeof(ns), error = OTBR_ERROR_PARSE);
+    memcpy(&ns, aPacket + sizeof(ip6header), sizeof(ns));
+
+    aInfo.mSource      = Ip6Address(ip6header.ip6_src.s6_addr);
+    aInfo.mDestination = Ip6Address(ip6header.ip6_dst.s6_addr);
+    aInfo.mTarget      = Ip6Address(ns.nd_ns_target.s6_addr);
+    aInfo.mHopLimit    = ip6header.ip6_hlim;
+
+exit:
+    return error;
+}
+
+} // namespace BackboneRouter
+} // namespace otbr
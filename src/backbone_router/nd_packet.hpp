@@ -0,0 +1,86 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for parsing ICMPv6 Neighbor Discovery packets.
+ */
+
+#ifndef ND_PACKET_HPP_
+#define ND_PACKET_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/types.hpp"
+
+namespace otbr {
+namespace BackboneRouter {
+
+/**
+ * @addtogroup border-router-bbr
+ *
+ * @{
+ */
+
+/**
+ * This structure represents the fields of a Neighbor Solicitation used by the ND Proxy.
+ *
+ */
+struct NeighborSolicitInfo
+{
+    Ip6Address mSource;      ///< The IPv6 source address.
+    Ip6Address mDestination; ///< The IPv6 destination address.
+    Ip6Address mTarget;      ///< The target address of the Neighbor Solicitation.
+    uint8_t    mHopLimit;    ///< The IPv6 hop limit.
+};
+
+/**
+ * This function parses an IPv6 packet carrying an ICMPv6 Neighbor Solicitation.
+ *
+ * The packet is untrusted, so every header is checked against @p aLength before it is read.
+ *
+ * @param[in]   aPacket  A pointer to the IPv6 packet.
+ * @param[in]   aLength  The length of @p aPacket in bytes.
+ * @param[out]  aInfo    A reference to receive the parsed fields.
+ *
+ * @retval OTBR_ERROR_NONE       Successfully parsed the Neighbor Solicitation.
+ * @retval OTBR_ERROR_NOT_FOUND  The packet is not a Neighbor Solicitation.
+ * @retval OTBR_ERROR_PARSE      The packet is truncated.
+ *
+ */
+otbrError ParseNeighborSolicitation(const uint8_t *aPacket, size_t aLength, NeighborSolicitInfo &aInfo);
+
+/**
+ * @}
+ */
+
+} // namespace BackboneRouter
+} // namespace otbr
+
+#endif // ND_PACKET_HPP_
@@ -54,14 +54,21 @@
 
 #include "agent/instance_params.hpp"
 #include "backbone_router/constants.hpp"
+#include "backbone_router/nd_packet.hpp"
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/metrics.hpp"
 #include "common/types.hpp"
 #include "utils/system_utils.hpp"
 
 namespace otbr {
 namespace BackboneRouter {
 
+static Metrics::Counter sNsHandled("otbr_ndproxy_ns_handled_total",
+                                   "Number of Neighbor Solicitations answered on behalf of Thread devices.");
+static Metrics::Counter sNsDropped("otbr_ndproxy_ns_dropped_total",
+                                   "Number of Neighbor Solicitations dropped for an invalid hop limit.");
+
 void NdProxyManager::Enable(const Ip6Prefix &aDomainPrefix)
 {
     otbrError error = OTBR_ERROR_NONE;
@@ -79,7 +86,7 @@ void NdProxyManager::Enable(const Ip6Prefix &aDomainPrefix)
     VerifyOrExit(SystemUtils::ExecuteCommand(
                      "ip6tables -t raw -A PREROUTING -6 -d %s -p icmpv6 --icmpv6-type neighbor-solicitation -i %s -j "
                      "NFQUEUE --queue-num 88",
-                     mDomainPrefix.ToString().c_str(), InstanceParams::Get().GetBackboneIfName()) == 0,
+                     mDomainPrefix.ToString().c_str(), mNcp.GetInstanceParams().GetBackboneIfName()) == 0,
                  error = OTBR_ERROR_ERRNO);
 
 exit:
@@ -105,7 +112,7 @@ void NdProxyManager::Disable(void)
     VerifyOrExit(SystemUtils::ExecuteCommand(
                      "ip6tables -t raw -D PREROUTING -6 -d %s -p icmpv6 --icmpv6-type neighbor-solicitation -i %s -j "
                      "NFQUEUE --queue-num 88",
-                     mDomainPrefix.ToString().c_str(), InstanceParams::Get().GetBackboneIfName()) == 0,
+                     mDomainPrefix.ToString().c_str(), mNcp.GetInstanceParams().GetBackboneIfName()) == 0,
                  error = OTBR_ERROR_ERRNO);
 
 exit:
@@ -114,7 +121,7 @@ exit:
 
 void NdProxyManager::Init(void)
 {
-    mBackboneIfIndex = if_nametoindex(InstanceParams::Get().GetBackboneIfName());
+    mBackboneIfIndex = if_nametoindex(mNcp.GetInstanceParams().GetBackboneIfName());
     VerifyOrDie(mBackboneIfIndex > 0, "if_nametoindex failed");
 }
 
@@ -185,7 +192,7 @@ void NdProxyManager::ProcessMulticastNeighborSolicition()
         // only process neighbor solicit
         VerifyOrExit(icmp6header->icmp6_type == ND_NEIGHBOR_SOLICIT, error = OTBR_ERROR_PARSE);
 
-        otbrLogDebug("NdProxyManager: Received ND-NS from %s", src.ToString().c_str());
+        otbrLogDebug("NdProxyManager: Received ND-NS from %s", Ip6AddressString(src).AsCString());
 
         for (cmsghdr = CMSG_FIRSTHDR(&msghdr); cmsghdr; cmsghdr = CMSG_NXTHDR(&msghdr, cmsghdr))
         {
@@ -212,8 +219,8 @@ void NdProxyManager::ProcessMulticastNeighborSolicition()
                         }
                     }
 
-                    otbrLogDebug("NdProxyManager: dst=%s, ifindex=%d, proxying=%s", dst.ToString().c_str(), ifindex,
-                                 found ? "Y" : "N");
+                    otbrLogDebug("NdProxyManager: dst=%s, ifindex=%d, proxying=%s", Ip6AddressString(dst).AsCString(),
+                                 ifindex, found ? "Y" : "N");
                 }
                 break;
 
@@ -224,7 +231,7 @@ void NdProxyManager::ProcessMulticastNeighborSolicition()
 
                     otbrLogDebug("NdProxyManager: hops=%d (%s)", hops, hops == 255 ? "Good" : "Bad");
 
-                    VerifyOrExit(hops == 255);
+                    VerifyOrExit(hops == 255, sNsDropped.Increment());
                 }
                 break;
             }
@@ -236,10 +243,11 @@ void NdProxyManager::ProcessMulticastNeighborSolicition()
             struct nd_neighbor_solicit *ns     = reinterpret_cast<struct nd_neighbor_solicit *>(packet);
             Ip6Address &                target = *reinterpret_cast<Ip6Address *>(&ns->nd_ns_target);
 
-            otbrLogInfo("NdProxyManager: send solicited NA for multicast NS: src=%s, target=%s", src.ToString().c_str(),
-                        target.ToString().c_str());
+            otbrLogInfo("NdProxyManager: send solicited NA for multicast NS: src=%s, target=%s",
+                        Ip6AddressString(src).AsCString(), Ip6AddressString(target).AsCString());
 
             SendNeighborAdvertisement(target, src);
+            sNsHandled.Increment();
         }
     }
 
@@ -354,7 +362,7 @@ otbrError NdProxyManager::UpdateMacAddress(void)
     struct ifreq ifr;
 
     memset(&ifr, 0, sizeof(ifr));
-    strncpy(ifr.ifr_name, InstanceParams::Get().GetBackboneIfName(), sizeof(ifr.ifr_name) - 1);
+    strncpy(ifr.ifr_name, mNcp.GetInstanceParams().GetBackboneIfName(), sizeof(ifr.ifr_name) - 1);
 
     VerifyOrExit(ioctl(mIcmp6RawSock, SIOCGIFHWADDR, &ifr) != -1, error = OTBR_ERROR_ERRNO);
     memcpy(mMacAddress.m8, ifr.ifr_hwaddr.sa_data, sizeof(mMacAddress));
@@ -377,8 +385,8 @@ otbrError NdProxyManager::InitIcmp6RawSocket(void)
     VerifyOrExit(mIcmp6RawSock >= 0, error = OTBR_ERROR_ERRNO);
 
 #if __linux__
-    VerifyOrExit(setsockopt(mIcmp6RawSock, SOL_SOCKET, SO_BINDTODEVICE, InstanceParams::Get().GetBackboneIfName(),
-                            strlen(InstanceParams::Get().GetBackboneIfName())) == 0,
+    VerifyOrExit(setsockopt(mIcmp6RawSock, SOL_SOCKET, SO_BINDTODEVICE, mNcp.GetInstanceParams().GetBackboneIfName(),
+                            strlen(mNcp.GetInstanceParams().GetBackboneIfName())) == 0,
                  error = OTBR_ERROR_ERRNO);
 #else  // __NetBSD__ || __FreeBSD__ || __APPLE__
     VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_IP, IP_BOUND_IF, mBackboneIfName.c_str(), mBackboneIfName.size()),
@@ -478,17 +486,13 @@ int NdProxyManager::HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
     OTBR_UNUSED_VARIABLE(aNfMsg);
 
     struct nfqnl_msg_packet_hdr *ph;
-    unsigned char *              data;
+    unsigned char *              data    = nullptr;
     uint32_t                     id      = 0;
     int                          ret     = 0;
     int                          len     = 0;
     int                          verdict = NF_ACCEPT;
-
-    Ip6Address        dst;
-    Ip6Address        src;
-    struct icmp6_hdr *icmp6header = nullptr;
-    struct ip6_hdr *  ip6header   = nullptr;
-    otbrError         error       = OTBR_ERROR_NONE;
+    NeighborSolicitInfo          ns;
+    otbrError                    error = OTBR_ERROR_NONE;
 
     if ((ph = nfq_get_msg_packet_hdr(aNfData)) != nullptr)
     {
@@ -497,31 +501,22 @@ int NdProxyManager::HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
     }
 
     VerifyOrExit((len = nfq_get_payload(aNfData, &data)) > 0, error = OTBR_ERROR_PARSE);
+    error = ParseNeighborSolicitation(data, static_cast<size_t>(len), ns);
+    // Other packets are let through quietly, only malformed Neighbor Solicitations are worth a warning.
+    VerifyOrExit(error != OTBR_ERROR_NOT_FOUND, error = OTBR_ERROR_NONE);
+    SuccessOrExit(error);
 
-    ip6header = reinterpret_cast<struct ip6_hdr *>(data);
-    src       = *reinterpret_cast<Ip6Address *>(&ip6header->ip6_src);
-    dst       = *reinterpret_cast<Ip6Address *>(&ip6header->ip6_dst);
-
-    VerifyOrExit(ip6header->ip6_nxt == IPPROTO_ICMPV6);
-
-    otbrLogDebug("NdProxyManager: Handle Neighbor Solicitation: from %s to %s", src.ToString().c_str(),
-                 dst.ToString().c_str());
+    otbrLogDebug("NdProxyManager: Handle Neighbor Solicitation: from %s to %s",
+                 Ip6AddressString(ns.mSource).AsCString(), Ip6AddressString(ns.mDestination).AsCString());
 
-    icmp6header = reinterpret_cast<struct icmp6_hdr *>(data + sizeof(struct ip6_hdr));
-    VerifyOrExit(icmp6header->icmp6_type == ND_NEIGHBOR_SOLICIT);
+    VerifyOrExit(mNdProxySet.find(ns.mDestination) != mNdProxySet.end(), error = OTBR_ERROR_NOT_FOUND);
 
-    VerifyOrExit(mNdProxySet.find(dst) != mNdProxySet.end(), error = OTBR_ERROR_NOT_FOUND);
-
-    {
-        struct nd_neighbor_solicit &ns = *reinterpret_cast<struct nd_neighbor_solicit *>(data + sizeof(struct ip6_hdr));
-        Ip6Address &                target = *reinterpret_cast<Ip6Address *>(&ns.nd_ns_target);
-
-        otbrLogDebug("NdProxyManager: %s: target: %s, hoplimit %d", __FUNCTION__, target.ToString().c_str(),
-                     ip6header->ip6_hlim);
-        VerifyOrExit(ip6header->ip6_hlim == 255, error = OTBR_ERROR_PARSE);
-        SendNeighborAdvertisement(target, src);
-        verdict = NF_DROP;
-    }
+    otbrLogDebug("NdProxyManager: %s: target: %s, hoplimit %d", __FUNCTION__, Ip6AddressString(ns.mTarget).AsCString(),
+                 ns.mHopLimit);
+    VerifyOrExit(ns.mHopLimit == 255, error = OTBR_ERROR_PARSE, sNsDropped.Increment());
+    SendNeighborAdvertisement(ns.mTarget, ns.mSource);
+    sNsHandled.Increment();
+    verdict = NF_DROP;
 
 exit:
     ret = nfq_set_verdict(aNfQueueHandler, id, verdict, len, data);
@@ -544,8 +539,8 @@ void NdProxyManager::JoinSolicitedNodeMulticastGroup(const Ip6Address &aTarget)
     VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_IPV6, IPV6_JOIN_GROUP, &mreq, sizeof(mreq)) == 0,
                  error = OTBR_ERROR_ERRNO);
 exit:
-    otbrLogResult(error, "NdProxyManager: JoinSolicitedNodeMulticastGroup of %s: %s", aTarget.ToString().c_str(),
-                  solicitedMulticastAddress.ToString().c_str());
+    otbrLogResult(error, "NdProxyManager: JoinSolicitedNodeMulticastGroup of %s: %s",
+                  Ip6AddressString(aTarget).AsCString(), Ip6AddressString(solicitedMulticastAddress).AsCString());
 }
 
 void NdProxyManager::LeaveSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const
@@ -560,8 +555,8 @@ void NdProxyManager::LeaveSolicitedNodeMulticastGroup(const Ip6Address &aTarget)
     VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_IPV6, IPV6_LEAVE_GROUP, &mreq, sizeof(mreq)) == 0,
                  error = OTBR_ERROR_ERRNO);
 exit:
-    otbrLogResult(error, "NdProxyManager: LeaveSolicitedNodeMulticastGroup of %s: %s", aTarget.ToString().c_str(),
-                  solicitedMulticastAddress.ToString().c_str());
+    otbrLogResult(error, "NdProxyManager: LeaveSolicitedNodeMulticastGroup of %s: %s",
+                  Ip6AddressString(aTarget).AsCString(), Ip6AddressString(solicitedMulticastAddress).AsCString());
 }
 
 } // namespace BackboneRouter
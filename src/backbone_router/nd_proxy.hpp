@@ -44,8 +44,8 @@
 #include <libnetfilter_queue/libnetfilter_queue.h>
 #include <map>
 #include <netinet/in.h>
-#include <set>
 #include <string>
+#include <unordered_set>
 
 #include <openthread/backbone_router_ftd.h>
 
@@ -162,7 +162,7 @@ private:
     int HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler, struct nfgenmsg *aNfMsg, struct nfq_data *aNfData);
 
     otbr::Ncp::ControllerOpenThread &mNcp;
-    std::set<Ip6Address>             mNdProxySet;
+    std::unordered_set<Ip6Address>   mNdProxySet;
     uint32_t                         mBackboneIfIndex;
     int                              mIcmp6RawSock;
     int                              mUnicastNsQueueSock;
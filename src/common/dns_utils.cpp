@@ -32,6 +32,11 @@
 
 #include "common/code_utils.hpp"
 
+enum
+{
+    kMaxLabelLength = 63,
+};
+
 static bool NameEndsWithDot(const std::string &aName)
 {
     return !aName.empty() && aName.back() == '.';
@@ -139,3 +144,31 @@ otbrError SplitFullHostName(const std::string &aFullName, std::string &aHostName
 exit:
     return error;
 }
+
+static std::string AppendSuffix(const std::string &aName, const std::string &aSuffix)
+{
+    size_t length = aName.size();
+
+    if (length + aSuffix.size() > kMaxLabelLength)
+    {
+        length = kMaxLabelLength - aSuffix.size();
+
+        // Do not split a UTF-8 multi-byte character.
+        while (length > 0 && (static_cast<uint8_t>(aName[length]) & 0xc0) == 0x80)
+        {
+            --length;
+        }
+    }
+
+    return aName.substr(0, length) + aSuffix;
+}
+
+std::string MakeAlternativeServiceName(const std::string &aInstanceName, uint8_t aRenameCount)
+{
+    return AppendSuffix(aInstanceName, " (" + std::to_string(aRenameCount + 1) + ")");
+}
+
+std::string MakeAlternativeHostName(const std::string &aHostName, uint8_t aRenameCount)
+{
+    return AppendSuffix(aHostName, "-" + std::to_string(aRenameCount + 1));
+}
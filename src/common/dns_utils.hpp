@@ -129,4 +129,32 @@ otbrError SplitFullServiceInstanceName(const std::string &aFullName,
  */
 otbrError SplitFullHostName(const std::string &aFullName, std::string &aHostName, std::string &aDomain);
 
+/**
+ * This function makes an alternative service instance name after a name conflict, e.g. "Name (2)".
+ *
+ * The number is derived from the rename count only, so the same requested name always yields the same sequence of
+ * alternatives. The base name is truncated on a UTF-8 character boundary to keep the result within one DNS label.
+ *
+ * @param[in] aInstanceName  The requested service instance name.
+ * @param[in] aRenameCount   The number of renames so far, starting from 1.
+ *
+ * @returns  The alternative service instance name.
+ *
+ */
+std::string MakeAlternativeServiceName(const std::string &aInstanceName, uint8_t aRenameCount);
+
+/**
+ * This function makes an alternative host name after a name conflict, e.g. "name-2".
+ *
+ * The number is derived from the rename count only, so the same requested name always yields the same sequence of
+ * alternatives. The base name is truncated on a UTF-8 character boundary to keep the result within one DNS label.
+ *
+ * @param[in] aHostName     The requested host name.
+ * @param[in] aRenameCount  The number of renames so far, starting from 1.
+ *
+ * @returns  The alternative host name.
+ *
+ */
+std::string MakeAlternativeHostName(const std::string &aHostName, uint8_t aRenameCount);
+
 #endif // OTBR_COMMON_DNS_UTILS_HPP_
@@ -40,8 +40,21 @@
 #include <sys/time.h>
 #include <syslog.h>
 
+#if OTBR_ENABLE_ASYNC_LOGGING
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <atomic>
 #include <sstream>
 
+#if OTBR_ENABLE_ASYNC_LOGGING
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
 #include "common/code_utils.hpp"
 #include "common/time.hpp"
 
@@ -50,6 +63,253 @@ static const char   sLevelString[][8] = {
     "[EMERG]", "[ALERT]", "[CRIT]", "[ERR ]", "[WARN]", "[NOTE]", "[INFO]", "[DEBG]",
 };
 
+static std::atomic<uint32_t> sDroppedCount(0);
+
+enum : uint8_t
+{
+    kMaxTagSize   = 7,  ///< Max number of tag characters shown in the log prefix.
+    kMaxTagLevels = 16, ///< Max number of tags with their own log level.
+};
+
+struct TagLevel
+{
+    char         mTag[kMaxTagSize + 1];
+    otbrLogLevel mLevel;
+};
+
+static TagLevel     sTagLevels[kMaxTagLevels];
+static uint8_t      sTagLevelCount = 0;
+static otbrLogLevel sMaxLevel      = OTBR_LOG_INFO; // The most verbose level of the global and all tag levels.
+
+#if OTBR_ENABLE_ASYNC_LOGGING
+
+/**
+ * Asynchronous log writer.
+ *
+ * Log lines are formatted on the calling thread into a bounded lock-free ring of fixed-size slots and written to
+ * syslog by a low-priority background thread. When the ring is full, the line is dropped and counted instead of
+ * blocking the caller. Critical and more severe lines are always written synchronously so they are not lost when
+ * the process exits right after logging them.
+ *
+ */
+enum : uint32_t
+{
+    kLogSlotCount       = 128,  ///< Number of slots in the ring, MUST be a power of two.
+    kLogSlotMessageSize = 1024, ///< Max size of a formatted log line, including the null character.
+    kLogWriterNice      = 10,   ///< The nice value of the writer thread.
+    kLogWriterPollMs    = 100,  ///< The max time the writer sleeps before checking the ring again.
+};
+
+static_assert((kLogSlotCount & (kLogSlotCount - 1)) == 0, "kLogSlotCount must be a power of two");
+
+struct LogSlot
+{
+    std::atomic<uint32_t> mSequence;
+    otbrLogLevel          mLevel;
+    char                  mMessage[kLogSlotMessageSize];
+};
+
+static LogSlot                 sLogSlots[kLogSlotCount];
+static std::atomic<uint32_t>   sLogEnqueuePos(0);
+static uint32_t                sLogDequeuePos = 0; // Only accessed by the writer thread.
+static std::atomic<bool>       sLogWriterRunning(false);
+static std::thread *           sLogWriter = nullptr;
+static std::mutex              sLogWriterMutex;
+static std::condition_variable sLogWriterCondition;
+
+/**
+ * This function reserves a slot in the ring.
+ *
+ * @returns A pointer to the reserved slot, or nullptr if the ring is full.
+ *
+ */
+static LogSlot *ReserveLogSlot(uint32_t &aPosition)
+{
+    LogSlot *slot     = nullptr;
+    uint32_t position = sLogEnqueuePos.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        LogSlot &candidate = sLogSlots[position & (kLogSlotCount - 1)];
+        int32_t  diff = static_cast<int32_t>(candidate.mSequence.load(std::memory_order_acquire) - position);
+
+        if (diff == 0)
+        {
+            if (sLogEnqueuePos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                slot = &candidate;
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // The writer has not consumed this slot yet, the ring is full.
+            break;
+        }
+        else
+        {
+            position = sLogEnqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    aPosition = position;
+
+    return slot;
+}
+
+static void EnqueueLogv(otbrLogLevel aLevel, const char *aFormat, va_list aArgs)
+{
+    uint32_t position;
+    LogSlot *slot = ReserveLogSlot(position);
+
+    if (slot == nullptr)
+    {
+        sDroppedCount.fetch_add(1, std::memory_order_relaxed);
+        ExitNow();
+    }
+
+    slot->mLevel = aLevel;
+    vsnprintf(slot->mMessage, sizeof(slot->mMessage), aFormat, aArgs);
+    slot->mSequence.store(position + 1, std::memory_order_release);
+
+    sLogWriterCondition.notify_one();
+
+exit:
+    return;
+}
+
+/**
+ * This function writes all committed slots to syslog.
+ *
+ */
+static void DrainLogSlots(void)
+{
+    uint32_t dropped;
+
+    while (true)
+    {
+        LogSlot &slot = sLogSlots[sLogDequeuePos & (kLogSlotCount - 1)];
+
+        if (slot.mSequence.load(std::memory_order_acquire) != sLogDequeuePos + 1)
+        {
+            break;
+        }
+
+        syslog(static_cast<int>(slot.mLevel), "%s", slot.mMessage);
+
+        slot.mSequence.store(sLogDequeuePos + kLogSlotCount, std::memory_order_release);
+        ++sLogDequeuePos;
+    }
+
+    dropped = sDroppedCount.exchange(0, std::memory_order_relaxed);
+
+    if (dropped > 0)
+    {
+        syslog(LOG_WARNING, "%s-LOG-----: Dropped %u log messages", sLevelString[OTBR_LOG_WARNING], dropped);
+    }
+}
+
+static void RunLogWriter(void)
+{
+    // Linux applies the nice value to the calling thread only.
+    setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), kLogWriterNice);
+
+    while (sLogWriterRunning.load(std::memory_order_acquire))
+    {
+        DrainLogSlots();
+
+        {
+            std::unique_lock<std::mutex> lock(sLogWriterMutex);
+
+            // Producers notify without holding the mutex, so a wakeup may be missed,
+            // the timeout bounds the resulting delay.
+            sLogWriterCondition.wait_for(lock, otbr::Milliseconds(kLogWriterPollMs));
+        }
+    }
+
+    DrainLogSlots();
+}
+
+static void StartLogWriter(void)
+{
+    static bool sAtExitRegistered = false;
+
+    VerifyOrExit(sLogWriter == nullptr);
+
+    for (uint32_t i = 0; i < kLogSlotCount; i++)
+    {
+        sLogSlots[i].mSequence.store(i, std::memory_order_relaxed);
+    }
+    sLogEnqueuePos.store(0, std::memory_order_relaxed);
+    sLogDequeuePos = 0;
+
+    sLogWriterRunning.store(true, std::memory_order_release);
+    sLogWriter = new std::thread(RunLogWriter);
+
+    if (!sAtExitRegistered)
+    {
+        // Flush pending lines when the process exits without calling otbrLogDeinit().
+        atexit(otbrLogDeinit);
+        sAtExitRegistered = true;
+    }
+
+exit:
+    return;
+}
+
+static void StopLogWriter(void)
+{
+    VerifyOrExit(sLogWriter != nullptr);
+
+    sLogWriterRunning.store(false, std::memory_order_release);
+    sLogWriterCondition.notify_one();
+    sLogWriter->join();
+
+    delete sLogWriter;
+    sLogWriter = nullptr;
+
+exit:
+    return;
+}
+
+#endif // OTBR_ENABLE_ASYNC_LOGGING
+
+static void WriteLogv(otbrLogLevel aLevel, const char *aFormat, va_list aArgs)
+{
+#if OTBR_ENABLE_ASYNC_LOGGING
+    if (aLevel > OTBR_LOG_CRIT && sLogWriterRunning.load(std::memory_order_relaxed))
+    {
+        EnqueueLogv(aLevel, aFormat, aArgs);
+    }
+    else
+#endif
+    {
+        vsyslog(static_cast<int>(aLevel), aFormat, aArgs);
+    }
+}
+
+static void WriteLog(otbrLogLevel aLevel, const char *aFormat, ...)
+{
+    va_list ap;
+
+    va_start(ap, aFormat);
+    WriteLogv(aLevel, aFormat, ap);
+    va_end(ap);
+}
+
+static void UpdateMaxLevel(void)
+{
+    sMaxLevel = sLevel;
+
+    for (uint8_t i = 0; i < sTagLevelCount; i++)
+    {
+        if (sTagLevels[i].mLevel > sMaxLevel)
+        {
+            sMaxLevel = sTagLevels[i].mLevel;
+        }
+    }
+}
+
 /** Get the current debug log level */
 otbrLogLevel otbrLogGetLevel(void)
 {
@@ -64,31 +324,92 @@ void otbrLogInit(const char *aIdent, otbrLogLevel aLevel, bool aPrintStderr)
 
     openlog(aIdent, (LOG_CONS | LOG_PID) | (aPrintStderr ? LOG_PERROR : 0), LOG_USER);
     sLevel = aLevel;
+    UpdateMaxLevel();
+
+#if OTBR_ENABLE_ASYNC_LOGGING
+    StartLogWriter();
+#endif
+}
+
+uint32_t otbrLogGetDroppedCount(void)
+{
+    return sDroppedCount.load(std::memory_order_relaxed);
 }
 
-static const char *GetPrefix(const char *aLogTag)
+otbrError otbrLogSetTagLevel(const char *aLogTag, otbrLogLevel aLevel)
 {
-    // Log prefix format : -xxx-----
-    const uint8_t kMaxTagSize = 7;
-    const uint8_t kBufferSize = kMaxTagSize + 3;
-    static char   prefix[kBufferSize];
-    uint8_t       tagLength = strlen(aLogTag) > kMaxTagSize ? kMaxTagSize : strlen(aLogTag);
-    int           index     = 0;
+    otbrError error = OTBR_ERROR_NONE;
+    TagLevel *entry = nullptr;
 
-    if (strlen(aLogTag) > 0)
+    assert(aLogTag);
+    VerifyOrExit(aLevel >= OTBR_LOG_EMERG && aLevel <= OTBR_LOG_DEBUG, error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(aLogTag[0] != '\0' && strlen(aLogTag) <= kMaxTagSize, error = OTBR_ERROR_INVALID_ARGS);
+
+    for (uint8_t i = 0; i < sTagLevelCount; i++)
     {
-        prefix[0] = '-';
-        memcpy(&prefix[1], aLogTag, tagLength);
+        if (strcmp(sTagLevels[i].mTag, aLogTag) == 0)
+        {
+            entry = &sTagLevels[i];
+            break;
+        }
+    }
 
-        index = tagLength + 1;
+    if (entry == nullptr)
+    {
+        VerifyOrExit(sTagLevelCount < kMaxTagLevels, error = OTBR_ERROR_INVALID_ARGS);
+        entry = &sTagLevels[sTagLevelCount++];
+        strcpy(entry->mTag, aLogTag);
+    }
+
+    entry->mLevel = aLevel;
+    UpdateMaxLevel();
 
-        memset(&prefix[index], '-', kMaxTagSize - tagLength + 1);
-        index += kMaxTagSize - tagLength + 1;
+exit:
+    return error;
+}
+
+bool otbrLogIsEnabled(otbrLogLevel aLevel, const char *aLogTag)
+{
+    otbrLogLevel level = sLevel;
+
+    VerifyOrExit(aLevel <= sMaxLevel);
+
+    for (uint8_t i = 0; i < sTagLevelCount; i++)
+    {
+        if (strcmp(sTagLevels[i].mTag, aLogTag) == 0)
+        {
+            level = sTagLevels[i].mLevel;
+            break;
+        }
     }
 
-    prefix[index++] = '\0';
+exit:
+    return aLevel <= level;
+}
+
+/**
+ * This function writes the log prefix of @p aLogTag into @p aPrefix.
+ *
+ * The prefix format is "-TAG----", padded with dashes to a fixed width.
+ *
+ */
+static const char *GetPrefix(const char *aLogTag, char (&aPrefix)[kMaxTagSize + 3])
+{
+    size_t tagLength = strnlen(aLogTag, kMaxTagSize);
+
+    if (tagLength > 0)
+    {
+        aPrefix[0] = '-';
+        memcpy(&aPrefix[1], aLogTag, tagLength);
+        memset(&aPrefix[tagLength + 1], '-', kMaxTagSize - tagLength + 1);
+        aPrefix[kMaxTagSize + 2] = '\0';
+    }
+    else
+    {
+        aPrefix[0] = '\0';
+    }
 
-    return prefix;
+    return aPrefix;
 }
 
 /** log to the syslog or log file */
@@ -97,12 +418,13 @@ void otbrLog(otbrLogLevel aLevel, const char *aLogTag, const char *aFormat, ...)
     const uint16_t kBufferSize = 1024;
     va_list        ap;
     char           buffer[kBufferSize];
+    char           prefix[kMaxTagSize + 3];
 
     va_start(ap, aFormat);
 
-    if ((aLevel <= sLevel) && (vsnprintf(buffer, sizeof(buffer), aFormat, ap) > 0))
+    if (otbrLogIsEnabled(aLevel, aLogTag) && (vsnprintf(buffer, sizeof(buffer), aFormat, ap) > 0))
     {
-        syslog(static_cast<int>(aLevel), "%s%s: %s", sLevelString[aLevel], GetPrefix(aLogTag), buffer);
+        WriteLog(aLevel, "%s%s: %s", sLevelString[aLevel], GetPrefix(aLogTag, prefix), buffer);
     }
 
     va_end(ap);
@@ -117,7 +439,7 @@ void otbrLogv(otbrLogLevel aLevel, const char *aFormat, va_list ap)
 
     if (aLevel <= sLevel)
     {
-        vsyslog(static_cast<int>(aLevel), aFormat, ap);
+        WriteLogv(aLevel, aFormat, ap);
     }
 }
 
@@ -130,7 +452,7 @@ void otbrDump(otbrLogLevel aLevel, const char *aPrefix, const void *aMemory, siz
     const uint8_t *p8;
     int            addr;
 
-    if (aLevel >= sLevel)
+    if (aLevel > sLevel)
     {
         return;
     }
@@ -168,7 +490,7 @@ void otbrDump(otbrLogLevel aLevel, const char *aPrefix, const void *aMemory, siz
         }
         *ch = 0;
 
-        syslog(static_cast<int>(aLevel), "%s: %04x: %s", aPrefix, addr, hex);
+        WriteLog(aLevel, "%s: %04x: %s", aPrefix, addr, hex);
     }
 }
 
@@ -223,5 +545,8 @@ const char *otbrErrorString(otbrError aError)
 
 void otbrLogDeinit(void)
 {
+#if OTBR_ENABLE_ASYNC_LOGGING
+    StopLogWriter();
+#endif
     closelog();
 }
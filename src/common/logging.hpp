@@ -60,6 +60,19 @@ typedef enum
     OTBR_LOG_DEBUG,   /* debug-level messages */
 } otbrLogLevel;
 
+/**
+ * @def OTBR_LOG_LEVEL_MAX
+ *
+ * The most verbose log level compiled into the binary.
+ *
+ * Log macros for less severe levels expand to code that is removed by the compiler,
+ * including the evaluation of their arguments.
+ *
+ */
+#ifndef OTBR_LOG_LEVEL_MAX
+#define OTBR_LOG_LEVEL_MAX OTBR_LOG_DEBUG
+#endif
+
 /**
  * Get current log level
  */
@@ -83,6 +96,43 @@ void otbrLogEnableSyslog(bool aEnabled);
  */
 void otbrLogInit(const char *aIdent, otbrLogLevel aLevel, bool aPrintStderr);
 
+/**
+ * This function returns the number of log messages dropped since the last report.
+ *
+ * Messages are only dropped when the asynchronous log writer is enabled (`OTBR_ENABLE_ASYNC_LOGGING`)
+ * and it cannot keep up with the producers.
+ *
+ * @returns The number of dropped log messages.
+ *
+ */
+uint32_t otbrLogGetDroppedCount(void);
+
+/**
+ * This function sets the log level of a single log tag.
+ *
+ * The level of @p aLogTag overrides the level given to `otbrLogInit` for messages with this tag. This function
+ * should be called before other threads start logging.
+ *
+ * @param[in]   aLogTag    The log tag.
+ * @param[in]   aLevel     Log level of the tag.
+ *
+ * @retval OTBR_ERROR_NONE          Successfully set the log level.
+ * @retval OTBR_ERROR_INVALID_ARGS  The tag or level is invalid, or too many tags have their own levels.
+ *
+ */
+otbrError otbrLogSetTagLevel(const char *aLogTag, otbrLogLevel aLevel);
+
+/**
+ * This function checks whether messages at level @p aLevel with tag @p aLogTag are logged.
+ *
+ * @param[in]   aLevel         Log level of the message.
+ * @param[in]   aLogTag        Log tag.
+ *
+ * @returns Whether the message would be logged.
+ *
+ */
+bool otbrLogIsEnabled(otbrLogLevel aLevel, const char *aLogTag);
+
 /**
  * This function log at level @p aLevel.
  *
@@ -140,14 +190,31 @@ void otbrLogDeinit(void);
  * @param[in]   ...       Arguments for the format specification.
  *
  */
-#define otbrLogResult(aError, aFormat, ...)                                                               \
-    do                                                                                                    \
-    {                                                                                                     \
-        otbrError _err = (aError);                                                                        \
-        otbrLog(_err == OTBR_ERROR_NONE ? OTBR_LOG_INFO : OTBR_LOG_WARNING, OTBR_LOG_TAG, aFormat ": %s", \
-                ##__VA_ARGS__, otbrErrorString(_err));                                                    \
+#define otbrLogResult(aError, aFormat, ...)                                               \
+    do                                                                                    \
+    {                                                                                     \
+        otbrError    _err   = (aError);                                                   \
+        otbrLogLevel _level = _err == OTBR_ERROR_NONE ? OTBR_LOG_INFO : OTBR_LOG_WARNING; \
+        otbrLogAtLevel(_level, aFormat ": %s", ##__VA_ARGS__, otbrErrorString(_err));     \
     } while (0)
 
+/**
+ * This macro logs at level @p aLevel with the tag `OTBR_LOG_TAG`.
+ *
+ * The arguments are only evaluated if the message will be logged. Messages less severe than
+ * `OTBR_LOG_LEVEL_MAX` are compiled out.
+ *
+ * This macro is an expression so it can be used in the action list of `VerifyOrExit`.
+ *
+ * @param[in]   aLevel    Log level of the message.
+ * @param[in]   ...       Format string and arguments as in printf.
+ *
+ */
+#define otbrLogAtLevel(aLevel, ...)                                               \
+    (((aLevel) <= OTBR_LOG_LEVEL_MAX && otbrLogIsEnabled((aLevel), OTBR_LOG_TAG)) \
+         ? otbrLog((aLevel), OTBR_LOG_TAG, __VA_ARGS__)                           \
+         : (void)0)
+
 /**
  * @def otbrLogEmerg
  *
@@ -219,13 +286,13 @@ void otbrLogDeinit(void);
  * @param[in] ...  Arguments for the format specification.
  *
  */
-#define otbrLogEmerg(...) otbrLog(OTBR_LOG_EMERG, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogAlert(...) otbrLog(OTBR_LOG_ALERT, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogCrit(...) otbrLog(OTBR_LOG_CRIT, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogErr(...) otbrLog(OTBR_LOG_ERR, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogWarning(...) otbrLog(OTBR_LOG_WARNING, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogNotice(...) otbrLog(OTBR_LOG_NOTICE, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogInfo(...) otbrLog(OTBR_LOG_INFO, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogDebug(...) otbrLog(OTBR_LOG_DEBUG, OTBR_LOG_TAG, __VA_ARGS__)
+#define otbrLogEmerg(...) otbrLogAtLevel(OTBR_LOG_EMERG, __VA_ARGS__)
+#define otbrLogAlert(...) otbrLogAtLevel(OTBR_LOG_ALERT, __VA_ARGS__)
+#define otbrLogCrit(...) otbrLogAtLevel(OTBR_LOG_CRIT, __VA_ARGS__)
+#define otbrLogErr(...) otbrLogAtLevel(OTBR_LOG_ERR, __VA_ARGS__)
+#define otbrLogWarning(...) otbrLogAtLevel(OTBR_LOG_WARNING, __VA_ARGS__)
+#define otbrLogNotice(...) otbrLogAtLevel(OTBR_LOG_NOTICE, __VA_ARGS__)
+#define otbrLogInfo(...) otbrLogAtLevel(OTBR_LOG_INFO, __VA_ARGS__)
+#define otbrLogDebug(...) otbrLogAtLevel(OTBR_LOG_DEBUG, __VA_ARGS__)
 
 #endif // OTBR_COMMON_LOGGING_HPP_
@@ -0,0 +1,218 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the mainloop profiler.
+ */
+
+#define OTBR_LOG_TAG "PROF"
+
+#include "common/mainloop_profiler.hpp"
+
+#include <algorithm>
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "common/logging.hpp"
+
+namespace otbr {
+
+// The upper bounds (in microseconds) of the histogram buckets.
+static const int64_t kBucketBounds[] = {100, 500, 1000, 5000, 10000, 50000, 100000, 500000, 1000000, 5000000};
+
+// The default threshold above which a handler is reported as slow.
+static const Milliseconds kDefaultSlowThreshold = Milliseconds(100);
+
+thread_local MainloopProfiler::Section *MainloopProfiler::Section::sCurrent = nullptr;
+
+MainloopProfiler::Site::Site(const char *aName)
+    : mName(aName)
+    , mNext(nullptr)
+    , mCount(0)
+    , mSlowCount(0)
+    , mTotalUs(0)
+    , mMaxUs(0)
+{
+    for (std::atomic<uint64_t> &bucket : mBuckets)
+    {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+
+    MainloopProfiler::Get().Add(*this);
+}
+
+MainloopProfiler::Section::Section(Site &aSite)
+    : mSite(aSite)
+    , mParent(sCurrent)
+    , mStart(Clock::now())
+    , mNested(Microseconds::zero())
+{
+    sCurrent = this;
+}
+
+MainloopProfiler::Section::~Section(void)
+{
+    Microseconds duration = std::chrono::duration_cast<Microseconds>(Clock::now() - mStart);
+
+    sCurrent = mParent;
+
+    if (mParent != nullptr)
+    {
+        mParent->mNested += duration;
+    }
+
+    MainloopProfiler::Get().Record(mSite, duration - mNested);
+}
+
+MainloopProfiler::MainloopProfiler(void)
+    : Metric("otbr_mainloop_handler_duration_seconds", "Time a mainloop handler blocks the mainloop.")
+    , mSites(nullptr)
+    , mSlowThresholdUs(std::chrono::duration_cast<Microseconds>(kDefaultSlowThreshold).count())
+{
+    static_assert(sizeof(kBucketBounds) / sizeof(kBucketBounds[0]) == kBucketCount, "invalid bucket bounds");
+}
+
+MainloopProfiler &MainloopProfiler::Get(void)
+{
+    static MainloopProfiler sProfiler;
+
+    return sProfiler;
+}
+
+void MainloopProfiler::Add(Site &aSite)
+{
+    Site *head = mSites.load(std::memory_order_relaxed);
+
+    // Sites are only ever added, readers walk the list from any snapshot of the head.
+    do
+    {
+        aSite.mNext = head;
+    } while (!mSites.compare_exchange_weak(head, &aSite, std::memory_order_release, std::memory_order_relaxed));
+}
+
+void MainloopProfiler::SetSlowThreshold(Milliseconds aThreshold)
+{
+    mSlowThresholdUs.store(std::chrono::duration_cast<Microseconds>(aThreshold).count(), std::memory_order_relaxed);
+}
+
+void MainloopProfiler::Record(Site &aSite, Microseconds aDuration)
+{
+    uint64_t durationUs  = static_cast<uint64_t>(std::max<int64_t>(aDuration.count(), 0));
+    int64_t  thresholdUs = mSlowThresholdUs.load(std::memory_order_relaxed);
+    uint64_t maxUs       = aSite.mMaxUs.load(std::memory_order_relaxed);
+    uint8_t  index       = 0;
+
+    while (index < kBucketCount && aDuration.count() > kBucketBounds[index])
+    {
+        index++;
+    }
+
+    aSite.mBuckets[index].fetch_add(1, std::memory_order_relaxed);
+    aSite.mCount.fetch_add(1, std::memory_order_relaxed);
+    aSite.mTotalUs.fetch_add(durationUs, std::memory_order_relaxed);
+
+    while (durationUs > maxUs && !aSite.mMaxUs.compare_exchange_weak(maxUs, durationUs, std::memory_order_relaxed))
+    {
+    }
+
+    if (thresholdUs != 0 && aDuration.count() > thresholdUs)
+    {
+        aSite.mSlowCount.fetch_add(1, std::memory_order_relaxed);
+        otbrLogWarning("Slow handler %s blocked the mainloop for %" PRId64 "ms (threshold %" PRId64 "ms)", aSite.mName,
+                       static_cast<int64_t>(aDuration.count() / 1000), thresholdUs / 1000);
+    }
+}
+
+std::vector<MainloopProfiler::HandlerStats> MainloopProfiler::GetStats(void) const
+{
+    std::vector<HandlerStats> stats;
+
+    for (const Site *site = mSites.load(std::memory_order_acquire); site != nullptr; site = site->mNext)
+    {
+        HandlerStats handlerStats;
+
+        handlerStats.mName      = site->mName;
+        handlerStats.mCount     = site->mCount.load(std::memory_order_relaxed);
+        handlerStats.mSlowCount = site->mSlowCount.load(std::memory_order_relaxed);
+        handlerStats.mTotal     = Microseconds(site->mTotalUs.load(std::memory_order_relaxed));
+        handlerStats.mMax       = Microseconds(site->mMaxUs.load(std::memory_order_relaxed));
+        stats.push_back(handlerStats);
+    }
+
+    std::sort(stats.begin(), stats.end(),
+              [](const HandlerStats &aLhs, const HandlerStats &aRhs) { return aLhs.mTotal > aRhs.mTotal; });
+
+    return stats;
+}
+
+void MainloopProfiler::Dump(void) const
+{
+    otbrLogNotice("Mainloop handlers (count, slow, total ms, avg us, max us):");
+
+    for (const HandlerStats &stats : GetStats())
+    {
+        otbrLogNotice("  %-32s %10" PRIu64 " %6" PRIu64 " %10" PRId64 " %8" PRId64 " %8" PRId64, stats.mName,
+                      stats.mCount, stats.mSlowCount, static_cast<int64_t>(stats.mTotal.count() / 1000),
+                      static_cast<int64_t>(stats.mCount == 0 ? 0 : stats.mTotal.count() / stats.mCount),
+                      static_cast<int64_t>(stats.mMax.count()));
+    }
+}
+
+void MainloopProfiler::Serialize(std::string &aOutput) const
+{
+    char line[160];
+
+    SerializeHeader(aOutput, "histogram");
+
+    for (const Site *site = mSites.load(std::memory_order_acquire); site != nullptr; site = site->mNext)
+    {
+        uint64_t cumulative = 0;
+
+        for (uint8_t i = 0; i < kBucketCount; i++)
+        {
+            cumulative += site->mBuckets[i].load(std::memory_order_relaxed);
+            snprintf(line, sizeof(line), "%s_bucket{handler=\"%s\",le=\"%g\"} %" PRIu64 "\n", GetName(), site->mName,
+                     static_cast<double>(kBucketBounds[i]) / 1000000.0, cumulative);
+            aOutput.append(line);
+        }
+
+        cumulative += site->mBuckets[kBucketCount].load(std::memory_order_relaxed);
+        snprintf(line, sizeof(line), "%s_bucket{handler=\"%s\",le=\"+Inf\"} %" PRIu64 "\n", GetName(), site->mName,
+                 cumulative);
+        aOutput.append(line);
+        snprintf(line, sizeof(line), "%s_sum{handler=\"%s\"} %.6f\n", GetName(), site->mName,
+                 static_cast<double>(site->mTotalUs.load(std::memory_order_relaxed)) / 1000000.0);
+        aOutput.append(line);
+        snprintf(line, sizeof(line), "%s_count{handler=\"%s\"} %" PRIu64 "\n", GetName(), site->mName,
+                 site->mCount.load(std::memory_order_relaxed));
+        aOutput.append(line);
+    }
+}
+
+} // namespace otbr
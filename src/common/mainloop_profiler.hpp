@@ -0,0 +1,200 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions of the mainloop profiler.
+ */
+
+#ifndef OTBR_COMMON_MAINLOOP_PROFILER_HPP_
+#define OTBR_COMMON_MAINLOOP_PROFILER_HPP_
+
+#include <openthread-br/config.h>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+
+#include "common/metrics.hpp"
+#include "common/time.hpp"
+
+namespace otbr {
+
+/**
+ * This class measures how long each mainloop handler blocks the mainloop.
+ *
+ * Handlers are identified by a static name. The durations are kept in per-handler histograms exported as the
+ * `otbr_mainloop_handler_duration_seconds` metric, and a warning is logged whenever a single handler runs longer
+ * than the slow threshold.
+ *
+ */
+class MainloopProfiler : public Metrics::Metric
+{
+private:
+    enum : uint8_t
+    {
+        kBucketCount = 10,
+    };
+
+public:
+    /**
+     * This structure represents the statistics of a handler.
+     *
+     */
+    struct HandlerStats
+    {
+        const char * mName;      ///< The handler name.
+        uint64_t     mCount;     ///< The number of times the handler ran.
+        uint64_t     mSlowCount; ///< The number of times the handler exceeded the slow threshold.
+        Microseconds mTotal;     ///< The accumulated running time.
+        Microseconds mMax;       ///< The longest running time.
+    };
+
+    /**
+     * This class holds the statistics of a handler.
+     *
+     * A site is a static object at the code it profiles and registers itself to the profiler on construction, so
+     * recording a run never has to look up the handler.
+     *
+     */
+    class Site
+    {
+    public:
+        /**
+         * The constructor initializes and registers a handler.
+         *
+         * @param[in]  aName  The handler name, MUST be a string literal unique among the handlers.
+         *
+         */
+        explicit Site(const char *aName);
+
+    private:
+        friend class MainloopProfiler;
+
+        const char *          mName;
+        Site *                mNext;
+        std::atomic<uint64_t> mCount;
+        std::atomic<uint64_t> mSlowCount;
+        std::atomic<uint64_t> mTotalUs;
+        std::atomic<uint64_t> mMaxUs;
+        std::atomic<uint64_t> mBuckets[kBucketCount + 1]; // The last bucket is +Inf.
+    };
+
+    /**
+     * This class records the running time of the enclosing scope as a handler.
+     *
+     * Sections may be nested, the time spent in an inner section is only recorded for the inner handler.
+     *
+     */
+    class Section
+    {
+    public:
+        /**
+         * The constructor starts timing a handler.
+         *
+         * @param[in]  aSite  The handler.
+         *
+         */
+        explicit Section(Site &aSite);
+
+        ~Section(void);
+
+    private:
+        Site &       mSite;
+        Section *    mParent;
+        Timepoint    mStart;
+        Microseconds mNested;
+
+        static thread_local Section *sCurrent;
+    };
+
+    /**
+     * This method returns the process-wide mainloop profiler.
+     *
+     * @returns A reference to the mainloop profiler.
+     *
+     */
+    static MainloopProfiler &Get(void);
+
+    /**
+     * This method sets the slow threshold.
+     *
+     * @param[in]  aThreshold  A handler running longer than this is reported, zero disables reporting.
+     *
+     */
+    void SetSlowThreshold(Milliseconds aThreshold);
+
+    /**
+     * This method records one run of a handler.
+     *
+     * @param[in]  aSite      The handler.
+     * @param[in]  aDuration  The running time.
+     *
+     */
+    void Record(Site &aSite, Microseconds aDuration);
+
+    /**
+     * This method returns the statistics of all handlers, longest total running time first.
+     *
+     * @returns The statistics of all handlers.
+     *
+     */
+    std::vector<HandlerStats> GetStats(void) const;
+
+    /**
+     * This method logs the statistics of all handlers.
+     *
+     */
+    void Dump(void) const;
+
+    void Serialize(std::string &aOutput) const override;
+
+private:
+    MainloopProfiler(void);
+
+    void Add(Site &aSite);
+
+    std::atomic<Site *>  mSites;
+    std::atomic<int64_t> mSlowThresholdUs;
+};
+
+} // namespace otbr
+
+/**
+ * This macro profiles the rest of the enclosing scope as a mainloop handler.
+ *
+ * @param[in]  aName  The handler name, MUST be a string literal unique among the handlers.
+ *
+ */
+#define OTBR_PROFILE_SECTION(aName)                              \
+    static otbr::MainloopProfiler::Site _otbrProfileSite(aName); \
+    otbr::MainloopProfiler::Section     _otbrProfileSection(_otbrProfileSite)
+
+#endif // OTBR_COMMON_MAINLOOP_PROFILER_HPP_
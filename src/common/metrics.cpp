@@ -0,0 +1,221 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the in-process metrics registry.
+ */
+
+#include "common/metrics.hpp"
+
+#include <algorithm>
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+namespace otbr {
+namespace Metrics {
+
+namespace {
+
+void AppendFormat(std::string &aOutput, const char *aFormat, ...) __attribute__((format(printf, 2, 3)));
+
+void AppendFormat(std::string &aOutput, const char *aFormat, ...)
+{
+    char    buffer[128];
+    va_list args;
+    int     len;
+
+    va_start(args, aFormat);
+    len = vsnprintf(buffer, sizeof(buffer), aFormat, args);
+    va_end(args);
+
+    if (len > 0)
+    {
+        aOutput.append(buffer, std::min(static_cast<size_t>(len), sizeof(buffer) - 1));
+    }
+}
+
+double ToSeconds(uint64_t aMicroseconds)
+{
+    return static_cast<double>(aMicroseconds) / 1000000.0;
+}
+
+} // namespace
+
+Metric::Metric(const char *aName, const char *aHelp)
+    : mName(aName)
+    , mHelp(aHelp)
+{
+    Registry::Get().Add(*this);
+}
+
+Metric::~Metric(void)
+{
+    Registry::Get().Remove(*this);
+}
+
+void Metric::SerializeHeader(std::string &aOutput, const char *aType) const
+{
+    aOutput.append("# HELP ").append(mName).append(" ").append(mHelp).append("\n");
+    aOutput.append("# TYPE ").append(mName).append(" ").append(aType).append("\n");
+}
+
+Counter::Counter(const char *aName, const char *aHelp)
+    : Metric(aName, aHelp)
+{
+    for (Shard &shard : mShards)
+    {
+        shard.mValue.store(0, std::memory_order_relaxed);
+    }
+}
+
+uint8_t Counter::GetShardIndex(void)
+{
+    static std::atomic<uint8_t> sNextIndex(0);
+    static thread_local uint8_t sIndex = sNextIndex.fetch_add(1, std::memory_order_relaxed) % kShardCount;
+
+    return sIndex;
+}
+
+uint64_t Counter::GetValue(void) const
+{
+    uint64_t value = 0;
+
+    for (const Shard &shard : mShards)
+    {
+        value += shard.mValue.load(std::memory_order_relaxed);
+    }
+
+    return value;
+}
+
+void Counter::Serialize(std::string &aOutput) const
+{
+    SerializeHeader(aOutput, "counter");
+    AppendFormat(aOutput, "%s %" PRIu64 "\n", GetName(), GetValue());
+}
+
+Gauge::Gauge(const char *aName, const char *aHelp)
+    : Metric(aName, aHelp)
+    , mValue(0)
+{
+}
+
+void Gauge::Serialize(std::string &aOutput) const
+{
+    SerializeHeader(aOutput, "gauge");
+    AppendFormat(aOutput, "%s %" PRId64 "\n", GetName(), GetValue());
+}
+
+Histogram::Histogram(const char *aName, const char *aHelp)
+    : Histogram(aName,
+                aHelp,
+                {Microseconds(100), Microseconds(500), Microseconds(1000), Microseconds(5000), Microseconds(10000),
+                 Microseconds(50000), Microseconds(100000), Microseconds(500000), Microseconds(1000000),
+                 Microseconds(5000000)})
+{
+}
+
+Histogram::Histogram(const char *aName, const char *aHelp, std::vector<Microseconds> aBounds)
+    : Metric(aName, aHelp)
+    , mBounds(std::move(aBounds))
+    , mBuckets(new std::atomic<uint64_t>[mBounds.size() + 1])
+    , mCount(0)
+    , mSumUs(0)
+{
+    for (size_t i = 0; i <= mBounds.size(); i++)
+    {
+        mBuckets[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+void Histogram::Observe(Microseconds aDuration)
+{
+    size_t index = std::lower_bound(mBounds.begin(), mBounds.end(), aDuration) - mBounds.begin();
+
+    mBuckets[index].fetch_add(1, std::memory_order_relaxed);
+    mCount.fetch_add(1, std::memory_order_relaxed);
+    mSumUs.fetch_add(static_cast<uint64_t>(std::max<int64_t>(aDuration.count(), 0)), std::memory_order_relaxed);
+}
+
+void Histogram::Serialize(std::string &aOutput) const
+{
+    uint64_t cumulative = 0;
+
+    SerializeHeader(aOutput, "histogram");
+
+    for (size_t i = 0; i < mBounds.size(); i++)
+    {
+        cumulative += mBuckets[i].load(std::memory_order_relaxed);
+        AppendFormat(aOutput, "%s_bucket{le=\"%g\"} %" PRIu64 "\n", GetName(),
+                     ToSeconds(static_cast<uint64_t>(mBounds[i].count())), cumulative);
+    }
+
+    cumulative += mBuckets[mBounds.size()].load(std::memory_order_relaxed);
+    AppendFormat(aOutput, "%s_bucket{le=\"+Inf\"} %" PRIu64 "\n", GetName(), cumulative);
+    AppendFormat(aOutput, "%s_sum %.6f\n", GetName(), ToSeconds(mSumUs.load(std::memory_order_relaxed)));
+    AppendFormat(aOutput, "%s_count %" PRIu64 "\n", GetName(), GetCount());
+}
+
+Registry &Registry::Get(void)
+{
+    static Registry sRegistry;
+
+    return sRegistry;
+}
+
+void Registry::Add(Metric &aMetric)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    mMetrics.push_back(&aMetric);
+}
+
+void Registry::Remove(Metric &aMetric)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    mMetrics.erase(std::remove(mMetrics.begin(), mMetrics.end(), &aMetric), mMetrics.end());
+}
+
+std::string Registry::Serialize(void) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    std::string                 output;
+
+    for (const Metric *metric : mMetrics)
+    {
+        metric->Serialize(output);
+    }
+
+    return output;
+}
+
+} // namespace Metrics
+} // namespace otbr
@@ -0,0 +1,301 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions of the in-process metrics registry.
+ */
+
+#ifndef OTBR_COMMON_METRICS_HPP_
+#define OTBR_COMMON_METRICS_HPP_
+
+#include <openthread-br/config.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+
+#include "common/time.hpp"
+
+namespace otbr {
+namespace Metrics {
+
+/**
+ * This class is the base of all metrics.
+ *
+ * A metric registers itself to the `Registry` on construction and unregisters on destruction, so metrics are
+ * usually defined as static objects next to the code they measure.
+ *
+ */
+class Metric
+{
+public:
+    /**
+     * This method returns the name of this metric.
+     *
+     * @returns The metric name.
+     *
+     */
+    const char *GetName(void) const { return mName; }
+
+    /**
+     * This method appends this metric in the Prometheus text exposition format to @p aOutput.
+     *
+     * @param[inout]  aOutput  The string to append to.
+     *
+     */
+    virtual void Serialize(std::string &aOutput) const = 0;
+
+    virtual ~Metric(void);
+
+protected:
+    Metric(const char *aName, const char *aHelp);
+
+    void SerializeHeader(std::string &aOutput, const char *aType) const;
+
+private:
+    const char *mName;
+    const char *mHelp;
+};
+
+/**
+ * This class implements a monotonically increasing counter.
+ *
+ * The counter is sharded by thread so concurrent increments do not contend on the same cache line.
+ *
+ */
+class Counter : public Metric
+{
+public:
+    /**
+     * The constructor initializes and registers a counter.
+     *
+     * @param[in]  aName  The metric name, MUST be a string literal.
+     * @param[in]  aHelp  The help text, MUST be a string literal.
+     *
+     */
+    Counter(const char *aName, const char *aHelp);
+
+    /**
+     * This method increments the counter.
+     *
+     * @param[in]  aDelta  The value to add.
+     *
+     */
+    void Increment(uint64_t aDelta = 1) { mShards[GetShardIndex()].mValue.fetch_add(aDelta, std::memory_order_relaxed); }
+
+    /**
+     * This method returns the current value of the counter.
+     *
+     * @returns The sum of all shards.
+     *
+     */
+    uint64_t GetValue(void) const;
+
+    void Serialize(std::string &aOutput) const override;
+
+private:
+    enum : uint8_t
+    {
+        kShardCount    = 8,
+        kCacheLineSize = 64,
+    };
+
+    struct Shard
+    {
+        std::atomic<uint64_t> mValue;
+        uint8_t               mPadding[kCacheLineSize - sizeof(std::atomic<uint64_t>)];
+    };
+
+    static uint8_t GetShardIndex(void);
+
+    Shard mShards[kShardCount];
+};
+
+/**
+ * This class implements a gauge that can go up and down.
+ *
+ */
+class Gauge : public Metric
+{
+public:
+    /**
+     * The constructor initializes and registers a gauge.
+     *
+     * @param[in]  aName  The metric name, MUST be a string literal.
+     * @param[in]  aHelp  The help text, MUST be a string literal.
+     *
+     */
+    Gauge(const char *aName, const char *aHelp);
+
+    /**
+     * This method sets the gauge.
+     *
+     * @param[in]  aValue  The new value.
+     *
+     */
+    void Set(int64_t aValue) { mValue.store(aValue, std::memory_order_relaxed); }
+
+    /**
+     * This method adds @p aDelta to the gauge.
+     *
+     * @param[in]  aDelta  The value to add, may be negative.
+     *
+     */
+    void Add(int64_t aDelta) { mValue.fetch_add(aDelta, std::memory_order_relaxed); }
+
+    /**
+     * This method returns the current value of the gauge.
+     *
+     * @returns The current value.
+     *
+     */
+    int64_t GetValue(void) const { return mValue.load(std::memory_order_relaxed); }
+
+    void Serialize(std::string &aOutput) const override;
+
+private:
+    std::atomic<int64_t> mValue;
+};
+
+/**
+ * This class implements a histogram of durations with fixed buckets.
+ *
+ * Durations are exported in seconds as recommended for Prometheus.
+ *
+ */
+class Histogram : public Metric
+{
+public:
+    /**
+     * The constructor initializes and registers a histogram with the default latency buckets.
+     *
+     * The default buckets range from 100 microseconds to 5 seconds.
+     *
+     * @param[in]  aName  The metric name, MUST be a string literal.
+     * @param[in]  aHelp  The help text, MUST be a string literal.
+     *
+     */
+    Histogram(const char *aName, const char *aHelp);
+
+    /**
+     * The constructor initializes and registers a histogram.
+     *
+     * @param[in]  aName    The metric name, MUST be a string literal.
+     * @param[in]  aHelp    The help text, MUST be a string literal.
+     * @param[in]  aBounds  The upper bounds of the buckets in ascending order.
+     *
+     */
+    Histogram(const char *aName, const char *aHelp, std::vector<Microseconds> aBounds);
+
+    /**
+     * This method records a duration.
+     *
+     * @param[in]  aDuration  The duration to record.
+     *
+     */
+    void Observe(Microseconds aDuration);
+
+    /**
+     * This method returns the number of recorded durations.
+     *
+     * @returns The number of recorded durations.
+     *
+     */
+    uint64_t GetCount(void) const { return mCount.load(std::memory_order_relaxed); }
+
+    void Serialize(std::string &aOutput) const override;
+
+private:
+    std::vector<Microseconds>                 mBounds;
+    std::unique_ptr<std::atomic<uint64_t>[]> mBuckets; // One more than `mBounds` for the +Inf bucket.
+    std::atomic<uint64_t>                     mCount;
+    std::atomic<uint64_t>                     mSumUs;
+};
+
+/**
+ * This class records the time from its construction to its destruction into a histogram.
+ *
+ */
+class ScopedTimer
+{
+public:
+    explicit ScopedTimer(Histogram &aHistogram)
+        : mHistogram(aHistogram)
+        , mStart(Clock::now())
+    {
+    }
+
+    ~ScopedTimer(void) { mHistogram.Observe(std::chrono::duration_cast<Microseconds>(Clock::now() - mStart)); }
+
+private:
+    Histogram &mHistogram;
+    Timepoint  mStart;
+};
+
+/**
+ * This class implements the registry of all metrics in the process.
+ *
+ */
+class Registry
+{
+public:
+    /**
+     * This method returns the process-wide registry.
+     *
+     * @returns A reference to the registry.
+     *
+     */
+    static Registry &Get(void);
+
+    /**
+     * This method serializes all registered metrics in the Prometheus text exposition format.
+     *
+     * @returns The serialized metrics.
+     *
+     */
+    std::string Serialize(void) const;
+
+private:
+    friend class Metric;
+
+    void Add(Metric &aMetric);
+    void Remove(Metric &aMetric);
+
+    mutable std::mutex    mMutex;
+    std::vector<Metric *> mMetrics;
+};
+
+} // namespace Metrics
+} // namespace otbr
+
+#endif // OTBR_COMMON_METRICS_HPP_
@@ -0,0 +1,388 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the route table of on-mesh prefixes and external routes.
+ */
+
+#include "common/route_table.hpp"
+
+#include <algorithm>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+static uint8_t GetBit(const Ip6Address &aAddress, uint8_t aIndex)
+{
+    return (aAddress.m8[aIndex / 8] >> (7 - aIndex % 8)) & 1;
+}
+
+static Ip6Prefix MakePrefix(const Ip6Address &aAddress, uint8_t aLength)
+{
+    Ip6Prefix prefix;
+
+    prefix.mPrefix = aAddress;
+    prefix.mLength = aLength;
+
+    for (uint8_t i = 0; i < sizeof(prefix.mPrefix.m8); i++)
+    {
+        if (aLength >= (i + 1) * 8)
+        {
+            continue;
+        }
+
+        prefix.mPrefix.m8[i] &= (aLength <= i * 8) ? 0 : static_cast<uint8_t>(0xff << (8 - aLength % 8));
+    }
+
+    return prefix;
+}
+
+Route::Route(void)
+    : mRloc16(0)
+    , mPreference(0)
+    , mOnMesh(false)
+    , mStable(false)
+    , mLocal(false)
+    , mPreferred(false)
+    , mSlaac(false)
+    , mDhcp(false)
+    , mConfigure(false)
+    , mDefaultRoute(false)
+{
+}
+
+bool Route::operator==(const Route &aOther) const
+{
+    return IsSameEntry(aOther) && mPreference == aOther.mPreference && mStable == aOther.mStable &&
+           mLocal == aOther.mLocal && mPreferred == aOther.mPreferred && mSlaac == aOther.mSlaac &&
+           mDhcp == aOther.mDhcp && mConfigure == aOther.mConfigure && mDefaultRoute == aOther.mDefaultRoute;
+}
+
+RouteTable::RouteTable(void)
+    : mSize(0)
+{
+}
+
+RouteTable::RouteTable(RouteTable &&aOther) noexcept
+    : mRoot(std::move(aOther.mRoot))
+    , mSize(aOther.mSize)
+{
+    aOther.mSize = 0;
+}
+
+RouteTable &RouteTable::operator=(RouteTable &&aOther) noexcept
+{
+    mRoot        = std::move(aOther.mRoot);
+    mSize        = aOther.mSize;
+    aOther.mSize = 0;
+
+    return *this;
+}
+
+RouteTable::~RouteTable(void) = default;
+
+otbrError RouteTable::Add(const Route &aRoute)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    Route     route = aRoute;
+    Node *    node;
+
+    VerifyOrExit(aRoute.mPrefix.mLength <= 128, error = OTBR_ERROR_INVALID_ARGS);
+
+    route.mPrefix = MakePrefix(aRoute.mPrefix.mPrefix, aRoute.mPrefix.mLength);
+    node          = &FindOrCreateNode(route.mPrefix);
+
+    for (Route &existing : node->mRoutes)
+    {
+        if (existing.IsSameEntry(route))
+        {
+            existing = route;
+            ExitNow();
+        }
+    }
+
+    node->mRoutes.push_back(route);
+    mSize++;
+
+exit:
+    return error;
+}
+
+otbrError RouteTable::Remove(const Route &aRoute)
+{
+    otbrError                            error = OTBR_ERROR_NOT_FOUND;
+    Route                                route = aRoute;
+    std::vector<std::unique_ptr<Node> *> path;
+    std::unique_ptr<Node> *              link = &mRoot;
+
+    VerifyOrExit(aRoute.mPrefix.mLength <= 128);
+    route.mPrefix = MakePrefix(aRoute.mPrefix.mPrefix, aRoute.mPrefix.mLength);
+
+    // Remember the path, the nodes on it may become redundant once the route is gone.
+    while (*link != nullptr && (*link)->mPrefix.ContainsPrefix(route.mPrefix))
+    {
+        path.push_back(link);
+
+        if ((*link)->mPrefix.mLength == route.mPrefix.mLength)
+        {
+            break;
+        }
+
+        link = &(*link)->mChildren[GetBit(route.mPrefix.mPrefix, (*link)->mPrefix.mLength)];
+    }
+
+    VerifyOrExit(!path.empty() && (*path.back())->mPrefix.mLength == route.mPrefix.mLength);
+
+    {
+        std::vector<Route> &routes = (*path.back())->mRoutes;
+        auto                it     = std::find_if(routes.begin(), routes.end(),
+                                   [&route](const Route &aExisting) { return aExisting.IsSameEntry(route); });
+
+        VerifyOrExit(it != routes.end());
+        routes.erase(it);
+        mSize--;
+        error = OTBR_ERROR_NONE;
+    }
+
+    // Only the node itself and its parent can be left without routes and with fewer than two children.
+    Prune(*path.back());
+    if (path.size() > 1)
+    {
+        Prune(*path[path.size() - 2]);
+    }
+
+exit:
+    return error;
+}
+
+void RouteTable::Clear(void)
+{
+    mRoot.reset();
+    mSize = 0;
+}
+
+const std::vector<Route> *RouteTable::Find(const Ip6Prefix &aPrefix) const
+{
+    const Node *node = nullptr;
+
+    VerifyOrExit(aPrefix.mLength <= 128);
+    node = FindNode(MakePrefix(aPrefix.mPrefix, aPrefix.mLength));
+
+exit:
+    return node != nullptr ? &node->mRoutes : nullptr;
+}
+
+const Route *RouteTable::Lookup(const Ip6Address &aAddress) const
+{
+    const Node * node = mRoot.get();
+    const Node * best = nullptr;
+    const Route *route = nullptr;
+
+    while (node != nullptr && node->mPrefix.ContainsAddress(aAddress))
+    {
+        if (!node->mRoutes.empty())
+        {
+            best = node;
+        }
+
+        if (node->mPrefix.mLength == 128)
+        {
+            break;
+        }
+
+        node = node->mChildren[GetBit(aAddress, node->mPrefix.mLength)].get();
+    }
+
+    VerifyOrExit(best != nullptr);
+
+    // The destination of an on-mesh prefix is on the Thread network, no external route is needed to reach it.
+    for (const Route &candidate : best->mRoutes)
+    {
+        if (route == nullptr || candidate.mOnMesh > route->mOnMesh ||
+            (candidate.mOnMesh == route->mOnMesh && candidate.mPreference > route->mPreference))
+        {
+            route = &candidate;
+        }
+    }
+
+exit:
+    return route;
+}
+
+std::vector<Route> RouteTable::GetRoutes(void) const
+{
+    std::vector<Route> routes;
+
+    routes.reserve(mSize);
+    CollectRoutes(mRoot.get(), routes);
+
+    return routes;
+}
+
+void RouteTable::Diff(const RouteTable &  aOld,
+                      const RouteTable &  aNew,
+                      std::vector<Route> &aAdded,
+                      std::vector<Route> &aRemoved)
+{
+    auto contains = [](const RouteTable &aTable, const Route &aRoute, bool aExact) {
+        const Node *node  = aTable.FindNode(aRoute.mPrefix);
+        bool        found = false;
+
+        VerifyOrExit(node != nullptr);
+
+        for (const Route &route : node->mRoutes)
+        {
+            if (aExact ? route == aRoute : route.IsSameEntry(aRoute))
+            {
+                ExitNow(found = true);
+            }
+        }
+
+    exit:
+        return found;
+    };
+
+    aAdded.clear();
+    aRemoved.clear();
+
+    for (const Route &route : aNew.GetRoutes())
+    {
+        if (!contains(aOld, route, /* aExact */ true))
+        {
+            aAdded.push_back(route);
+        }
+    }
+
+    for (const Route &route : aOld.GetRoutes())
+    {
+        if (!contains(aNew, route, /* aExact */ false))
+        {
+            aRemoved.push_back(route);
+        }
+    }
+}
+
+RouteTable::Node *RouteTable::FindNode(const Ip6Prefix &aPrefix) const
+{
+    Node *node = mRoot.get();
+
+    while (node != nullptr && node->mPrefix.mLength < aPrefix.mLength && node->mPrefix.ContainsPrefix(aPrefix))
+    {
+        node = node->mChildren[GetBit(aPrefix.mPrefix, node->mPrefix.mLength)].get();
+    }
+
+    if (node != nullptr && !(node->mPrefix == aPrefix))
+    {
+        node = nullptr;
+    }
+
+    return node;
+}
+
+RouteTable::Node &RouteTable::FindOrCreateNode(const Ip6Prefix &aPrefix)
+{
+    std::unique_ptr<Node> *link = &mRoot;
+    Node *                 node;
+
+    while (*link != nullptr)
+    {
+        Node &  current = **link;
+        uint8_t match   = std::min(Ip6Prefix::PrefixMatch(current.mPrefix.mPrefix, aPrefix.mPrefix),
+                                 std::min(current.mPrefix.mLength, aPrefix.mLength));
+
+        if (match == current.mPrefix.mLength)
+        {
+            if (match == aPrefix.mLength)
+            {
+                ExitNow(node = &current);
+            }
+
+            link = &current.mChildren[GetBit(aPrefix.mPrefix, match)];
+            continue;
+        }
+
+        // The prefix and the current node diverge at bit `match`, insert a node for `aPrefix` or for the common
+        // prefix above the current node.
+        {
+            std::unique_ptr<Node> parent(new Node(MakePrefix(aPrefix.mPrefix, match)));
+
+            parent->mChildren[GetBit(current.mPrefix.mPrefix, match)] = std::move(*link);
+
+            if (match == aPrefix.mLength)
+            {
+                node = parent.get();
+            }
+            else
+            {
+                std::unique_ptr<Node> &child = parent->mChildren[GetBit(aPrefix.mPrefix, match)];
+
+                child.reset(new Node(aPrefix));
+                node = child.get();
+            }
+
+            *link = std::move(parent);
+            ExitNow();
+        }
+    }
+
+    link->reset(new Node(aPrefix));
+    node = link->get();
+
+exit:
+    return *node;
+}
+
+void RouteTable::Prune(std::unique_ptr<Node> &aLink)
+{
+    Node *node = aLink.get();
+
+    VerifyOrExit(node != nullptr && node->mRoutes.empty());
+    VerifyOrExit(node->mChildren[0] == nullptr || node->mChildren[1] == nullptr);
+
+    // A node without routes is only needed to branch, so replace it with its only child, if any.
+    aLink = std::move(node->mChildren[node->mChildren[0] != nullptr ? 0 : 1]);
+
+exit:
+    return;
+}
+
+void RouteTable::CollectRoutes(const Node *aNode, std::vector<Route> &aRoutes)
+{
+    VerifyOrExit(aNode != nullptr);
+
+    aRoutes.insert(aRoutes.end(), aNode->mRoutes.begin(), aNode->mRoutes.end());
+    CollectRoutes(aNode->mChildren[0].get(), aRoutes);
+    CollectRoutes(aNode->mChildren[1].get(), aRoutes);
+
+exit:
+    return;
+}
+
+} // namespace otbr
@@ -0,0 +1,244 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the route table of on-mesh prefixes and external routes.
+ */
+
+#ifndef OTBR_COMMON_ROUTE_TABLE_HPP_
+#define OTBR_COMMON_ROUTE_TABLE_HPP_
+
+#include "openthread-br/config.h"
+
+#include <memory>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This structure represents an on-mesh prefix or an external route in the Thread Network Data.
+ *
+ */
+struct Route
+{
+    Ip6Prefix mPrefix;       ///< The IPv6 prefix, bits beyond the prefix length are zero.
+    uint16_t  mRloc16;       ///< The RLOC16 of the Border Router which published the route.
+    int8_t    mPreference;   ///< The preference, -1 (low), 0 (medium) or 1 (high).
+    bool      mOnMesh;       ///< Whether this is an on-mesh prefix, otherwise an external route.
+    bool      mStable;       ///< Whether this is Stable Network Data.
+    bool      mLocal;        ///< Whether this device published the route.
+    bool      mPreferred;    ///< The on-mesh prefix Preferred flag.
+    bool      mSlaac;        ///< The on-mesh prefix SLAAC flag.
+    bool      mDhcp;         ///< The on-mesh prefix DHCP flag.
+    bool      mConfigure;    ///< The on-mesh prefix Configure flag.
+    bool      mDefaultRoute; ///< The on-mesh prefix Default Route flag.
+
+    /**
+     * This constructor initializes an empty route.
+     *
+     */
+    Route(void);
+
+    /**
+     * This method indicates whether two routes are the same entry, i.e. the same kind of route to the same prefix
+     * published by the same Border Router.
+     *
+     * @param[in] aOther  The other route.
+     *
+     * @returns  Whether the routes have the same prefix, kind and RLOC16.
+     *
+     */
+    bool IsSameEntry(const Route &aOther) const
+    {
+        return mPrefix == aOther.mPrefix && mOnMesh == aOther.mOnMesh && mRloc16 == aOther.mRloc16;
+    }
+
+    /**
+     * This method overloads `==` operator and compares all fields of two routes.
+     *
+     * @param[in] aOther  The other route.
+     *
+     * @returns  Whether the routes are equal.
+     *
+     */
+    bool operator==(const Route &aOther) const;
+};
+
+/**
+ * This class implements a route table over IPv6 prefixes.
+ *
+ * Routes are kept in a compressed binary trie keyed by prefix, so a longest prefix match walks at most one node per
+ * prefix bit. Several routes may share a prefix, e.g. when more than one Border Router publishes it.
+ *
+ */
+class RouteTable
+{
+public:
+    /**
+     * This constructor initializes an empty route table.
+     *
+     */
+    RouteTable(void);
+
+    /**
+     * This constructor takes the routes of another route table, which is left empty.
+     *
+     * @param[in] aOther  The other route table.
+     *
+     */
+    RouteTable(RouteTable &&aOther) noexcept;
+
+    /**
+     * This method takes the routes of another route table, which is left empty.
+     *
+     * @param[in] aOther  The other route table.
+     *
+     * @returns A reference to this route table.
+     *
+     */
+    RouteTable &operator=(RouteTable &&aOther) noexcept;
+
+    ~RouteTable(void);
+
+    /**
+     * This method adds a route, or updates it if the same entry already exists.
+     *
+     * The bits of the prefix beyond the prefix length are cleared.
+     *
+     * @param[in] aRoute  The route.
+     *
+     * @retval OTBR_ERROR_NONE          Successfully added or updated the route.
+     * @retval OTBR_ERROR_INVALID_ARGS  The prefix length is larger than 128.
+     *
+     */
+    otbrError Add(const Route &aRoute);
+
+    /**
+     * This method removes a route.
+     *
+     * @param[in] aRoute  The route, only the fields compared by Route::IsSameEntry() are used.
+     *
+     * @retval OTBR_ERROR_NONE       Successfully removed the route.
+     * @retval OTBR_ERROR_NOT_FOUND  There is no such route.
+     *
+     */
+    otbrError Remove(const Route &aRoute);
+
+    /**
+     * This method removes all routes.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method returns the number of routes.
+     *
+     * @returns The number of routes.
+     *
+     */
+    size_t GetSize(void) const { return mSize; }
+
+    /**
+     * This method finds the routes to an exact prefix.
+     *
+     * @param[in] aPrefix  The prefix.
+     *
+     * @returns A pointer to the routes, or nullptr if there is none. The pointer is invalidated by any change to the
+     *          route table.
+     *
+     */
+    const std::vector<Route> *Find(const Ip6Prefix &aPrefix) const;
+
+    /**
+     * This method performs a longest prefix match.
+     *
+     * The longest matching prefix always wins, whatever kind of route it is, so an on-mesh prefix takes precedence
+     * over a shorter external route which covers it. When several routes share the longest matching prefix, an
+     * on-mesh prefix is returned before any external route, and otherwise the route with the highest preference.
+     *
+     * @param[in] aAddress  The destination address.
+     *
+     * @returns A pointer to the best route, or nullptr if no prefix matches. The pointer is invalidated by any change
+     *          to the route table.
+     *
+     */
+    const Route *Lookup(const Ip6Address &aAddress) const;
+
+    /**
+     * This method returns all routes ordered by prefix.
+     *
+     * @returns The routes.
+     *
+     */
+    std::vector<Route> GetRoutes(void) const;
+
+    /**
+     * This function computes the changes from one route table to another.
+     *
+     * @param[in]   aOld      The old route table.
+     * @param[in]   aNew      The new route table.
+     * @param[out]  aAdded    The routes in @p aNew which are not in @p aOld or differ from their entry there.
+     * @param[out]  aRemoved  The routes in @p aOld whose entry is not in @p aNew.
+     *
+     */
+    static void Diff(const RouteTable &  aOld,
+                     const RouteTable &  aNew,
+                     std::vector<Route> &aAdded,
+                     std::vector<Route> &aRemoved);
+
+private:
+    struct Node
+    {
+        explicit Node(const Ip6Prefix &aPrefix)
+            : mPrefix(aPrefix)
+        {
+        }
+
+        Ip6Prefix             mPrefix;
+        std::vector<Route>    mRoutes;
+        std::unique_ptr<Node> mChildren[2];
+    };
+
+    Node *      FindNode(const Ip6Prefix &aPrefix) const;
+    Node &      FindOrCreateNode(const Ip6Prefix &aPrefix);
+    static void Prune(std::unique_ptr<Node> &aLink);
+    static void CollectRoutes(const Node *aNode, std::vector<Route> &aRoutes);
+
+    std::unique_ptr<Node> mRoot;
+    size_t                mSize;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_ROUTE_TABLE_HPP_
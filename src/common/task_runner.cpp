@@ -39,9 +39,14 @@
 #include <unistd.h>
 
 #include "common/code_utils.hpp"
+#include "common/mainloop_profiler.hpp"
+#include "common/metrics.hpp"
 
 namespace otbr {
 
+static Metrics::Gauge   sQueueDepth("otbr_task_runner_queue_depth", "Number of tasks waiting in task runners.");
+static Metrics::Counter sTasksExecuted("otbr_task_runner_tasks_total", "Number of tasks executed by task runners.");
+
 TaskRunner::TaskRunner(void)
     : mTaskQueue(DelayedTask::Comparator{})
 {
@@ -58,6 +63,8 @@ TaskRunner::TaskRunner(void)
 
 TaskRunner::~TaskRunner(void)
 {
+    sQueueDepth.Add(-static_cast<int64_t>(mTaskQueue.size()));
+
     if (mEventFd[kRead] != -1)
     {
         close(mEventFd[kRead]);
@@ -132,6 +139,8 @@ void TaskRunner::PushTask(Milliseconds aDelay, const Task<void> aTask)
     std::lock_guard<std::mutex> _(mTaskQueueMutex);
 
     mTaskQueue.emplace(aDelay, std::move(aTask));
+    sQueueDepth.Add(1);
+
     do
     {
         rval = write(mEventFd[kWrite], &kOne, sizeof(kOne));
@@ -164,6 +173,7 @@ void TaskRunner::PopTasks(void)
             {
                 task = std::move(mTaskQueue.top().mTask);
                 mTaskQueue.pop();
+                sQueueDepth.Add(-1);
             }
             else
             {
@@ -171,7 +181,11 @@ void TaskRunner::PopTasks(void)
             }
         }
 
-        task();
+        {
+            OTBR_PROFILE_SECTION("TaskRunner::Task");
+            task();
+        }
+        sTasksExecuted.Increment();
     }
 }
 
@@ -0,0 +1,321 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the bounds-checked TLV reader and writer.
+ */
+
+#include "common/tlv.hpp"
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+namespace {
+
+enum : uint8_t
+{
+    kLengthEscape = 0xff,
+};
+
+} // namespace
+
+otbrError TlvInfo::ReadUint(uint8_t aSize, uint64_t &aValue) const
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mValue != nullptr && mLength >= aSize, error = OTBR_ERROR_PARSE);
+
+    aValue = 0;
+    for (uint8_t i = 0; i < aSize; i++)
+    {
+        aValue = (aValue << 8) | mValue[i];
+    }
+
+exit:
+    return error;
+}
+
+otbrError TlvInfo::GetUint8(uint8_t &aValue) const
+{
+    uint64_t  value;
+    otbrError error = ReadUint(sizeof(aValue), value);
+
+    if (error == OTBR_ERROR_NONE)
+    {
+        aValue = static_cast<uint8_t>(value);
+    }
+
+    return error;
+}
+
+otbrError TlvInfo::GetUint16(uint16_t &aValue) const
+{
+    uint64_t  value;
+    otbrError error = ReadUint(sizeof(aValue), value);
+
+    if (error == OTBR_ERROR_NONE)
+    {
+        aValue = static_cast<uint16_t>(value);
+    }
+
+    return error;
+}
+
+otbrError TlvInfo::GetUint32(uint32_t &aValue) const
+{
+    uint64_t  value;
+    otbrError error = ReadUint(sizeof(aValue), value);
+
+    if (error == OTBR_ERROR_NONE)
+    {
+        aValue = static_cast<uint32_t>(value);
+    }
+
+    return error;
+}
+
+otbrError TlvInfo::GetUint64(uint64_t &aValue) const
+{
+    return ReadUint(sizeof(aValue), aValue);
+}
+
+size_t TlvReader::Parse(const uint8_t *aBuffer, size_t aLength, TlvInfo &aTlv)
+{
+    size_t   headerSize = 2;
+    uint16_t length;
+
+    VerifyOrExit(aBuffer != nullptr && aLength >= headerSize, headerSize = 0);
+
+    length = aBuffer[1];
+    if (length == kLengthEscape)
+    {
+        headerSize += sizeof(uint16_t);
+        VerifyOrExit(aLength >= headerSize, headerSize = 0);
+        length = static_cast<uint16_t>(aBuffer[2] << 8 | aBuffer[3]);
+    }
+
+    VerifyOrExit(aLength - headerSize >= length, headerSize = 0);
+
+    aTlv.mType   = aBuffer[0];
+    aTlv.mLength = length;
+    aTlv.mValue  = aBuffer + headerSize;
+
+exit:
+    return headerSize == 0 ? 0 : headerSize + length;
+}
+
+TlvReader::Iterator::Iterator(const uint8_t *aCursor, const uint8_t *aEnd)
+    : mCursor(aCursor)
+    , mEnd(aEnd)
+{
+    if (mCursor != nullptr && Parse(mCursor, static_cast<size_t>(mEnd - mCursor), mTlv) == 0)
+    {
+        mCursor = nullptr;
+    }
+}
+
+void TlvReader::Iterator::Advance(void)
+{
+    VerifyOrExit(mCursor != nullptr);
+
+    mCursor = mTlv.GetValue() + mTlv.GetLength();
+
+    if (Parse(mCursor, static_cast<size_t>(mEnd - mCursor), mTlv) == 0)
+    {
+        mCursor = nullptr;
+    }
+
+exit:
+    return;
+}
+
+otbrError TlvReader::Validate(void) const
+{
+    otbrError      error  = OTBR_ERROR_NONE;
+    const uint8_t *cursor = mBuffer;
+    const uint8_t *end    = mBuffer + mLength;
+    TlvInfo        tlv;
+
+    while (cursor != end)
+    {
+        size_t size = Parse(cursor, static_cast<size_t>(end - cursor), tlv);
+
+        VerifyOrExit(size != 0, error = OTBR_ERROR_PARSE);
+        cursor += size;
+    }
+
+exit:
+    return error;
+}
+
+otbrError TlvReader::Find(uint8_t aType, TlvInfo &aTlv) const
+{
+    otbrError      error  = OTBR_ERROR_NOT_FOUND;
+    const uint8_t *cursor = mBuffer;
+    const uint8_t *end    = mBuffer + mLength;
+    TlvInfo        tlv;
+
+    while (cursor != end)
+    {
+        size_t size = Parse(cursor, static_cast<size_t>(end - cursor), tlv);
+
+        VerifyOrExit(size != 0, error = OTBR_ERROR_PARSE);
+
+        if (tlv.GetType() == aType)
+        {
+            aTlv  = tlv;
+            error = OTBR_ERROR_NONE;
+            break;
+        }
+
+        cursor += size;
+    }
+
+exit:
+    return error;
+}
+
+otbrError TlvReader::FindUint8(uint8_t aType, uint8_t &aValue) const
+{
+    TlvInfo   tlv;
+    otbrError error;
+
+    SuccessOrExit(error = Find(aType, tlv));
+    error = tlv.GetUint8(aValue);
+
+exit:
+    return error;
+}
+
+otbrError TlvReader::FindUint16(uint8_t aType, uint16_t &aValue) const
+{
+    TlvInfo   tlv;
+    otbrError error;
+
+    SuccessOrExit(error = Find(aType, tlv));
+    error = tlv.GetUint16(aValue);
+
+exit:
+    return error;
+}
+
+otbrError TlvReader::FindUint32(uint8_t aType, uint32_t &aValue) const
+{
+    TlvInfo   tlv;
+    otbrError error;
+
+    SuccessOrExit(error = Find(aType, tlv));
+    error = tlv.GetUint32(aValue);
+
+exit:
+    return error;
+}
+
+otbrError TlvReader::FindUint64(uint8_t aType, uint64_t &aValue) const
+{
+    TlvInfo   tlv;
+    otbrError error;
+
+    SuccessOrExit(error = Find(aType, tlv));
+    error = tlv.GetUint64(aValue);
+
+exit:
+    return error;
+}
+
+otbrError TlvWriter::Append(uint8_t aType, const void *aValue, uint16_t aLength)
+{
+    otbrError error      = OTBR_ERROR_NONE;
+    size_t    headerSize = aLength >= kLengthEscape ? 4 : 2;
+    uint8_t * cursor;
+
+    VerifyOrExit(aValue != nullptr || aLength == 0, error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(mSize - mLength >= headerSize && mSize - mLength - headerSize >= aLength,
+                 error = OTBR_ERROR_INVALID_ARGS);
+
+    cursor    = mBuffer + mLength;
+    cursor[0] = aType;
+
+    if (headerSize == 2)
+    {
+        cursor[1] = static_cast<uint8_t>(aLength);
+    }
+    else
+    {
+        cursor[1] = kLengthEscape;
+        cursor[2] = static_cast<uint8_t>(aLength >> 8);
+        cursor[3] = static_cast<uint8_t>(aLength & 0xff);
+    }
+
+    if (aLength > 0)
+    {
+        memcpy(cursor + headerSize, aValue, aLength);
+    }
+
+    mLength += headerSize + aLength;
+
+exit:
+    return error;
+}
+
+otbrError TlvWriter::AppendUint(uint8_t aType, uint64_t aValue, uint8_t aSize)
+{
+    uint8_t value[sizeof(uint64_t)];
+
+    for (uint8_t i = aSize; i > 0; i--)
+    {
+        value[i - 1] = static_cast<uint8_t>(aValue & 0xff);
+        aValue >>= 8;
+    }
+
+    return Append(aType, value, aSize);
+}
+
+otbrError TlvWriter::AppendUint8(uint8_t aType, uint8_t aValue)
+{
+    return AppendUint(aType, aValue, sizeof(aValue));
+}
+
+otbrError TlvWriter::AppendUint16(uint8_t aType, uint16_t aValue)
+{
+    return AppendUint(aType, aValue, sizeof(aValue));
+}
+
+otbrError TlvWriter::AppendUint32(uint8_t aType, uint32_t aValue)
+{
+    return AppendUint(aType, aValue, sizeof(aValue));
+}
+
+otbrError TlvWriter::AppendUint64(uint8_t aType, uint64_t aValue)
+{
+    return AppendUint(aType, aValue, sizeof(aValue));
+}
+
+} // namespace otbr
@@ -36,14 +36,22 @@
 
 #include "openthread-br/config.h"
 
+#include <iterator>
+
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
+#include "common/types.hpp"
+
 namespace otbr {
 
 /**
  * This class implements TMF Tlv functionality.
  *
+ * This class is overlaid on a raw buffer and does not check any bounds, so it is only suitable for building TLVs in
+ * buffers known to be large enough. Use TlvReader to parse TLVs from untrusted input.
+ *
  */
 class Tlv
 {
@@ -206,10 +214,308 @@ private:
     uint8_t mLength;
 };
 
+/**
+ * This class represents a TLV which has been validated against the bounds of its buffer.
+ *
+ * The value is not copied and remains valid as long as the underlying buffer does.
+ *
+ */
+class TlvInfo
+{
+public:
+    /**
+     * This constructor initializes an empty TLV.
+     *
+     */
+    TlvInfo(void)
+        : mValue(nullptr)
+        , mLength(0)
+        , mType(0)
+    {
+    }
+
+    /**
+     * This method returns the TLV type.
+     *
+     * @returns The TLV type.
+     *
+     */
+    uint8_t GetType(void) const { return mType; }
+
+    /**
+     * This method returns the TLV value length.
+     *
+     * @returns The TLV value length in bytes.
+     *
+     */
+    uint16_t GetLength(void) const { return mLength; }
+
+    /**
+     * This method returns a pointer to the TLV value.
+     *
+     * @returns A pointer to the first byte of the value.
+     *
+     */
+    const uint8_t *GetValue(void) const { return mValue; }
+
+    /**
+     * This method reads the value as a big-endian unsigned integer.
+     *
+     * Trailing bytes beyond the size of the integer are ignored.
+     *
+     * @param[out]  aValue  A reference to the integer to receive the value.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully read the value.
+     * @retval OTBR_ERROR_PARSE  The value is shorter than the integer.
+     *
+     */
+    otbrError GetUint8(uint8_t &aValue) const;
+    otbrError GetUint16(uint16_t &aValue) const;
+    otbrError GetUint32(uint32_t &aValue) const;
+    otbrError GetUint64(uint64_t &aValue) const;
+
+private:
+    friend class TlvReader;
+
+    otbrError ReadUint(uint8_t aSize, uint64_t &aValue) const;
+
+    const uint8_t *mValue;
+    uint16_t       mLength;
+    uint8_t        mType;
+};
+
+/**
+ * This class parses a sequence of TLVs in place.
+ *
+ * Each TLV header is validated against the remaining length of the buffer before it is exposed, so a truncated or
+ * malformed buffer ends the iteration instead of reading out of bounds. Nothing is allocated or copied.
+ *
+ */
+class TlvReader
+{
+public:
+    /**
+     * This class is a forward iterator over the well-formed TLVs of a TlvReader.
+     *
+     */
+    class Iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef TlvInfo                   value_type;
+        typedef ptrdiff_t                 difference_type;
+        typedef const TlvInfo *           pointer;
+        typedef const TlvInfo &           reference;
+
+        const TlvInfo &operator*(void) const { return mTlv; }
+        const TlvInfo *operator->(void) const { return &mTlv; }
+
+        Iterator &operator++(void)
+        {
+            Advance();
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator prev = *this;
+
+            Advance();
+            return prev;
+        }
+
+        bool operator==(const Iterator &aOther) const { return mCursor == aOther.mCursor; }
+        bool operator!=(const Iterator &aOther) const { return mCursor != aOther.mCursor; }
+
+    private:
+        friend class TlvReader;
+
+        Iterator(const uint8_t *aCursor, const uint8_t *aEnd);
+
+        void Advance(void);
+
+        const uint8_t *mCursor;
+        const uint8_t *mEnd;
+        TlvInfo        mTlv;
+    };
+
+    /**
+     * This constructor initializes the reader over a buffer.
+     *
+     * @param[in]  aBuffer  A pointer to the TLVs.
+     * @param[in]  aLength  The length of @p aBuffer in bytes.
+     *
+     */
+    TlvReader(const void *aBuffer, size_t aLength)
+        : mBuffer(static_cast<const uint8_t *>(aBuffer))
+        , mLength(aBuffer != nullptr ? aLength : 0)
+    {
+    }
+
+    /**
+     * This method returns an iterator to the first TLV.
+     *
+     * @returns An iterator to the first well-formed TLV, or end() if there is none.
+     *
+     */
+    Iterator begin(void) const { return Iterator(mBuffer, mBuffer + mLength); }
+
+    /**
+     * This method returns the past-the-end iterator.
+     *
+     * @returns The past-the-end iterator.
+     *
+     */
+    Iterator end(void) const { return Iterator(nullptr, nullptr); }
+
+    /**
+     * This method checks that the whole buffer is a sequence of well-formed TLVs.
+     *
+     * @retval OTBR_ERROR_NONE   The buffer is well-formed.
+     * @retval OTBR_ERROR_PARSE  A TLV header or value exceeds the buffer.
+     *
+     */
+    otbrError Validate(void) const;
+
+    /**
+     * This method finds the first TLV of a given type.
+     *
+     * @param[in]   aType  The TLV type, e.g. one of the Meshcop TLV types.
+     * @param[out]  aTlv   A reference to the TLV to receive the result.
+     *
+     * @retval OTBR_ERROR_NONE       Found the TLV.
+     * @retval OTBR_ERROR_NOT_FOUND  There is no such TLV.
+     * @retval OTBR_ERROR_PARSE      A malformed TLV was found before a matching one.
+     *
+     */
+    otbrError Find(uint8_t aType, TlvInfo &aTlv) const;
+
+    /**
+     * This method finds the first TLV of a given type and reads its value as a big-endian unsigned integer.
+     *
+     * @param[in]   aType   The TLV type, e.g. one of the Meshcop TLV types.
+     * @param[out]  aValue  A reference to the integer to receive the value.
+     *
+     * @retval OTBR_ERROR_NONE       Successfully read the value.
+     * @retval OTBR_ERROR_NOT_FOUND  There is no such TLV.
+     * @retval OTBR_ERROR_PARSE      The buffer is malformed or the value is shorter than the integer.
+     *
+     */
+    otbrError FindUint8(uint8_t aType, uint8_t &aValue) const;
+    otbrError FindUint16(uint8_t aType, uint16_t &aValue) const;
+    otbrError FindUint32(uint8_t aType, uint32_t &aValue) const;
+    otbrError FindUint64(uint8_t aType, uint64_t &aValue) const;
+
+    /**
+     * This method parses the TLV at the beginning of a buffer.
+     *
+     * @param[in]   aBuffer  A pointer to the buffer.
+     * @param[in]   aLength  The length of @p aBuffer in bytes.
+     * @param[out]  aTlv     A reference to the TLV to receive the result.
+     *
+     * @returns The total size of the TLV including its header, or 0 if the TLV exceeds @p aLength.
+     *
+     */
+    static size_t Parse(const uint8_t *aBuffer, size_t aLength, TlvInfo &aTlv);
+
+private:
+    const uint8_t *mBuffer;
+    size_t         mLength;
+};
+
+/**
+ * This class builds a sequence of TLVs into a fixed buffer.
+ *
+ * Appending never writes past the end of the buffer. A failed append leaves the TLVs written so far untouched.
+ *
+ */
+class TlvWriter
+{
+public:
+    /**
+     * This constructor initializes the writer over a buffer.
+     *
+     * @param[in]  aBuffer  A pointer to the output buffer.
+     * @param[in]  aSize    The size of @p aBuffer in bytes.
+     *
+     */
+    TlvWriter(void *aBuffer, size_t aSize)
+        : mBuffer(static_cast<uint8_t *>(aBuffer))
+        , mSize(aBuffer != nullptr ? aSize : 0)
+        , mLength(0)
+    {
+    }
+
+    /**
+     * This method appends a TLV.
+     *
+     * The extended length format is used for values of 255 bytes or more.
+     *
+     * @param[in]  aType    The TLV type.
+     * @param[in]  aValue   A pointer to the value, may be nullptr if @p aLength is 0.
+     * @param[in]  aLength  The length of the value in bytes.
+     *
+     * @retval OTBR_ERROR_NONE          Successfully appended the TLV.
+     * @retval OTBR_ERROR_INVALID_ARGS  There is not enough space left in the buffer.
+     *
+     */
+    otbrError Append(uint8_t aType, const void *aValue, uint16_t aLength);
+
+    /**
+     * This method appends a TLV whose value is a big-endian unsigned integer.
+     *
+     * @param[in]  aType   The TLV type.
+     * @param[in]  aValue  The value.
+     *
+     * @retval OTBR_ERROR_NONE          Successfully appended the TLV.
+     * @retval OTBR_ERROR_INVALID_ARGS  There is not enough space left in the buffer.
+     *
+     */
+    otbrError AppendUint8(uint8_t aType, uint8_t aValue);
+    otbrError AppendUint16(uint8_t aType, uint16_t aValue);
+    otbrError AppendUint32(uint8_t aType, uint32_t aValue);
+    otbrError AppendUint64(uint8_t aType, uint64_t aValue);
+
+    /**
+     * This method returns the number of bytes written.
+     *
+     * @returns The number of bytes written.
+     *
+     */
+    size_t GetLength(void) const { return mLength; }
+
+    /**
+     * This method returns a reader over the TLVs written so far.
+     *
+     * @returns A reader over the TLVs written so far.
+     *
+     */
+    TlvReader GetReader(void) const { return TlvReader(mBuffer, mLength); }
+
+private:
+    otbrError AppendUint(uint8_t aType, uint64_t aValue, uint8_t aSize);
+
+    uint8_t *mBuffer;
+    size_t   mSize;
+    size_t   mLength;
+};
+
 namespace Meshcop {
 
 enum
 {
+    kChannel                 = 0,
+    kPanId                   = 1,
+    kExtendedPanId           = 2,
+    kNetworkName             = 3,
+    kPskc                    = 4,
+    kNetworkKey              = 5,
+    kMeshLocalPrefix         = 7,
+    kSecurityPolicy          = 12,
+    kActiveTimestamp         = 14,
+    kPendingTimestamp        = 51,
+    kDelayTimer              = 52,
+    kChannelMask             = 53,
     kState                   = 16,
     kCommissionerId          = 10,
     kCommissionerSessionId   = 11,
@@ -27,9 +27,12 @@
  */
 
 #include <arpa/inet.h>
-#include <sstream>
+#include <endian.h>
+#include <stdio.h>
 #include <sys/socket.h>
 
+#include <openthread/ip6.h>
+
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
 #include "common/types.hpp"
@@ -43,12 +46,9 @@ Ip6Address::Ip6Address(const uint8_t (&aAddress)[16])
 
 std::string Ip6Address::ToString() const
 {
-    char strbuf[INET6_ADDRSTRLEN];
-
-    VerifyOrDie(inet_ntop(AF_INET6, this->m8, strbuf, sizeof(strbuf)) != nullptr,
-                "Failed to convert Ip6 address to string");
+    Ip6AddressString str(*this);
 
-    return std::string(strbuf);
+    return std::string(str.AsCString(), str.GetLength());
 }
 
 Ip6Address Ip6Address::ToSolicitedNodeMulticastAddress(void) const
@@ -106,24 +106,150 @@ Ip6Address Ip6Address::FromString(const char *aStr)
 
 void Ip6Prefix::Set(const otIp6Prefix &aPrefix)
 {
-    memcpy(reinterpret_cast<void *>(this), &aPrefix, sizeof(*this));
+    // `Ip6Prefix` is padded to the alignment of `Ip6Address`, so it's larger than `otIp6Prefix`.
+    mPrefix = Ip6Address(aPrefix.mPrefix.mFields.m8);
+    mLength = aPrefix.mLength;
 }
 
 std::string Ip6Prefix::ToString() const
 {
-    std::stringbuf strBuilder;
-    char           strbuf[INET6_ADDRSTRLEN];
+    Ip6AddressString str(mPrefix);
+    char             lengthStr[sizeof("/255")];
+
+    snprintf(lengthStr, sizeof(lengthStr), "/%u", mLength);
+
+    return std::string(str.AsCString(), str.GetLength()) + lengthStr;
+}
+
+uint8_t Ip6Prefix::PrefixMatch(const Ip6Address &aFirst, const Ip6Address &aSecond)
+{
+    uint8_t matched = 0;
+
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        uint64_t diff = be64toh(aFirst.m64[i] ^ aSecond.m64[i]);
+
+        if (diff != 0)
+        {
+            matched += static_cast<uint8_t>(__builtin_clzll(diff));
+            break;
+        }
+
+        matched += 64;
+    }
+
+    return matched;
+}
+
+static char *AppendHex16(char *aCursor, uint16_t aValue)
+{
+    static constexpr char kHexDigits[] = "0123456789abcdef";
+    bool                  started      = false;
+
+    // Leading zeros are omitted, as in inet_ntop().
+    for (int shift = 12; shift >= 0; shift -= 4)
+    {
+        uint8_t digit = (aValue >> shift) & 0xf;
+
+        if (started || digit != 0 || shift == 0)
+        {
+            *aCursor++ = kHexDigits[digit];
+            started    = true;
+        }
+    }
+
+    return aCursor;
+}
+
+static char *AppendDecimal8(char *aCursor, uint8_t aValue)
+{
+    if (aValue >= 100)
+    {
+        *aCursor++ = static_cast<char>('0' + aValue / 100);
+    }
+
+    if (aValue >= 10)
+    {
+        *aCursor++ = static_cast<char>('0' + aValue / 10 % 10);
+    }
+
+    *aCursor++ = static_cast<char>('0' + aValue % 10);
+
+    return aCursor;
+}
+
+Ip6AddressString::Ip6AddressString(const Ip6Address &aAddress)
+{
+    char *  cursor    = mBuffer;
+    uint8_t bestStart = 0;
+    uint8_t bestCount = 0;
+    uint8_t i;
+
+    // Find the longest run of two or more zero groups, the first one on a tie, which is compressed to "::".
+    for (i = 0; i < 8;)
+    {
+        uint8_t count = 0;
+
+        while (i + count < 8 && aAddress.m16[i + count] == 0)
+        {
+            count++;
+        }
+
+        if (count > bestCount)
+        {
+            bestStart = i;
+            bestCount = count;
+        }
+
+        i += (count > 0 ? count : 1);
+    }
+
+    if (bestCount < 2)
+    {
+        bestCount = 0;
+    }
+
+    for (i = 0; i < 8; i++)
+    {
+        if (bestCount > 0 && i == bestStart)
+        {
+            *cursor++ = ':';
+
+            if (bestStart + bestCount == 8)
+            {
+                *cursor++ = ':';
+            }
+
+            i += bestCount - 1;
+            continue;
+        }
+
+        if (i != 0)
+        {
+            *cursor++ = ':';
+        }
+
+        // IPv4-compatible and IPv4-mapped addresses end with a dotted quad.
+        if (i == 6 && bestStart == 0 && (bestCount == 6 || (bestCount == 5 && aAddress.m16[5] == 0xffff)))
+        {
+            for (uint8_t j = 12; j < 16; j++)
+            {
+                if (j != 12)
+                {
+                    *cursor++ = '.';
+                }
 
-    VerifyOrDie(inet_ntop(AF_INET6, mPrefix.m8, strbuf, sizeof(strbuf)) != nullptr,
-                "Failed to convert Ip6 prefix to string");
+                cursor = AppendDecimal8(cursor, aAddress.m8[j]);
+            }
 
-    strBuilder.sputn(strbuf, strlen(strbuf));
-    strBuilder.sputc('/');
+            break;
+        }
 
-    sprintf(strbuf, "%d", mLength);
-    strBuilder.sputn(strbuf, strlen(strbuf));
+        cursor = AppendHex16(cursor, be16toh(aAddress.m16[i]));
+    }
 
-    return strBuilder.str();
+    *cursor = '\0';
+    mLength = static_cast<uint8_t>(cursor - mBuffer);
 }
 
 std::string MacAddress::ToString(void) const
@@ -39,6 +39,7 @@
 #include <netinet/in.h>
 #include <stdint.h>
 #include <string.h>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -297,6 +298,47 @@ private:
     static Ip6Address FromString(const char *aStr);
 };
 
+/**
+ * This class holds the text representation of an IPv6 address in a fixed buffer.
+ *
+ * The text is the same as `inet_ntop()` produces, but is formatted without any heap allocation. This makes it cheap
+ * to format addresses for log arguments, e.g. `Ip6AddressString(address).AsCString()`.
+ *
+ */
+class Ip6AddressString
+{
+public:
+    static constexpr size_t kSize = INET6_ADDRSTRLEN; ///< The buffer size, including the null character.
+
+    /**
+     * This constructor formats an IPv6 address.
+     *
+     * @param[in] aAddress  The IPv6 address.
+     *
+     */
+    explicit Ip6AddressString(const Ip6Address &aAddress);
+
+    /**
+     * This method returns the text as a null-terminated string.
+     *
+     * @returns A pointer to the text, which is valid as long as this object is.
+     *
+     */
+    const char *AsCString(void) const { return mBuffer; }
+
+    /**
+     * This method returns the length of the text.
+     *
+     * @returns The number of characters, excluding the null character.
+     *
+     */
+    size_t GetLength(void) const { return mLength; }
+
+private:
+    char    mBuffer[kSize];
+    uint8_t mLength;
+};
+
 /**
  * This class represents a Ipv6 prefix.
  *
@@ -340,6 +382,54 @@ public:
      */
     bool IsValid(void) const { return mLength > 0 && mLength <= 128; }
 
+    /**
+     * This method indicates whether an IPv6 address matches the Ip6 prefix.
+     *
+     * Only the first `mLength` bits are compared, so the bits of `mPrefix` beyond the prefix length are ignored.
+     *
+     * @param[in] aAddress  The IPv6 address.
+     *
+     * @returns  Whether @p aAddress matches the Ip6 prefix.
+     *
+     */
+    bool ContainsAddress(const Ip6Address &aAddress) const { return PrefixMatch(mPrefix, aAddress) >= mLength; }
+
+    /**
+     * This method indicates whether another Ip6 prefix is the same as or more specific than the Ip6 prefix.
+     *
+     * @param[in] aOther  The other Ip6 prefix.
+     *
+     * @returns  Whether @p aOther lies within the Ip6 prefix.
+     *
+     */
+    bool ContainsPrefix(const Ip6Prefix &aOther) const
+    {
+        return aOther.mLength >= mLength && PrefixMatch(mPrefix, aOther.mPrefix) >= mLength;
+    }
+
+    /**
+     * This method overloads `==` operator and compares the Ip6 prefix with the other prefix.
+     *
+     * Only the first `mLength` bits are compared.
+     *
+     * @param[in] aOther  The other Ip6 prefix.
+     *
+     * @returns  Whether the two Ip6 prefixes have the same length and the same significant bits.
+     *
+     */
+    bool operator==(const Ip6Prefix &aOther) const { return mLength == aOther.mLength && ContainsPrefix(aOther); }
+
+    /**
+     * This function returns the length of the longest common prefix of two IPv6 addresses.
+     *
+     * @param[in] aFirst   The first IPv6 address.
+     * @param[in] aSecond  The second IPv6 address.
+     *
+     * @returns  The number of leading bits in which the addresses agree, from 0 to 128.
+     *
+     */
+    static uint8_t PrefixMatch(const Ip6Address &aFirst, const Ip6Address &aSecond);
+
     Ip6Address mPrefix; ///< The IPv6 prefix.
     uint8_t    mLength; ///< The IPv6 prefix length (in bits).
 };
@@ -378,4 +468,26 @@ public:
 
 } // namespace otbr
 
+namespace std {
+
+/**
+ * This specialization hashes an IPv6 address, so that it can be a key of unordered containers.
+ *
+ */
+template <> struct hash<otbr::Ip6Address>
+{
+    size_t operator()(const otbr::Ip6Address &aAddress) const
+    {
+        // Addresses on a link usually share the prefix, so both halves are mixed into every bit of the result.
+        uint64_t hash = (aAddress.m64[0] * 0x9e3779b97f4a7c15ULL) ^ aAddress.m64[1];
+
+        hash *= 0xff51afd7ed558ccdULL;
+        hash ^= hash >> 33;
+
+        return static_cast<size_t>(hash);
+    }
+};
+
+} // namespace std
+
 #endif // OTBR_COMMON_TYPES_HPP_
@@ -383,6 +383,39 @@ ClientError ThreadApiDBus::RemoveExternalRoute(const Ip6Prefix &aPrefix)
     return CallDBusMethodSync(OTBR_DBUS_REMOVE_EXTERNAL_ROUTE_METHOD, std::tie(aPrefix));
 }
 
+ClientError ThreadApiDBus::LookupRoute(const std::array<uint8_t, OTBR_IP6_ADDRESS_SIZE> &aAddress,
+                                       ExternalRoute &                                   aRoute)
+{
+    auto reply = std::tie(aRoute);
+
+    return CallDBusMethodSync(OTBR_DBUS_LOOKUP_ROUTE_METHOD, std::tie(aAddress), reply);
+}
+
+ClientError ThreadApiDBus::UpdateNetworkData(const std::vector<OnMeshPrefix> & aOnMeshPrefixesToAdd,
+                                             const std::vector<Ip6Prefix> &    aOnMeshPrefixesToRemove,
+                                             const std::vector<ExternalRoute> &aExternalRoutesToAdd,
+                                             const std::vector<Ip6Prefix> &    aExternalRoutesToRemove,
+                                             std::vector<ClientError> &        aResults)
+{
+    std::vector<int32_t> results;
+    auto                 reply = std::tie(results);
+    ClientError          error;
+
+    error = CallDBusMethodSync(
+        OTBR_DBUS_UPDATE_NETWORK_DATA_METHOD,
+        std::tie(aOnMeshPrefixesToAdd, aOnMeshPrefixesToRemove, aExternalRoutesToAdd, aExternalRoutesToRemove), reply);
+    VerifyOrExit(error == ClientError::ERROR_NONE);
+
+    aResults.clear();
+    for (int32_t result : results)
+    {
+        aResults.push_back(static_cast<ClientError>(result));
+    }
+
+exit:
+    return error;
+}
+
 ClientError ThreadApiDBus::SetMeshLocalPrefix(const std::array<uint8_t, OTBR_IP6_PREFIX_SIZE> &aPrefix)
 {
     return SetProperty(OTBR_DBUS_PROPERTY_MESH_LOCAL_PREFIX, aPrefix);
@@ -544,6 +577,11 @@ ClientError ThreadApiDBus::GetExternalRoutes(std::vector<ExternalRoute> &aExtern
     return GetProperty(OTBR_DBUS_PROPERTY_EXTERNAL_ROUTES, aExternalRoutes);
 }
 
+ClientError ThreadApiDBus::GetOnMeshPrefixes(std::vector<OnMeshPrefix> &aOnMeshPrefixes)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_ON_MESH_PREFIXES, aOnMeshPrefixes);
+}
+
 ClientError ThreadApiDBus::GetActiveDatasetTlvs(std::vector<uint8_t> &aDataset)
 {
     return GetProperty(OTBR_DBUS_PROPERTY_ACTIVE_DATASET_TLVS, aDataset);
@@ -622,6 +660,31 @@ exit:
     return ret;
 }
 
+template <typename ArgType, typename ReplyType>
+ClientError ThreadApiDBus::CallDBusMethodSync(const std::string &aMethodName, const ArgType &aArgs, ReplyType &aReply)
+{
+    ClientError             ret = ClientError::ERROR_NONE;
+    DBus::UniqueDBusMessage message(dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
+                                                                 (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
+                                                                 OTBR_DBUS_THREAD_INTERFACE, aMethodName.c_str()));
+    DBus::UniqueDBusMessage reply = nullptr;
+    DBusError               error;
+
+    dbus_error_init(&error);
+    VerifyOrExit(message != nullptr, ret = ClientError::ERROR_DBUS);
+    VerifyOrExit(otbr::DBus::TupleToDBusMessage(*message, aArgs) == OTBR_ERROR_NONE, ret = ClientError::ERROR_DBUS);
+    reply = DBus::UniqueDBusMessage(
+        dbus_connection_send_with_reply_and_block(mConnection, message.get(), DBUS_TIMEOUT_USE_DEFAULT, &error));
+    VerifyOrExit(!dbus_error_is_set(&error), ret = DBus::ConvertFromDBusErrorName(error.message));
+    VerifyOrExit(reply != nullptr, ret = ClientError::ERROR_DBUS);
+    ret = DBus::CheckErrorMessage(reply.get());
+    VerifyOrExit(ret == ClientError::ERROR_NONE);
+    VerifyOrExit(otbr::DBus::DBusMessageToTuple(*reply, aReply) == OTBR_ERROR_NONE, ret = ClientError::ERROR_DBUS);
+exit:
+    dbus_error_free(&error);
+    return ret;
+}
+
 template <typename ArgType>
 ClientError ThreadApiDBus::CallDBusMethodAsync(const std::string &           aMethodName,
                                                const ArgType &               aArgs,
@@ -160,6 +160,10 @@ public:
     /**
      * This method performs a soft reset.
      *
+     * Only the OpenThread instance is restarted, the agent stays on the bus and keeps its mDNS registrations while
+     * Thread comes back up. When the agent runs with warm reset enabled, resets requested by OpenThread also restart
+     * only the instance, so the agent no longer leaves and rejoins the bus on them.
+     *
      * @retval ERROR_NONE successfully performed the dbus function call
      * @retval ERROR_DBUS dbus encode/decode error
      * @retval ...        OpenThread defined error value otherwise
@@ -251,6 +255,42 @@ public:
      */
     ClientError RemoveExternalRoute(const Ip6Prefix &aPrefix);
 
+    /**
+     * This method looks up the longest matching on-mesh prefix or external route of an address.
+     *
+     * @param[in]   aAddress    The IPv6 address.
+     * @param[out]  aRoute      The matching route.
+     *
+     * @retval ERROR_NONE         successfully performed the dbus function call
+     * @retval ERROR_DBUS         dbus encode/decode error
+     * @retval OT_ERROR_NOT_FOUND no route matches the address
+     * @retval ...                OpenThread defined error value otherwise
+     *
+     */
+    ClientError LookupRoute(const std::array<uint8_t, OTBR_IP6_ADDRESS_SIZE> &aAddress, ExternalRoute &aRoute);
+
+    /**
+     * This method applies a batch of network data edits as a single transaction.
+     *
+     * Either all edits are applied and registered to the leader once, or none is applied.
+     *
+     * @param[in]   aOnMeshPrefixesToAdd      The on-mesh prefixes to add.
+     * @param[in]   aOnMeshPrefixesToRemove   The on-mesh prefixes to remove.
+     * @param[in]   aExternalRoutesToAdd      The external routes to add.
+     * @param[in]   aExternalRoutesToRemove   The external routes to remove.
+     * @param[out]  aResults                  The result of each edit, in the order of the arguments above.
+     *
+     * @retval ERROR_NONE         successfully performed the dbus function call
+     * @retval ERROR_DBUS         dbus encode/decode error
+     * @retval ...                OpenThread defined error value otherwise
+     *
+     */
+    ClientError UpdateNetworkData(const std::vector<OnMeshPrefix> & aOnMeshPrefixesToAdd,
+                                  const std::vector<Ip6Prefix> &    aOnMeshPrefixesToRemove,
+                                  const std::vector<ExternalRoute> &aExternalRoutesToAdd,
+                                  const std::vector<Ip6Prefix> &    aExternalRoutesToRemove,
+                                  std::vector<ClientError> &        aResults);
+
     /**
      * This method sets the mesh-local prefix.
      *
@@ -624,6 +664,18 @@ public:
      */
     ClientError GetExternalRoutes(std::vector<ExternalRoute> &aExternalRoutes);
 
+    /**
+     * This method gets the on-mesh prefixes, including the local ones that are not registered with the leader yet.
+     *
+     * @param[out]  aOnMeshPrefixes   The on-mesh prefixes
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetOnMeshPrefixes(std::vector<OnMeshPrefix> &aOnMeshPrefixes);
+
     /**
      * This method gets the active operational dataset
      *
@@ -662,6 +714,9 @@ private:
 
     template <typename ArgType> ClientError CallDBusMethodSync(const std::string &aMethodName, const ArgType &aArgs);
 
+    template <typename ArgType, typename ReplyType>
+    ClientError CallDBusMethodSync(const std::string &aMethodName, const ArgType &aArgs, ReplyType &aReply);
+
     template <typename ArgType>
     ClientError CallDBusMethodAsync(const std::string &           aMethodName,
                                     const ArgType &               aArgs,
@@ -56,6 +56,8 @@
 #define OTBR_DBUS_JOINER_STOP_METHOD "JoinerStop"
 #define OTBR_DBUS_ADD_EXTERNAL_ROUTE_METHOD "AddExternalRoute"
 #define OTBR_DBUS_REMOVE_EXTERNAL_ROUTE_METHOD "RemoveExternalRoute"
+#define OTBR_DBUS_LOOKUP_ROUTE_METHOD "LookupRoute"
+#define OTBR_DBUS_UPDATE_NETWORK_DATA_METHOD "UpdateNetworkData"
 
 #define OTBR_DBUS_PROPERTY_MESH_LOCAL_PREFIX "MeshLocalPrefix"
 #define OTBR_DBUS_PROPERTY_LEGACY_ULA_PREFIX "LegacyULAPrefix"
@@ -85,6 +87,7 @@
 #define OTBR_DBUS_PROPERTY_INSTANT_RSSI "InstantRssi"
 #define OTBR_DBUS_PROPERTY_RADIO_TX_POWER "RadioTxPower"
 #define OTBR_DBUS_PROPERTY_EXTERNAL_ROUTES "ExternalRoutes"
+#define OTBR_DBUS_PROPERTY_ON_MESH_PREFIXES "OnMeshPrefixes"
 #define OTBR_DBUS_PROPERTY_ACTIVE_DATASET_TLVS "ActiveDatasetTlvs"
 #define OTBR_DBUS_PROPERTY_RADIO_REGION "RadioRegion"
 
@@ -124,6 +124,18 @@ template <> struct DBusTypeTrait<std::vector<ExternalRoute>>
     static constexpr const char *TYPE_AS_STRING = "a((ayy)qybb)";
 };
 
+template <> struct DBusTypeTrait<OnMeshPrefix>
+{
+    // struct of {{array of bytes, byte}, byte, {bool, bool, bool, bool, bool, bool, bool}}
+    static constexpr const char *TYPE_AS_STRING = "((ayy)y(bbbbbbb))";
+};
+
+template <> struct DBusTypeTrait<std::vector<OnMeshPrefix>>
+{
+    // array of {{array of bytes, byte}, byte, {bool, bool, bool, bool, bool, bool, bool}}
+    static constexpr const char *TYPE_AS_STRING = "a((ayy)y(bbbbbbb))";
+};
+
 template <> struct DBusTypeTrait<LeaderData>
 {
     // struct of { uint32, byte, byte, byte, byte }
@@ -35,6 +35,7 @@
 #include <dbus/dbus.h>
 
 #include "common/logging.hpp"
+#include "common/metrics.hpp"
 #include "dbus/common/dbus_message_dump.hpp"
 #include "dbus/server/dbus_object.hpp"
 
@@ -43,6 +44,10 @@ using std::placeholders::_1;
 namespace otbr {
 namespace DBus {
 
+static Metrics::Counter   sMethodCalls("otbr_dbus_method_calls_total", "Number of D-Bus method calls handled.");
+static Metrics::Histogram sMethodCallDuration("otbr_dbus_method_call_duration_seconds",
+                                              "Time spent handling a D-Bus method call.");
+
 DBusObject::DBusObject(DBusConnection *aConnection, const std::string &aObjectPath)
     : mConnection(aConnection)
     , mObjectPath(aObjectPath)
@@ -115,7 +120,10 @@ DBusHandlerResult DBusObject::MessageHandler(DBusConnection *aConnection, DBusMe
 
     if (dbus_message_get_type(aMessage) == DBUS_MESSAGE_TYPE_METHOD_CALL && iter != mMethodHandlers.end())
     {
+        Metrics::ScopedTimer timer(sMethodCallDuration);
+
         otbrLogInfo("Handling method %s", memberName.c_str());
+        sMethodCalls.Increment();
         if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
         {
             DumpDBusMessage(*aMessage);
@@ -29,6 +29,8 @@
 #include <assert.h>
 #include <string.h>
 
+#include <algorithm>
+
 #include <openthread/border_router.h>
 #include <openthread/channel_monitor.h>
 #include <openthread/instance.h>
@@ -51,6 +53,95 @@
 using std::placeholders::_1;
 using std::placeholders::_2;
 
+static otbr::DBus::Ip6Prefix ConvertPrefix(const otbr::Ip6Prefix &aPrefix)
+{
+    otbr::DBus::Ip6Prefix prefix;
+    size_t                size;
+
+    // Prefixes are sent in OTBR_IP6_PREFIX_SIZE bytes, unless they are longer than that.
+    size           = std::max<size_t>(OTBR_IP6_PREFIX_SIZE, (aPrefix.mLength + 7) / 8);
+    prefix.mPrefix = std::vector<uint8_t>(aPrefix.mPrefix.m8, aPrefix.mPrefix.m8 + size);
+    prefix.mLength = aPrefix.mLength;
+
+    return prefix;
+}
+
+static otbr::DBus::ExternalRoute ConvertExternalRoute(const otbr::Route &aRoute)
+{
+    otbr::DBus::ExternalRoute route;
+
+    route.mPrefix              = ConvertPrefix(aRoute.mPrefix);
+    route.mRloc16              = aRoute.mRloc16;
+    route.mPreference          = aRoute.mPreference;
+    route.mStable              = aRoute.mStable;
+    route.mNextHopIsThisDevice = aRoute.mLocal;
+
+    return route;
+}
+
+static otbr::DBus::OnMeshPrefix ConvertOnMeshPrefix(const otbr::Route &aRoute)
+{
+    otbr::DBus::OnMeshPrefix prefix;
+
+    prefix.mPrefix       = ConvertPrefix(aRoute.mPrefix);
+    prefix.mPreference   = aRoute.mPreference;
+    prefix.mPreferred    = aRoute.mPreferred;
+    prefix.mSlaac        = aRoute.mSlaac;
+    prefix.mDhcp         = aRoute.mDhcp;
+    prefix.mConfigure    = aRoute.mConfigure;
+    prefix.mDefaultRoute = aRoute.mDefaultRoute;
+    prefix.mOnMesh       = aRoute.mOnMesh;
+    prefix.mStable       = aRoute.mStable;
+
+    return prefix;
+}
+
+static otError ConvertPrefix(const otbr::DBus::Ip6Prefix &aPrefix, otIp6Prefix &aOtPrefix)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(aPrefix.mPrefix.size() <= sizeof(aOtPrefix.mPrefix.mFields.m8), error = OT_ERROR_INVALID_ARGS);
+
+    memset(&aOtPrefix, 0, sizeof(aOtPrefix));
+    std::copy(aPrefix.mPrefix.begin(), aPrefix.mPrefix.end(), &aOtPrefix.mPrefix.mFields.m8[0]);
+    aOtPrefix.mLength = aPrefix.mLength;
+
+exit:
+    return error;
+}
+
+static otError ConvertOnMeshPrefix(const otbr::DBus::OnMeshPrefix &aPrefix, otBorderRouterConfig &aConfig)
+{
+    otError error;
+
+    memset(&aConfig, 0, sizeof(aConfig));
+    SuccessOrExit(error = ConvertPrefix(aPrefix.mPrefix, aConfig.mPrefix));
+    aConfig.mPreference   = aPrefix.mPreference;
+    aConfig.mPreferred    = aPrefix.mPreferred;
+    aConfig.mSlaac        = aPrefix.mSlaac;
+    aConfig.mDhcp         = aPrefix.mDhcp;
+    aConfig.mConfigure    = aPrefix.mConfigure;
+    aConfig.mDefaultRoute = aPrefix.mDefaultRoute;
+    aConfig.mOnMesh       = aPrefix.mOnMesh;
+    aConfig.mStable       = aPrefix.mStable;
+
+exit:
+    return error;
+}
+
+static otError ConvertExternalRoute(const otbr::DBus::ExternalRoute &aRoute, otExternalRouteConfig &aConfig)
+{
+    otError error;
+
+    memset(&aConfig, 0, sizeof(aConfig));
+    SuccessOrExit(error = ConvertPrefix(aRoute.mPrefix, aConfig.mPrefix));
+    aConfig.mPreference = aRoute.mPreference;
+    aConfig.mStable     = aRoute.mStable;
+
+exit:
+    return error;
+}
+
 static std::string GetDeviceRoleName(otDeviceRole aRole)
 {
     std::string roleName;
@@ -131,6 +222,10 @@ otbrError DBusThreadObject::Init(void)
                    std::bind(&DBusThreadObject::AddExternalRouteHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_REMOVE_EXTERNAL_ROUTE_METHOD,
                    std::bind(&DBusThreadObject::RemoveExternalRouteHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_LOOKUP_ROUTE_METHOD,
+                   std::bind(&DBusThreadObject::LookupRouteHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_UPDATE_NETWORK_DATA_METHOD,
+                   std::bind(&DBusThreadObject::UpdateNetworkDataHandler, this, _1));
 
     RegisterMethod(DBUS_INTERFACE_INTROSPECTABLE, DBUS_INTROSPECT_METHOD,
                    std::bind(&DBusThreadObject::IntrospectHandler, this, _1));
@@ -199,6 +294,8 @@ otbrError DBusThreadObject::Init(void)
                                std::bind(&DBusThreadObject::GetRadioTxPowerHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_EXTERNAL_ROUTES,
                                std::bind(&DBusThreadObject::GetExternalRoutesHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_ON_MESH_PREFIXES,
+                               std::bind(&DBusThreadObject::GetOnMeshPrefixesHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_ACTIVE_DATASET_TLVS,
                                std::bind(&DBusThreadObject::GetActiveDatasetTlvsHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_RADIO_REGION,
@@ -367,21 +464,11 @@ void DBusThreadObject::AddOnMeshPrefixHandler(DBusRequest &aRequest)
     otBorderRouterConfig config;
 
     VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
-
-    // size is guaranteed by parsing
-    std::copy(onMeshPrefix.mPrefix.mPrefix.begin(), onMeshPrefix.mPrefix.mPrefix.end(),
-              &config.mPrefix.mPrefix.mFields.m8[0]);
-    config.mPrefix.mLength = onMeshPrefix.mPrefix.mLength;
-    config.mPreference     = onMeshPrefix.mPreference;
-    config.mSlaac          = onMeshPrefix.mSlaac;
-    config.mDhcp           = onMeshPrefix.mDhcp;
-    config.mConfigure      = onMeshPrefix.mConfigure;
-    config.mDefaultRoute   = onMeshPrefix.mDefaultRoute;
-    config.mOnMesh         = onMeshPrefix.mOnMesh;
-    config.mStable         = onMeshPrefix.mStable;
+    SuccessOrExit(error = ConvertOnMeshPrefix(onMeshPrefix, config));
 
     SuccessOrExit(error = otBorderRouterAddOnMeshPrefix(threadHelper->GetInstance(), &config));
     SuccessOrExit(error = otBorderRouterRegister(threadHelper->GetInstance()));
+    mNcp->GetRouteManager().Refresh();
 
 exit:
     aRequest.ReplyOtResult(error);
@@ -396,12 +483,11 @@ void DBusThreadObject::RemoveOnMeshPrefixHandler(DBusRequest &aRequest)
     otIp6Prefix prefix;
 
     VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
-    // size is guaranteed by parsing
-    std::copy(onMeshPrefix.mPrefix.begin(), onMeshPrefix.mPrefix.end(), &prefix.mPrefix.mFields.m8[0]);
-    prefix.mLength = onMeshPrefix.mLength;
+    SuccessOrExit(error = ConvertPrefix(onMeshPrefix, prefix));
 
     SuccessOrExit(error = otBorderRouterRemoveOnMeshPrefix(threadHelper->GetInstance(), &prefix));
     SuccessOrExit(error = otBorderRouterRegister(threadHelper->GetInstance()));
+    mNcp->GetRouteManager().Refresh();
 
 exit:
     aRequest.ReplyOtResult(error);
@@ -414,21 +500,16 @@ void DBusThreadObject::AddExternalRouteHandler(DBusRequest &aRequest)
     auto                  args  = std::tie(route);
     otError               error = OT_ERROR_NONE;
     otExternalRouteConfig otRoute;
-    otIp6Prefix &         prefix = otRoute.mPrefix;
 
     VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
-
-    // size is guaranteed by parsing
-    std::copy(route.mPrefix.mPrefix.begin(), route.mPrefix.mPrefix.end(), &prefix.mPrefix.mFields.m8[0]);
-    prefix.mLength      = route.mPrefix.mLength;
-    otRoute.mPreference = route.mPreference;
-    otRoute.mStable     = route.mStable;
+    SuccessOrExit(error = ConvertExternalRoute(route, otRoute));
 
     SuccessOrExit(error = otBorderRouterAddRoute(threadHelper->GetInstance(), &otRoute));
     if (route.mStable)
     {
         SuccessOrExit(error = otBorderRouterRegister(threadHelper->GetInstance()));
     }
+    mNcp->GetRouteManager().Refresh();
 
 exit:
     aRequest.ReplyOtResult(error);
@@ -443,18 +524,100 @@ void DBusThreadObject::RemoveExternalRouteHandler(DBusRequest &aRequest)
     otIp6Prefix prefix;
 
     VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
-
-    // size is guaranteed by parsing
-    std::copy(routePrefix.mPrefix.begin(), routePrefix.mPrefix.end(), &prefix.mPrefix.mFields.m8[0]);
-    prefix.mLength = routePrefix.mLength;
+    SuccessOrExit(error = ConvertPrefix(routePrefix, prefix));
 
     SuccessOrExit(error = otBorderRouterRemoveRoute(threadHelper->GetInstance(), &prefix));
     SuccessOrExit(error = otBorderRouterRegister(threadHelper->GetInstance()));
+    mNcp->GetRouteManager().Refresh();
 
 exit:
     aRequest.ReplyOtResult(error);
 }
 
+void DBusThreadObject::UpdateNetworkDataHandler(DBusRequest &aRequest)
+{
+    std::vector<OnMeshPrefix>       onMeshPrefixesToAdd;
+    std::vector<Ip6Prefix>          onMeshPrefixesToRemove;
+    std::vector<ExternalRoute>      externalRoutesToAdd;
+    std::vector<Ip6Prefix>          externalRoutesToRemove;
+    RouteManager::NetworkDataUpdate update;
+    std::vector<otError>            results;
+    std::vector<int32_t>            replyResults;
+    otError                         error = OT_ERROR_NONE;
+
+    auto args = std::tie(onMeshPrefixesToAdd, onMeshPrefixesToRemove, externalRoutesToAdd, externalRoutesToRemove);
+
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+    update.mOnMeshPrefixesToAdd.resize(onMeshPrefixesToAdd.size());
+    for (size_t i = 0; i < onMeshPrefixesToAdd.size(); i++)
+    {
+        SuccessOrExit(error = ConvertOnMeshPrefix(onMeshPrefixesToAdd[i], update.mOnMeshPrefixesToAdd[i]));
+    }
+
+    update.mOnMeshPrefixesToRemove.resize(onMeshPrefixesToRemove.size());
+    for (size_t i = 0; i < onMeshPrefixesToRemove.size(); i++)
+    {
+        SuccessOrExit(error = ConvertPrefix(onMeshPrefixesToRemove[i], update.mOnMeshPrefixesToRemove[i]));
+    }
+
+    update.mExternalRoutesToAdd.resize(externalRoutesToAdd.size());
+    for (size_t i = 0; i < externalRoutesToAdd.size(); i++)
+    {
+        SuccessOrExit(error = ConvertExternalRoute(externalRoutesToAdd[i], update.mExternalRoutesToAdd[i]));
+    }
+
+    update.mExternalRoutesToRemove.resize(externalRoutesToRemove.size());
+    for (size_t i = 0; i < externalRoutesToRemove.size(); i++)
+    {
+        SuccessOrExit(error = ConvertPrefix(externalRoutesToRemove[i], update.mExternalRoutesToRemove[i]));
+    }
+
+    // Per-entry results are returned even when the transaction is rolled back.
+    mNcp->GetRouteManager().UpdateNetworkData(update, results);
+
+    for (otError result : results)
+    {
+        replyResults.push_back(static_cast<int32_t>(result));
+    }
+
+exit:
+    if (error == OT_ERROR_NONE)
+    {
+        aRequest.Reply(std::tie(replyResults));
+    }
+    else
+    {
+        aRequest.ReplyOtResult(error);
+    }
+}
+
+void DBusThreadObject::LookupRouteHandler(DBusRequest &aRequest)
+{
+    std::vector<uint8_t> addressBytes;
+    auto                 args  = std::tie(addressBytes);
+    otError              error = OT_ERROR_NONE;
+    Ip6Address           address;
+    const Route *        route;
+    ExternalRoute        externalRoute;
+
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(addressBytes.size() == sizeof(address.m8), error = OT_ERROR_INVALID_ARGS);
+    std::copy(addressBytes.begin(), addressBytes.end(), address.m8);
+
+    route = mNcp->GetRouteManager().GetRouteTable().Lookup(address);
+    VerifyOrExit(route != nullptr, error = OT_ERROR_NOT_FOUND);
+
+    externalRoute = ConvertExternalRoute(*route);
+    aRequest.Reply(std::tie(externalRoute));
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        aRequest.ReplyOtResult(error);
+    }
+}
+
 void DBusThreadObject::IntrospectHandler(DBusRequest &aRequest)
 {
     std::string xmlString(
@@ -964,6 +1127,8 @@ otError DBusThreadObject::GetExternalRoutesHandler(DBusMessageIter &aIter)
     otExternalRouteConfig      config;
     std::vector<ExternalRoute> externalRouteTable;
 
+    // Only lists the routes in the leader's network data, unlike the route table which also has the local routes
+    // that are not registered yet.
     while (otNetDataGetNextRoute(threadHelper->GetInstance(), &iter, &config) == OT_ERROR_NONE)
     {
         ExternalRoute route;
@@ -985,6 +1150,25 @@ exit:
     return error;
 }
 
+otError DBusThreadObject::GetOnMeshPrefixesHandler(DBusMessageIter &aIter)
+{
+    otError                   error = OT_ERROR_NONE;
+    std::vector<OnMeshPrefix> onMeshPrefixes;
+
+    for (const Route &route : mNcp->GetRouteManager().GetRouteTable().GetRoutes())
+    {
+        if (route.mOnMesh)
+        {
+            onMeshPrefixes.push_back(ConvertOnMeshPrefix(route));
+        }
+    }
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, onMeshPrefixes) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
 otError DBusThreadObject::SetActiveDatasetTlvsHandler(DBusMessageIter &aIter)
 {
     auto                     threadHelper = mNcp->GetThreadHelper();
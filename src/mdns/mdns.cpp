@@ -31,9 +31,13 @@
  *   This file includes implementation of mDNS publisher.
  */
 
+#define OTBR_LOG_TAG "MDNS"
+
 #include "mdns/mdns.hpp"
 
 #include "common/code_utils.hpp"
+#include "common/dns_utils.hpp"
+#include "common/logging.hpp"
 
 namespace otbr {
 
@@ -91,6 +95,43 @@ exit:
     return error;
 }
 
+bool Publisher::ResolveConflict(const std::string &aName,
+                                const char *       aType,
+                                uint8_t &          aRenameCount,
+                                std::string &      aNewName)
+{
+    bool rename = mConflictPolicy == ConflictPolicy::kRename && aRenameCount < kMaxRenameCount;
+
+    if (rename)
+    {
+        ++aRenameCount;
+        aNewName = aType == nullptr ? MakeAlternativeHostName(aName, aRenameCount)
+                                    : MakeAlternativeServiceName(aName, aRenameCount);
+    }
+
+    NotifyConflict(aName.c_str(), aType, rename ? aNewName.c_str() : nullptr);
+
+    return rename;
+}
+
+void Publisher::NotifyConflict(const char *aName, const char *aType, const char *aNewName)
+{
+    if (aNewName != nullptr)
+    {
+        otbrLogNotice("Name conflict for %s%s%s, renamed to %s", aName, aType == nullptr ? "" : ".",
+                      aType == nullptr ? "" : aType, aNewName);
+    }
+    else
+    {
+        otbrLogWarning("Name conflict for %s%s%s", aName, aType == nullptr ? "" : ".", aType == nullptr ? "" : aType);
+    }
+
+    if (mConflictHandler != nullptr)
+    {
+        mConflictHandler(aName, aType, aNewName, mConflictHandlerContext);
+    }
+}
+
 } // namespace Mdns
 
 } // namespace otbr
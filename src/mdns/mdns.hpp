@@ -102,13 +102,15 @@ public:
          *
          */
         DiscoveredInstanceInfo(void)
-            : mPort(0)
+            : mRemoved(false)
+            , mPort(0)
             , mPriority(0)
             , mWeight(0)
             , mTtl(0)
         {
         }
 
+        bool                    mRemoved;   ///< Whether the instance has been removed (only `mName` is valid).
         std::string             mName;      ///< Instance name.
         std::string             mHostName;  ///< Full host name.
         std::vector<Ip6Address> mAddresses; ///< IPv6 addresses.
@@ -193,6 +195,29 @@ public:
      */
     typedef void (*PublishHostHandler)(const char *aName, otbrError aError, void *aContext);
 
+    /**
+     * This enumeration represents how a name conflict of a published host or service is handled.
+     *
+     */
+    enum class ConflictPolicy : uint8_t
+    {
+        kReport, ///< Withdraw the registration and report `OTBR_ERROR_DUPLICATED`.
+        kRename, ///< Rename to a deterministic alternative name and keep the registration.
+    };
+
+    /**
+     * This method reports a name conflict of a published host or service.
+     *
+     * It is called as soon as the conflict is detected, e.g. while probing, before the publication result is reported.
+     *
+     * @param[in]  aName     The requested host or service instance name.
+     * @param[in]  aType     The service type, or nullptr for a host.
+     * @param[in]  aNewName  The alternative name now being published, or nullptr if the registration is withdrawn.
+     * @param[in]  aContext  A user context.
+     *
+     */
+    typedef void (*ConflictHandler)(const char *aName, const char *aType, const char *aNewName, void *aContext);
+
     /**
      * This method sets the handler for service publication.
      *
@@ -219,6 +244,30 @@ public:
         mHostHandlerContext = aContext;
     }
 
+    /**
+     * This method sets the policy for name conflicts.
+     *
+     * A renamed host or service keeps being identified by its requested name, both in publication results and in
+     * later calls to publish or unpublish it.
+     *
+     * @param[in]  aPolicy  The conflict policy.
+     *
+     */
+    void SetConflictPolicy(ConflictPolicy aPolicy) { mConflictPolicy = aPolicy; }
+
+    /**
+     * This method sets the handler for name conflicts.
+     *
+     * @param[in]  aHandler  A handler which will be called when a name conflict is detected.
+     * @param[in]  aContext  A user context which is associated to @p aHandler.
+     *
+     */
+    void SetConflictHandler(ConflictHandler aHandler, void *aContext)
+    {
+        mConflictHandler        = aHandler;
+        mConflictHandlerContext = aContext;
+    }
+
     /**
      * This method starts the MDNS service.
      *
@@ -310,7 +359,7 @@ public:
      *
      * If @p aInstanceName is not empty, this method subscribes the service instance. Otherwise, this method subscribes
      * the service. mDNS implementations should use the `DiscoveredServiceInstanceCallback` function to notify
-     * discovered service instances.
+     * discovered service instances, and instances that have been removed with `mRemoved` set.
      *
      * @note Discovery Proxy implementation guarantees no duplicate subscriptions for the same service or service
      * instance.
@@ -380,11 +429,16 @@ public:
      * @param[in]   aDomain             The domain to register in. Set nullptr to use default mDNS domain ("local.").
      * @param[in]   aHandler            The function to be called when this service state changed.
      * @param[in]   aContext            A pointer to application-specific context.
+     * @param[in]   aInterfaceIndex     The network interface to publish and browse on, or 0 for all interfaces.
      *
      * @returns A pointer to the newly created MDNS publisher.
      *
      */
-    static Publisher *Create(int aProtocol, const char *aDomain, StateHandler aHandler, void *aContext);
+    static Publisher *Create(int          aProtocol,
+                             const char * aDomain,
+                             StateHandler aHandler,
+                             void *       aContext,
+                             uint32_t     aInterfaceIndex = 0);
 
     /**
      * This function destroys the MDNS publisher.
@@ -430,8 +484,36 @@ protected:
     enum : uint8_t
     {
         kMaxTextEntrySize = 255,
+        kMaxRenameCount   = 15,
     };
 
+    /**
+     * This method applies the conflict policy to a conflicting host or service and notifies the conflict handler.
+     *
+     * @param[in]     aName         The requested host or service instance name.
+     * @param[in]     aType         The service type, or nullptr for a host.
+     * @param[inout]  aRenameCount  The number of renames so far, incremented on rename.
+     * @param[out]    aNewName      The alternative name to publish, set only on rename.
+     *
+     * @returns  Whether to rename to @p aNewName, otherwise the registration should be withdrawn.
+     *
+     */
+    bool ResolveConflict(const std::string &aName, const char *aType, uint8_t &aRenameCount, std::string &aNewName);
+
+    /**
+     * This method notifies the conflict handler.
+     *
+     * @param[in]  aName     The requested host or service instance name.
+     * @param[in]  aType     The service type, or nullptr for a host.
+     * @param[in]  aNewName  The alternative name now being published, or nullptr if the registration is withdrawn.
+     *
+     */
+    void NotifyConflict(const char *aName, const char *aType, const char *aNewName);
+
+    ConflictPolicy  mConflictPolicy         = ConflictPolicy::kReport;
+    ConflictHandler mConflictHandler        = nullptr;
+    void *          mConflictHandlerContext = nullptr;
+
     PublishServiceHandler mServiceHandler        = nullptr;
     void *                mServiceHandlerContext = nullptr;
 
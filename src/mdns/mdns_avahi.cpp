@@ -294,10 +294,15 @@ void Poller::Process(const MainloopContext &aMainloop)
     }
 }
 
-PublisherAvahi::PublisherAvahi(int aProtocol, const char *aDomain, StateHandler aHandler, void *aContext)
+PublisherAvahi::PublisherAvahi(int          aProtocol,
+                               const char * aDomain,
+                               StateHandler aHandler,
+                               void *       aContext,
+                               uint32_t     aInterfaceIndex)
     : mClient(nullptr)
     , mProtocol(aProtocol == AF_INET6 ? AVAHI_PROTO_INET6
                                       : aProtocol == AF_INET ? AVAHI_PROTO_INET : AVAHI_PROTO_UNSPEC)
+    , mInterfaceIndex(aInterfaceIndex == 0 ? AVAHI_IF_UNSPEC : static_cast<AvahiIfIndex>(aInterfaceIndex))
     , mDomain(aDomain)
     , mState(State::kIdle)
     , mStateHandler(aHandler)
@@ -334,6 +339,11 @@ void PublisherAvahi::Stop(void)
 {
     FreeAllGroups();
 
+    // Browsers and resolvers are freed along with the client.
+    mSubscribedServices.ForEach([](ServiceSubscription &aService) { aService.mServiceBrowser = nullptr; });
+    mServiceResolvers.ForEach([](ServiceResolver &aResolver) { aResolver.mServiceResolver = nullptr; });
+    mSubscribedHosts.ForEach([](HostSubscription &aHost) { aHost.mRecordBrowser = nullptr; });
+
     if (mClient)
     {
         avahi_client_free(mClient);
@@ -368,7 +378,10 @@ void PublisherAvahi::HandleGroupState(AvahiEntryGroup *aGroup, AvahiEntryGroupSt
 
     case AVAHI_ENTRY_GROUP_COLLISION:
         otbrLogErr("Name collision!");
-        CallHostOrServiceCallback(aGroup, OTBR_ERROR_DUPLICATED);
+        if (!RenameHostOrService(aGroup))
+        {
+            CallHostOrServiceCallback(aGroup, OTBR_ERROR_DUPLICATED);
+        }
         break;
 
     case AVAHI_ENTRY_GROUP_FAILURE:
@@ -413,6 +426,74 @@ void PublisherAvahi::CallHostOrServiceCallback(AvahiEntryGroup *aGroup, otbrErro
     }
 }
 
+bool PublisherAvahi::RenameHostOrService(AvahiEntryGroup *aGroup)
+{
+    bool                           renamed = false;
+    otbrError                      error;
+    std::string                    newName;
+    Hosts::iterator                hostIt;
+    Services::iterator             serviceIt;
+    std::vector<AvahiEntryGroup *> failedGroups;
+
+    hostIt = std::find_if(mHosts.begin(), mHosts.end(), [aGroup](const Host &aHost) { return aHost.mGroup == aGroup; });
+    serviceIt = std::find_if(mServices.begin(), mServices.end(),
+                             [aGroup](const Service &aService) { return aService.mGroup == aGroup; });
+
+    if (hostIt != mHosts.end())
+    {
+        // An alternative name may also be held by another client of the daemon.
+        do
+        {
+            VerifyOrExit(ResolveConflict(hostIt->mHostName, nullptr, hostIt->mRenameCount, newName));
+
+            hostIt->mAdvertisedName = newName;
+            SuccessOrExit(ResetGroup(hostIt->mGroup));
+            error = AddHost(*hostIt);
+        } while (error == OTBR_ERROR_DUPLICATED);
+
+        SuccessOrExit(error);
+
+        // Services on the host follow it to its alternative name.
+        for (Service &service : mServices)
+        {
+            if (service.mHostName == hostIt->mHostName &&
+                (ResetGroup(service.mGroup) != OTBR_ERROR_NONE || AddService(service) != OTBR_ERROR_NONE))
+            {
+                failedGroups.push_back(service.mGroup);
+            }
+        }
+    }
+    else if (serviceIt != mServices.end())
+    {
+        do
+        {
+            VerifyOrExit(
+                ResolveConflict(serviceIt->mName, serviceIt->mType.c_str(), serviceIt->mRenameCount, newName));
+
+            serviceIt->mAdvertisedName = newName;
+            SuccessOrExit(ResetGroup(serviceIt->mGroup));
+            error = AddService(*serviceIt);
+        } while (error == OTBR_ERROR_DUPLICATED);
+
+        SuccessOrExit(error);
+    }
+    else
+    {
+        ExitNow();
+    }
+
+    renamed = true;
+
+    // The handlers may publish or unpublish, so they are only called once the services are no longer iterated.
+    for (AvahiEntryGroup *group : failedGroups)
+    {
+        CallHostOrServiceCallback(group, OTBR_ERROR_MDNS);
+    }
+
+exit:
+    return renamed;
+}
+
 PublisherAvahi::Hosts::iterator PublisherAvahi::FindHost(const char *aHostName)
 {
     assert(aHostName != nullptr);
@@ -428,7 +509,8 @@ otbrError PublisherAvahi::CreateHost(AvahiClient &aClient, const char *aHostName
     otbrError error = OTBR_ERROR_NONE;
     Host      newHost;
 
-    newHost.mHostName = aHostName;
+    newHost.mHostName       = aHostName;
+    newHost.mAdvertisedName = aHostName;
     SuccessOrExit(error = CreateGroup(aClient, newHost.mGroup));
 
     mHosts.push_back(newHost);
@@ -459,8 +541,9 @@ otbrError PublisherAvahi::CreateService(AvahiClient &       aClient,
     otbrError error = OTBR_ERROR_NONE;
     Service   newService;
 
-    newService.mName = aName;
-    newService.mType = aType;
+    newService.mName           = aName;
+    newService.mType           = aType;
+    newService.mAdvertisedName = aName;
     SuccessOrExit(error = CreateGroup(aClient, newService.mGroup));
 
     mServices.push_back(newService);
@@ -586,41 +669,22 @@ void PublisherAvahi::HandleClientState(AvahiClient *aClient, AvahiClientState aS
 void PublisherAvahi::Update(MainloopContext &aMainloop)
 {
     mPoller.Update(aMainloop);
+    mTaskRunner.Update(aMainloop);
 }
 
 void PublisherAvahi::Process(const MainloopContext &aMainloop)
 {
     mPoller.Process(aMainloop);
+    mTaskRunner.Process(aMainloop);
 }
 
-otbrError PublisherAvahi::PublishService(const char *   aHostName,
-                                         uint16_t       aPort,
-                                         const char *   aName,
-                                         const char *   aType,
-                                         const TxtList &aTxtList)
+otbrError PublisherAvahi::MakeTxtStringList(const TxtList &aTxtList, TxtBuffer &aBuffer, AvahiStringList *&aHead)
 {
-    otbrError          error        = OTBR_ERROR_NONE;
-    int                avahiError   = 0;
-    Services::iterator serviceIt    = mServices.end();
-    const char *       safeHostName = (aHostName != nullptr) ? aHostName : "";
-    const char *       logHostName  = (aHostName != nullptr) ? aHostName : "localhost";
-    std::string        fullHostName;
-    // aligned with AvahiStringList
-    AvahiStringList  buffer[(kMaxSizeOfTxtRecord - 1) / sizeof(AvahiStringList) + 1];
-    AvahiStringList *last = nullptr;
-    AvahiStringList *curr = buffer;
-    size_t           used = 0;
+    otbrError        error = OTBR_ERROR_NONE;
+    AvahiStringList *curr  = aBuffer;
+    size_t           used  = 0;
 
-    VerifyOrExit(mState == State::kReady, errno = EAGAIN, error = OTBR_ERROR_ERRNO);
-    VerifyOrExit(mClient != nullptr, errno = EAGAIN, error = OTBR_ERROR_ERRNO);
-    VerifyOrExit(aName != nullptr, error = OTBR_ERROR_INVALID_ARGS);
-    VerifyOrExit(aType != nullptr, error = OTBR_ERROR_INVALID_ARGS);
-
-    if (aHostName != nullptr)
-    {
-        fullHostName = MakeFullName(aHostName);
-        aHostName    = fullHostName.c_str();
-    }
+    aHead = nullptr;
 
     for (const auto &txtEntry : aTxtList)
     {
@@ -631,9 +695,9 @@ otbrError PublisherAvahi::PublishService(const char *   aHostName,
         // +1 for the size of "=", avahi doesn't need '\0' at the end of the entry
         size_t needed = sizeof(AvahiStringList) - sizeof(AvahiStringList::text) + nameLength + valueLength + 1;
 
-        VerifyOrExit(used + needed <= sizeof(buffer), errno = EMSGSIZE, error = OTBR_ERROR_ERRNO);
-        curr->next = last;
-        last       = curr;
+        VerifyOrExit(used + needed <= sizeof(aBuffer), errno = EMSGSIZE, error = OTBR_ERROR_ERRNO);
+        curr->next = aHead;
+        aHead      = curr;
         memcpy(curr->text, name, nameLength);
         curr->text[nameLength] = '=';
         memcpy(curr->text + nameLength + 1, value, valueLength);
@@ -642,9 +706,74 @@ otbrError PublisherAvahi::PublishService(const char *   aHostName,
             const uint8_t *next = curr->text + curr->size;
             curr                = OTBR_ALIGNED(next, AvahiStringList *);
         }
-        used = static_cast<size_t>(reinterpret_cast<uint8_t *>(curr) - reinterpret_cast<uint8_t *>(buffer));
+        used = static_cast<size_t>(reinterpret_cast<uint8_t *>(curr) - reinterpret_cast<uint8_t *>(aBuffer));
     }
 
+exit:
+    return error;
+}
+
+otbrError PublisherAvahi::AddService(const Service &aService)
+{
+    otbrError        error      = OTBR_ERROR_NONE;
+    int              avahiError = 0;
+    const char *     hostName   = nullptr;
+    std::string      fullHostName;
+    TxtBuffer        buffer;
+    AvahiStringList *txtList;
+
+    SuccessOrExit(error = MakeTxtStringList(aService.mTxtList, buffer, txtList));
+
+    if (!aService.mHostName.empty())
+    {
+        Hosts::iterator hostIt = FindHost(aService.mHostName.c_str());
+
+        // A renamed host is the target under its alternative name.
+        fullHostName = MakeFullName((hostIt == mHosts.end() ? aService.mHostName : hostIt->mAdvertisedName).c_str());
+        hostName     = fullHostName.c_str();
+    }
+
+    otbrLogInfo("Create service %s.%s for host %s", aService.mAdvertisedName.c_str(), aService.mType.c_str(),
+                hostName != nullptr ? hostName : "localhost");
+    avahiError = avahi_entry_group_add_service_strlst(aService.mGroup, mInterfaceIndex, mProtocol, AvahiPublishFlags{},
+                                                      aService.mAdvertisedName.c_str(), aService.mType.c_str(), mDomain,
+                                                      hostName, aService.mPort, txtList);
+    SuccessOrExit(avahiError);
+
+    otbrLogInfo("Commit service %s.%s", aService.mAdvertisedName.c_str(), aService.mType.c_str());
+    avahiError = avahi_entry_group_commit(aService.mGroup);
+
+exit:
+    if (avahiError)
+    {
+        // Avahi refuses a name held by another client of the daemon instead of reporting a collision later.
+        error = avahiError == AVAHI_ERR_COLLISION ? OTBR_ERROR_DUPLICATED : OTBR_ERROR_MDNS;
+        otbrLogErr("Failed to add service for avahi error: %s!", avahi_strerror(avahiError));
+    }
+
+    return error;
+}
+
+otbrError PublisherAvahi::PublishService(const char *   aHostName,
+                                         uint16_t       aPort,
+                                         const char *   aName,
+                                         const char *   aType,
+                                         const TxtList &aTxtList)
+{
+    otbrError          error        = OTBR_ERROR_NONE;
+    int                avahiError   = 0;
+    Services::iterator serviceIt    = mServices.end();
+    const char *       safeHostName = (aHostName != nullptr) ? aHostName : "";
+    const char *       logHostName  = (aHostName != nullptr) ? aHostName : "localhost";
+    TxtBuffer          buffer;
+    AvahiStringList *  txtList;
+
+    VerifyOrExit(mState == State::kReady, errno = EAGAIN, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(mClient != nullptr, errno = EAGAIN, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(aName != nullptr, error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(aType != nullptr, error = OTBR_ERROR_INVALID_ARGS);
+    SuccessOrExit(error = MakeTxtStringList(aTxtList, buffer, txtList));
+
     serviceIt = FindService(aName, aType);
 
     if (serviceIt == mServices.end())
@@ -657,29 +786,37 @@ otbrError PublisherAvahi::PublishService(const char *   aHostName,
     }
     else
     {
-        otbrLogInfo("Update service %s.%s for host %s", aName, aType, logHostName);
-        avahiError = avahi_entry_group_update_service_txt_strlst(serviceIt->mGroup, AVAHI_IF_UNSPEC, mProtocol,
-                                                                 AvahiPublishFlags{}, aName, aType, mDomain, last);
-        if (avahiError == 0 && mServiceHandler != nullptr)
+        // A renamed service keeps its alternative name.
+        otbrLogInfo("Update service %s.%s for host %s", serviceIt->mAdvertisedName.c_str(), aType, logHostName);
+        avahiError = avahi_entry_group_update_service_txt_strlst(serviceIt->mGroup, mInterfaceIndex, mProtocol,
+                                                                 AvahiPublishFlags{},
+                                                                 serviceIt->mAdvertisedName.c_str(), aType, mDomain,
+                                                                 txtList);
+        if (avahiError == 0)
         {
-            // The handler should be called even if the request can be processed synchronously
-            mServiceHandler(aName, aType, OTBR_ERROR_NONE, mServiceHandlerContext);
+            serviceIt->mTxtList = aTxtList;
+
+            if (mServiceHandler != nullptr)
+            {
+                // The handler should be called even if the request can be processed synchronously
+                mServiceHandler(aName, aType, OTBR_ERROR_NONE, mServiceHandlerContext);
+            }
         }
         ExitNow();
     }
 
-    otbrLogInfo("Create service %s.%s for host %s", aName, aType, logHostName);
-    avahiError =
-        avahi_entry_group_add_service_strlst(serviceIt->mGroup, AVAHI_IF_UNSPEC, mProtocol, AvahiPublishFlags{}, aName,
-                                             aType, mDomain, aHostName, aPort, last);
-    SuccessOrExit(avahiError);
-
-    otbrLogInfo("Commit service %s.%s", aName, aType);
-    avahiError = avahi_entry_group_commit(serviceIt->mGroup);
-    SuccessOrExit(avahiError);
-
     serviceIt->mHostName = safeHostName;
     serviceIt->mPort     = aPort;
+    serviceIt->mTxtList  = aTxtList;
+    error                = AddService(*serviceIt);
+
+    // The name held by another client of the daemon is resolved like a collision on the link.
+    if (error == OTBR_ERROR_DUPLICATED && RenameHostOrService(serviceIt->mGroup))
+    {
+        error = OTBR_ERROR_NONE;
+    }
+
+    SuccessOrExit(error);
 
 exit:
 
@@ -721,22 +858,42 @@ exit:
     return error;
 }
 
+otbrError PublisherAvahi::AddHost(const Host &aHost)
+{
+    otbrError   error        = OTBR_ERROR_NONE;
+    std::string fullHostName = MakeFullName(aHost.mAdvertisedName.c_str());
+    int         avahiError;
+
+    otbrLogInfo("Create host %s", aHost.mAdvertisedName.c_str());
+    avahiError = avahi_entry_group_add_address(aHost.mGroup, mInterfaceIndex, mProtocol, AVAHI_PUBLISH_NO_REVERSE,
+                                               fullHostName.c_str(), &aHost.mAddress);
+    SuccessOrExit(avahiError);
+
+    otbrLogInfo("Commit host %s", aHost.mAdvertisedName.c_str());
+    avahiError = avahi_entry_group_commit(aHost.mGroup);
+
+exit:
+    if (avahiError)
+    {
+        error = avahiError == AVAHI_ERR_COLLISION ? OTBR_ERROR_DUPLICATED : OTBR_ERROR_MDNS;
+        otbrLogErr("Failed to add host for avahi error: %s!", avahi_strerror(avahiError));
+    }
+
+    return error;
+}
+
 otbrError PublisherAvahi::PublishHost(const char *aName, const uint8_t *aAddress, uint8_t aAddressLength)
 {
-    otbrError       error      = OTBR_ERROR_NONE;
-    int             avahiError = 0;
-    Hosts::iterator hostIt     = mHosts.end();
-    std::string     fullHostName;
-    AvahiAddress    address;
+    otbrError       error  = OTBR_ERROR_NONE;
+    Hosts::iterator hostIt = mHosts.end();
 
     VerifyOrExit(mState == State::kReady, errno = EAGAIN, error = OTBR_ERROR_ERRNO);
     VerifyOrExit(mClient != nullptr, errno = EAGAIN, error = OTBR_ERROR_ERRNO);
     VerifyOrExit(aName != nullptr, error = OTBR_ERROR_INVALID_ARGS);
     VerifyOrExit(aAddress != nullptr, error = OTBR_ERROR_INVALID_ARGS);
-    VerifyOrExit(aAddressLength == sizeof(address.data.ipv6.address), error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(aAddressLength == sizeof(hostIt->mAddress.data.ipv6.address), error = OTBR_ERROR_INVALID_ARGS);
 
-    fullHostName = MakeFullName(aName);
-    hostIt       = FindHost(aName);
+    hostIt = FindHost(aName);
 
     if (hostIt == mHosts.end())
     {
@@ -756,28 +913,21 @@ otbrError PublisherAvahi::PublishHost(const char *aName, const uint8_t *aAddress
         ExitNow();
     }
 
-    address.proto = AVAHI_PROTO_INET6;
-    memcpy(&address.data.ipv6.address[0], aAddress, aAddressLength);
-
-    otbrLogInfo("Create host %s", aName);
-    avahiError = avahi_entry_group_add_address(hostIt->mGroup, AVAHI_IF_UNSPEC, mProtocol, AVAHI_PUBLISH_NO_REVERSE,
-                                               fullHostName.c_str(), &address);
-    SuccessOrExit(avahiError);
+    // A renamed host keeps its alternative name.
+    hostIt->mAddress.proto = AVAHI_PROTO_INET6;
+    memcpy(&hostIt->mAddress.data.ipv6.address[0], aAddress, aAddressLength);
+    error = AddHost(*hostIt);
 
-    otbrLogInfo("Commit host %s", aName);
-    avahiError = avahi_entry_group_commit(hostIt->mGroup);
-    SuccessOrExit(avahiError);
+    if (error == OTBR_ERROR_DUPLICATED && RenameHostOrService(hostIt->mGroup))
+    {
+        error = OTBR_ERROR_NONE;
+    }
 
-    hostIt->mAddress = address;
+    SuccessOrExit(error);
 
 exit:
 
-    if (avahiError)
-    {
-        error = OTBR_ERROR_MDNS;
-        otbrLogErr("Failed to publish host for avahi error: %s!", avahi_strerror(avahiError));
-    }
-    else if (error != OTBR_ERROR_NONE)
+    if (error != OTBR_ERROR_NONE)
     {
         otbrLogErr("Failed to publish host: %s!", otbrErrorString(error));
     }
@@ -823,52 +973,123 @@ std::string PublisherAvahi::MakeFullName(const char *aName)
 
 void PublisherAvahi::SubscribeService(const std::string &aType, const std::string &aInstanceName)
 {
-    mSubscribedServices.emplace_back(*this, aType, aInstanceName);
+    bool                            isNew;
+    ServiceSubscriptionPool::Handle handle;
+
+    handle = mSubscribedServices.Acquire(
+        ServiceKey(aType, aInstanceName), [&]() { return new ServiceSubscription(*this, aType, aInstanceName); },
+        isNew);
+
+    otbrLogInfo("subscribe service %s.%s (total %zu, references %u)", aInstanceName.c_str(), aType.c_str(),
+                mSubscribedServices.GetSize(), ServiceSubscriptionPool::GetRefCount(handle));
 
-    otbrLogInfo("subscribe service %s.%s (total %zu)", aInstanceName.c_str(), aType.c_str(),
-                mSubscribedServices.size());
+    VerifyOrExit(isNew);
 
     if (aInstanceName.empty())
     {
-        mSubscribedServices.back().Browse();
+        ServiceSubscriptionPool::Get(handle).Browse();
     }
     else
     {
-        mSubscribedServices.back().Resolve(AVAHI_IF_UNSPEC, aInstanceName.c_str(), aType.c_str(), "local.");
+        ServiceSubscriptionPool::Get(handle).AddInstance(mInterfaceIndex, aInstanceName.c_str(), "local.");
     }
+
+exit:
+    return;
 }
 
 void PublisherAvahi::UnsubscribeService(const std::string &aType, const std::string &aInstanceName)
 {
-    ServiceSubscriptionList::iterator it =
-        std::find_if(mSubscribedServices.begin(), mSubscribedServices.end(),
-                     [&aType, &aInstanceName](const ServiceSubscription &aService) {
-                         return aService.mType == aType && aService.mInstanceName == aInstanceName;
-                     });
+    ServiceSubscriptionPool::Handle      handle = mSubscribedServices.Find(ServiceKey(aType, aInstanceName));
+    std::unique_ptr<ServiceSubscription> service;
 
-    assert(it != mSubscribedServices.end());
+    assert(mSubscribedServices.IsValid(handle));
 
-    it->Release();
-    mSubscribedServices.erase(it);
+    service = mSubscribedServices.Release(handle);
+    if (service != nullptr)
+    {
+        service->Release();
+    }
 
     otbrLogInfo("unsubscribe service %s.%s (left %zu)", aInstanceName.c_str(), aType.c_str(),
-                mSubscribedServices.size());
+                mSubscribedServices.GetSize());
+}
+
+PublisherAvahi::ServiceResolverPool::Handle PublisherAvahi::AcquireServiceResolver(const std::string &aType,
+                                                                                   const std::string &aInstanceName,
+                                                                                   AvahiIfIndex       aInterfaceIndex,
+                                                                                   const char *       aDomain)
+{
+    bool                        isNew;
+    ServiceResolverPool::Handle handle;
+
+    handle = mServiceResolvers.Acquire(
+        ServiceKey(aType, aInstanceName), [&]() { return new ServiceResolver(*this, aType, aInstanceName); }, isNew);
+
+    ServiceResolver &resolver = ServiceResolverPool::Get(handle);
+
+    otbrLogDebug("acquire resolver %s.%s (references %u)", aInstanceName.c_str(), aType.c_str(),
+                 ServiceResolverPool::GetRefCount(handle));
+
+    if (resolver.mResolved)
+    {
+        // The instance is already resolved for another subscription. The report is posted to the mainloop, as the
+        // callback may unsubscribe, e.g. when OpenThread answers a query, which would free the caller's subscription.
+        mTaskRunner.Post([this, aType, aInstanceName]() { ReportResolvedService(aType, aInstanceName); });
+    }
+    if (resolver.mServiceResolver == nullptr)
+    {
+        resolver.Resolve(aInterfaceIndex, aDomain);
+    }
+
+    return handle;
 }
 
-void PublisherAvahi::OnServiceResolved(ServiceSubscription &aService)
+void PublisherAvahi::ReleaseServiceResolver(ServiceResolverPool::Handle aResolver)
 {
-    otbrLogInfo("Service %s is resolved successfully: %s host %s addresses %zu", aService.mType.c_str(),
-                aService.mInstanceInfo.mName.c_str(), aService.mInstanceInfo.mHostName.c_str(),
-                aService.mInstanceInfo.mAddresses.size());
+    // The resolver is freed along with the last reference.
+    mServiceResolvers.Release(aResolver);
+}
+
+void PublisherAvahi::OnServiceResolved(const ServiceResolver &aResolver)
+{
+    otbrLogInfo("Service %s is resolved successfully: %s host %s addresses %zu", aResolver.mType.c_str(),
+                aResolver.mInstanceInfo.mName.c_str(), aResolver.mInstanceInfo.mHostName.c_str(),
+                aResolver.mInstanceInfo.mAddresses.size());
     if (mDiscoveredServiceInstanceCallback != nullptr)
     {
-        mDiscoveredServiceInstanceCallback(aService.mType, aService.mInstanceInfo);
+        mDiscoveredServiceInstanceCallback(aResolver.mType, aResolver.mInstanceInfo);
     }
 }
 
-void PublisherAvahi::OnServiceResolveFailed(const ServiceSubscription &aService, int aErrorCode)
+void PublisherAvahi::ReportResolvedService(const std::string &aType, const std::string &aInstanceName)
 {
-    otbrLogWarning("Service %s resolving failed: code=%d", aService.mType.c_str(), aErrorCode);
+    ServiceResolverPool::Handle handle = mServiceResolvers.Find(ServiceKey(aType, aInstanceName));
+
+    // The subscriptions sharing the resolver may have been released before the mainloop runs.
+    VerifyOrExit(mServiceResolvers.IsValid(handle) && ServiceResolverPool::Get(handle).mResolved);
+    OnServiceResolved(ServiceResolverPool::Get(handle));
+
+exit:
+    return;
+}
+
+void PublisherAvahi::OnServiceRemoved(const std::string &aType, const std::string &aInstanceName)
+{
+    DiscoveredInstanceInfo instanceInfo;
+
+    otbrLogInfo("Service %s.%s is removed", aInstanceName.c_str(), aType.c_str());
+    if (mDiscoveredServiceInstanceCallback != nullptr)
+    {
+        instanceInfo.mRemoved = true;
+        instanceInfo.mName    = aInstanceName;
+        mDiscoveredServiceInstanceCallback(aType, instanceInfo);
+    }
+}
+
+void PublisherAvahi::OnServiceResolveFailed(const std::string &aType, const std::string &aInstanceName, int aErrorCode)
+{
+    otbrLogWarning("Service %s.%s resolving failed: code=%d", aInstanceName.c_str(), aType.c_str(), aErrorCode);
 }
 
 void PublisherAvahi::OnHostResolved(HostSubscription &aHost)
@@ -888,30 +1109,43 @@ void PublisherAvahi::OnHostResolveFailed(const HostSubscription &aHost, int aErr
 
 void PublisherAvahi::SubscribeHost(const std::string &aHostName)
 {
-    mSubscribedHosts.emplace_back(*this, aHostName);
+    bool                         isNew;
+    HostSubscriptionPool::Handle handle;
+
+    handle = mSubscribedHosts.Acquire(aHostName, [&]() { return new HostSubscription(*this, aHostName); }, isNew);
 
-    otbrLogInfo("subscribe host %s (total %zu)", aHostName.c_str(), mSubscribedHosts.size());
+    otbrLogInfo("subscribe host %s (total %zu, references %u)", aHostName.c_str(), mSubscribedHosts.GetSize(),
+                HostSubscriptionPool::GetRefCount(handle));
 
-    mSubscribedHosts.back().Resolve();
+    if (isNew)
+    {
+        HostSubscriptionPool::Get(handle).Resolve();
+    }
 }
 
 void PublisherAvahi::UnsubscribeHost(const std::string &aHostName)
 {
-    HostSubscriptionList::iterator it =
-        std::find_if(mSubscribedHosts.begin(), mSubscribedHosts.end(),
-                     [&aHostName](const HostSubscription &aHost) { return aHost.mHostName == aHostName; });
+    HostSubscriptionPool::Handle      handle = mSubscribedHosts.Find(aHostName);
+    std::unique_ptr<HostSubscription> host;
 
-    assert(it != mSubscribedHosts.end());
+    assert(mSubscribedHosts.IsValid(handle));
 
-    it->Release();
-    mSubscribedHosts.erase(it);
+    host = mSubscribedHosts.Release(handle);
+    if (host != nullptr)
+    {
+        host->Release();
+    }
 
-    otbrLogInfo("unsubscribe host %s (remaining %d)", aHostName.c_str(), mSubscribedHosts.size());
+    otbrLogInfo("unsubscribe host %s (remaining %zu)", aHostName.c_str(), mSubscribedHosts.GetSize());
 }
 
-Publisher *Publisher::Create(int aFamily, const char *aDomain, StateHandler aHandler, void *aContext)
+Publisher *Publisher::Create(int          aFamily,
+                             const char * aDomain,
+                             StateHandler aHandler,
+                             void *       aContext,
+                             uint32_t     aInterfaceIndex)
 {
-    return new PublisherAvahi(aFamily, aDomain, aHandler, aContext);
+    return new PublisherAvahi(aFamily, aDomain, aHandler, aContext, aInterfaceIndex);
 }
 
 void Publisher::Destroy(Publisher *aPublisher)
@@ -924,9 +1158,9 @@ void PublisherAvahi::ServiceSubscription::Browse(void)
     assert(mPublisherAvahi->mClient != nullptr);
 
     otbrLogInfo("browse service %s", mType.c_str());
-    mServiceBrowser =
-        avahi_service_browser_new(mPublisherAvahi->mClient, AVAHI_IF_UNSPEC, AVAHI_PROTO_INET6, mType.c_str(),
-                                  mPublisherAvahi->mDomain, static_cast<AvahiLookupFlags>(0), HandleBrowseResult, this);
+    mServiceBrowser = avahi_service_browser_new(mPublisherAvahi->mClient, mPublisherAvahi->mInterfaceIndex,
+                                                AVAHI_PROTO_INET6, mType.c_str(), mPublisherAvahi->mDomain,
+                                                static_cast<AvahiLookupFlags>(0), HandleBrowseResult, this);
     if (!mServiceBrowser)
     {
         otbrLogWarning("failed to browse service %s: %s", mType.c_str(),
@@ -941,11 +1175,53 @@ void PublisherAvahi::ServiceSubscription::Release(void)
         avahi_service_browser_free(mServiceBrowser);
         mServiceBrowser = nullptr;
     }
-    if (mServiceResolver != nullptr)
+
+    for (const auto &instance : mInstances)
     {
-        avahi_service_resolver_free(mServiceResolver);
-        mServiceResolver = nullptr;
+        mPublisherAvahi->ReleaseServiceResolver(instance.second.mResolver);
     }
+    mInstances.clear();
+}
+
+void PublisherAvahi::ServiceSubscription::AddInstance(AvahiIfIndex aInterfaceIndex,
+                                                      const char * aInstanceName,
+                                                      const char * aDomain)
+{
+    auto it = mInstances.find(aInstanceName);
+
+    // The same instance is reported once for each interface it's found on.
+    if (it != mInstances.end())
+    {
+        it->second.mInterfaceCount++;
+    }
+    else
+    {
+        // The instance is only added along with a valid resolver handle, which `Release()` relies on.
+        Instance instance;
+
+        instance.mInterfaceCount = 1;
+        instance.mResolver = mPublisherAvahi->AcquireServiceResolver(mType, aInstanceName, aInterfaceIndex, aDomain);
+        mInstances.emplace(aInstanceName, instance);
+
+        otbrLogInfo("add service instance %s.%s (total %zu)", aInstanceName, mType.c_str(), mInstances.size());
+    }
+}
+
+void PublisherAvahi::ServiceSubscription::RemoveInstance(const char *aInstanceName)
+{
+    auto it = mInstances.find(aInstanceName);
+
+    VerifyOrExit(it != mInstances.end());
+    VerifyOrExit(--it->second.mInterfaceCount == 0);
+
+    mPublisherAvahi->ReleaseServiceResolver(it->second.mResolver);
+    mInstances.erase(it);
+    otbrLogInfo("remove service instance %s.%s (left %zu)", aInstanceName, mType.c_str(), mInstances.size());
+
+    mPublisherAvahi->OnServiceRemoved(mType, aInstanceName);
+
+exit:
+    return;
 }
 
 void PublisherAvahi::ServiceSubscription::HandleBrowseResult(AvahiServiceBrowser *  aServiceBrowser,
@@ -976,31 +1252,48 @@ void PublisherAvahi::ServiceSubscription::HandleBrowseResult(AvahiServiceBrowser
 
     assert(mServiceBrowser == aServiceBrowser);
 
-    otbrLogInfo("browse service reply: %s.%s%s inf %u, flags=%u", aName, aType, aDomain, aInterfaceIndex, aFlags);
-
-    if (aEvent == AVAHI_BROWSER_FAILURE)
-    {
-        mPublisherAvahi->OnServiceResolveFailed(*this, avahi_client_errno(mPublisherAvahi->mClient));
-    }
-    else
-    {
-        Resolve(aInterfaceIndex, aName, aType, aDomain);
-    }
-    if (mServiceBrowser != nullptr)
+    // The browser is kept until the subscription is released, so that instances are reported as they come and go.
+    switch (aEvent)
     {
+    case AVAHI_BROWSER_NEW:
+        otbrLogInfo("browse service reply: new %s.%s%s inf %u, flags=%u", aName, aType, aDomain, aInterfaceIndex,
+                    aFlags);
+        AddInstance(aInterfaceIndex, aName, aDomain);
+        break;
+
+    case AVAHI_BROWSER_REMOVE:
+        otbrLogInfo("browse service reply: remove %s.%s%s inf %u, flags=%u", aName, aType, aDomain, aInterfaceIndex,
+                    aFlags);
+        RemoveInstance(aName);
+        break;
+
+    case AVAHI_BROWSER_CACHE_EXHAUSTED:
+    case AVAHI_BROWSER_ALL_FOR_NOW:
+        otbrLogDebug("browse service %s: %zu instances for now", mType.c_str(), mInstances.size());
+        break;
+
+    case AVAHI_BROWSER_FAILURE:
+        mPublisherAvahi->OnServiceResolveFailed(mType, mInstanceName, avahi_client_errno(mPublisherAvahi->mClient));
         avahi_service_browser_free(mServiceBrowser);
         mServiceBrowser = nullptr;
+        break;
+    }
+}
+
+void PublisherAvahi::ServiceResolver::Release(void)
+{
+    if (mServiceResolver != nullptr)
+    {
+        avahi_service_resolver_free(mServiceResolver);
+        mServiceResolver = nullptr;
     }
 }
 
-void PublisherAvahi::ServiceSubscription::Resolve(uint32_t    aInterfaceIndex,
-                                                  const char *aInstanceName,
-                                                  const char *aType,
-                                                  const char *aDomain)
+void PublisherAvahi::ServiceResolver::Resolve(AvahiIfIndex aInterfaceIndex, const char *aDomain)
 {
-    otbrLogInfo("resolve service %s %s %s inf %d", aInstanceName, aType, aDomain, aInterfaceIndex);
+    otbrLogInfo("resolve service %s %s %s inf %d", mInstanceName.c_str(), mType.c_str(), aDomain, aInterfaceIndex);
     mServiceResolver = avahi_service_resolver_new(mPublisherAvahi->mClient, aInterfaceIndex, AVAHI_PROTO_INET6,
-                                                  aInstanceName, aType, aDomain, AVAHI_PROTO_INET6,
+                                                  mInstanceName.c_str(), mType.c_str(), aDomain, AVAHI_PROTO_INET6,
                                                   static_cast<AvahiLookupFlags>(0), HandleResolveResult, this);
     if (!mServiceResolver)
     {
@@ -1009,37 +1302,37 @@ void PublisherAvahi::ServiceSubscription::Resolve(uint32_t    aInterfaceIndex,
     }
 }
 
-void PublisherAvahi::ServiceSubscription::HandleResolveResult(AvahiServiceResolver * aServiceResolver,
-                                                              AvahiIfIndex           aInterfaceIndex,
-                                                              AvahiProtocol          aProtocol,
-                                                              AvahiResolverEvent     aEvent,
-                                                              const char *           aName,
-                                                              const char *           aType,
-                                                              const char *           aDomain,
-                                                              const char *           aHostName,
-                                                              const AvahiAddress *   aAddress,
-                                                              uint16_t               aPort,
-                                                              AvahiStringList *      aTxt,
-                                                              AvahiLookupResultFlags aFlags,
-                                                              void *                 aContext)
+void PublisherAvahi::ServiceResolver::HandleResolveResult(AvahiServiceResolver * aServiceResolver,
+                                                          AvahiIfIndex           aInterfaceIndex,
+                                                          AvahiProtocol          aProtocol,
+                                                          AvahiResolverEvent     aEvent,
+                                                          const char *           aName,
+                                                          const char *           aType,
+                                                          const char *           aDomain,
+                                                          const char *           aHostName,
+                                                          const AvahiAddress *   aAddress,
+                                                          uint16_t               aPort,
+                                                          AvahiStringList *      aTxt,
+                                                          AvahiLookupResultFlags aFlags,
+                                                          void *                 aContext)
 {
-    static_cast<PublisherAvahi::ServiceSubscription *>(aContext)->HandleResolveResult(
+    static_cast<PublisherAvahi::ServiceResolver *>(aContext)->HandleResolveResult(
         aServiceResolver, aInterfaceIndex, aProtocol, aEvent, aName, aType, aDomain, aHostName, aAddress, aPort, aTxt,
         aFlags);
 }
 
-void PublisherAvahi::ServiceSubscription::HandleResolveResult(AvahiServiceResolver * aServiceResolver,
-                                                              AvahiIfIndex           aInterfaceIndex,
-                                                              AvahiProtocol          aProtocol,
-                                                              AvahiResolverEvent     aEvent,
-                                                              const char *           aName,
-                                                              const char *           aType,
-                                                              const char *           aDomain,
-                                                              const char *           aHostName,
-                                                              const AvahiAddress *   aAddress,
-                                                              uint16_t               aPort,
-                                                              AvahiStringList *      aTxt,
-                                                              AvahiLookupResultFlags aFlags)
+void PublisherAvahi::ServiceResolver::HandleResolveResult(AvahiServiceResolver * aServiceResolver,
+                                                          AvahiIfIndex           aInterfaceIndex,
+                                                          AvahiProtocol          aProtocol,
+                                                          AvahiResolverEvent     aEvent,
+                                                          const char *           aName,
+                                                          const char *           aType,
+                                                          const char *           aDomain,
+                                                          const char *           aHostName,
+                                                          const AvahiAddress *   aAddress,
+                                                          uint16_t               aPort,
+                                                          AvahiStringList *      aTxt,
+                                                          AvahiLookupResultFlags aFlags)
 {
     OT_UNUSED_VARIABLE(aServiceResolver);
     OT_UNUSED_VARIABLE(aInterfaceIndex);
@@ -1047,9 +1340,10 @@ void PublisherAvahi::ServiceSubscription::HandleResolveResult(AvahiServiceResolv
     OT_UNUSED_VARIABLE(aType);
     OT_UNUSED_VARIABLE(aDomain);
 
-    char       buf[AVAHI_ADDRESS_STR_MAX];
-    Ip6Address address;
-    size_t     totalTxtSize = 0;
+    char                   buf[AVAHI_ADDRESS_STR_MAX];
+    Ip6Address             address;
+    size_t                 totalTxtSize = 0;
+    DiscoveredInstanceInfo instanceInfo;
 
     assert(mServiceResolver == aServiceResolver);
     VerifyOrExit(
@@ -1057,9 +1351,9 @@ void PublisherAvahi::ServiceSubscription::HandleResolveResult(AvahiServiceResolv
         otbrLogErr("failed to resolve service: %s", avahi_strerror(avahi_client_errno(mPublisherAvahi->mClient))));
     VerifyOrExit(aHostName != nullptr, otbrLogErr("host name is null"));
 
-    mInstanceInfo.mName     = aName;
-    mInstanceInfo.mHostName = std::string(aHostName) + ".";
-    mInstanceInfo.mPort     = aPort;
+    instanceInfo.mName     = aName;
+    instanceInfo.mHostName = std::string(aHostName) + ".";
+    instanceInfo.mPort     = aPort;
     avahi_address_snprint(buf, sizeof(buf), aAddress);
     VerifyOrExit(otbrError::OTBR_ERROR_NONE == Ip6Address::FromString(buf, address),
                  otbrLogErr("failed to parse the IP address: %s", buf));
@@ -1067,9 +1361,9 @@ void PublisherAvahi::ServiceSubscription::HandleResolveResult(AvahiServiceResolv
     otbrLogDebug("resolve service reply: flags=%u, host=%s", aFlags, aHostName);
 
     VerifyOrExit(!address.IsLinkLocal() && !address.IsMulticast() && !address.IsLoopback() && !address.IsUnspecified(),
-                 otbrLogDebug("ignoring address %s", address.ToString().c_str()));
+                 otbrLogDebug("ignoring address %s", Ip6AddressString(address).AsCString()));
 
-    mInstanceInfo.mAddresses.push_back(address);
+    instanceInfo.mAddresses.push_back(address);
 
     // TODO priority
     // TODO weight
@@ -1078,22 +1372,24 @@ void PublisherAvahi::ServiceSubscription::HandleResolveResult(AvahiServiceResolv
     {
         totalTxtSize += avahi_string_list_get_size(p) + 1;
     }
-    mInstanceInfo.mTxtData.resize(totalTxtSize);
-    avahi_string_list_serialize(aTxt, mInstanceInfo.mTxtData.data(), totalTxtSize);
+    instanceInfo.mTxtData.resize(totalTxtSize);
+    avahi_string_list_serialize(aTxt, instanceInfo.mTxtData.data(), totalTxtSize);
 
-    otbrLogDebug("resolve service reply: address=%s, ttl=%u", address.ToString().c_str(), mInstanceInfo.mTtl);
+    otbrLogDebug("resolve service reply: address=%s, ttl=%u", Ip6AddressString(address).AsCString(),
+                 instanceInfo.mTtl);
 
+    // The resolver stays alive and reports again whenever the instance changes.
+    mInstanceInfo = std::move(instanceInfo);
+    mResolved     = true;
     mPublisherAvahi->OnServiceResolved(*this);
 
 exit:
-    if (avahi_client_errno(mPublisherAvahi->mClient) != AVAHI_OK)
+    if (aEvent == AVAHI_RESOLVER_FAILURE)
     {
-        mPublisherAvahi->OnServiceResolveFailed(*this, avahi_client_errno(mPublisherAvahi->mClient));
-    }
-    if (mServiceBrowser != nullptr)
-    {
-        avahi_service_resolver_free(mServiceResolver);
-        mServiceResolver = nullptr;
+        mPublisherAvahi->OnServiceResolveFailed(mType, mInstanceName, avahi_client_errno(mPublisherAvahi->mClient));
+
+        // A failed resolver won't report anymore, so free it and let the next subscription retry.
+        Release();
     }
 }
 
@@ -1110,10 +1406,11 @@ void PublisherAvahi::HostSubscription::Resolve(void)
 {
     std::string fullHostName = mHostName + ".local.";
 
-    otbrLogDebug("resolve host %s inf %d", fullHostName.c_str(), AVAHI_IF_UNSPEC);
-    mRecordBrowser = avahi_record_browser_new(mPublisherAvahi->mClient, AVAHI_IF_UNSPEC, AVAHI_PROTO_INET6,
-                                              fullHostName.c_str(), AVAHI_DNS_CLASS_IN, AVAHI_DNS_TYPE_AAAA,
-                                              static_cast<AvahiLookupFlags>(0), HandleResolveResult, this);
+    otbrLogDebug("resolve host %s inf %d", fullHostName.c_str(), mPublisherAvahi->mInterfaceIndex);
+    mRecordBrowser = avahi_record_browser_new(mPublisherAvahi->mClient, mPublisherAvahi->mInterfaceIndex,
+                                              AVAHI_PROTO_INET6, fullHostName.c_str(), AVAHI_DNS_CLASS_IN,
+                                              AVAHI_DNS_TYPE_AAAA, static_cast<AvahiLookupFlags>(0),
+                                              HandleResolveResult, this);
     if (!mRecordBrowser)
     {
         otbrLogErr("failed to resolve host %s: %s", fullHostName.c_str(),
@@ -1160,7 +1457,7 @@ void PublisherAvahi::HostSubscription::HandleResolveResult(AvahiRecordBrowser *
     assert(mRecordBrowser == aRecordBrowser);
     VerifyOrExit(!address.IsLinkLocal() && !address.IsMulticast() && !address.IsLoopback() && !address.IsUnspecified());
     VerifyOrExit(aSize == 16, otbrLogErr("unexpected address data length: %u", aSize));
-    otbrLogInfo("resolved host address: %s", address.ToString().c_str());
+    otbrLogInfo("resolved host address: %s", Ip6AddressString(address).AsCString());
 
     mHostInfo.mHostName = std::string(aName) + ".";
     mHostInfo.mAddresses.push_back(std::move(address));
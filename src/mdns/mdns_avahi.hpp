@@ -34,6 +34,8 @@
 #ifndef OTBR_AGENT_MDNS_AVAHI_HPP_
 #define OTBR_AGENT_MDNS_AVAHI_HPP_
 
+#include <map>
+#include <memory>
 #include <vector>
 
 #include <avahi-client/client.h>
@@ -43,7 +45,9 @@
 #include <avahi-common/watch.h>
 
 #include "mdns.hpp"
+#include "subscription_pool.hpp"
 #include "common/mainloop.hpp"
+#include "common/task_runner.hpp"
 #include "common/time.hpp"
 
 /**
@@ -194,9 +198,14 @@ public:
      * @param[in]   aDomain             The domain of the host. nullptr to use default.
      * @param[in]   aHandler            The function to be called when state changes.
      * @param[in]   aContext            A pointer to application-specific context.
+     * @param[in]   aInterfaceIndex     The network interface to publish and browse on, or 0 for all interfaces.
      *
      */
-    PublisherAvahi(int aProtocol, const char *aDomain, StateHandler aHandler, void *aContext);
+    PublisherAvahi(int          aProtocol,
+                   const char * aDomain,
+                   StateHandler aHandler,
+                   void *       aContext,
+                   uint32_t     aInterfaceIndex);
 
     ~PublisherAvahi(void) override;
 
@@ -368,8 +377,11 @@ private:
         std::string      mName;
         std::string      mType;
         std::string      mHostName;
-        uint16_t         mPort  = 0;
-        AvahiEntryGroup *mGroup = nullptr;
+        uint16_t         mPort = 0;
+        TxtList          mTxtList;
+        std::string      mAdvertisedName; ///< The instance name published, which differs from `mName` after renames.
+        uint8_t          mRenameCount = 0;
+        AvahiEntryGroup *mGroup       = nullptr;
     };
 
     typedef std::vector<Service> Services;
@@ -378,9 +390,14 @@ private:
     {
         std::string      mHostName;
         AvahiAddress     mAddress = {};
-        AvahiEntryGroup *mGroup   = nullptr;
+        std::string      mAdvertisedName; ///< The host name published, which differs from `mHostName` after renames.
+        uint8_t          mRenameCount = 0;
+        AvahiEntryGroup *mGroup       = nullptr;
     };
 
+    // Aligned with AvahiStringList.
+    typedef AvahiStringList TxtBuffer[(kMaxSizeOfTxtRecord - 1) / sizeof(AvahiStringList) + 1];
+
     struct Subscription
     {
         PublisherAvahi *mPublisherAvahi;
@@ -391,40 +408,27 @@ private:
         }
     };
 
-    struct ServiceSubscription : public Subscription
+    /**
+     * This structure represents a long-lived resolver of a service instance.
+     *
+     * A resolver is pooled and shared by all subscriptions that need the same service instance.
+     *
+     */
+    struct ServiceResolver
     {
-        explicit ServiceSubscription(PublisherAvahi &aPublisherAvahi, std::string aType, std::string aInstanceName)
-            : Subscription(aPublisherAvahi)
+        explicit ServiceResolver(PublisherAvahi &aPublisherAvahi, std::string aType, std::string aInstanceName)
+            : mPublisherAvahi(&aPublisherAvahi)
             , mType(std::move(aType))
             , mInstanceName(std::move(aInstanceName))
-            , mServiceBrowser(nullptr)
             , mServiceResolver(nullptr)
+            , mResolved(false)
         {
         }
 
-        void Release(void);
-        void Browse(void);
-        void Resolve(uint32_t aInterfaceIndex, const char *aInstanceName, const char *aType, const char *aDomain);
-        void GetAddrInfo(uint32_t aInterfaceIndex);
-
-        static void HandleBrowseResult(AvahiServiceBrowser *  aServiceBrowser,
-                                       AvahiIfIndex           aInterfaceIndex,
-                                       AvahiProtocol          aProtocol,
-                                       AvahiBrowserEvent      aEvent,
-                                       const char *           aName,
-                                       const char *           aType,
-                                       const char *           aDomain,
-                                       AvahiLookupResultFlags aFlags,
-                                       void *                 aContext);
+        ~ServiceResolver(void) { Release(); }
 
-        void HandleBrowseResult(AvahiServiceBrowser *  aServiceBrowser,
-                                AvahiIfIndex           aInterfaceIndex,
-                                AvahiProtocol          aProtocol,
-                                AvahiBrowserEvent      aEvent,
-                                const char *           aName,
-                                const char *           aType,
-                                const char *           aDomain,
-                                AvahiLookupResultFlags aFlags);
+        void Release(void);
+        void Resolve(AvahiIfIndex aInterfaceIndex, const char *aDomain);
 
         static void HandleResolveResult(AvahiServiceResolver * aServiceResolver,
                                         AvahiIfIndex           aInterfaceIndex,
@@ -453,11 +457,63 @@ private:
                                  AvahiStringList *      aTxt,
                                  AvahiLookupResultFlags aFlags);
 
+        PublisherAvahi *       mPublisherAvahi;
         std::string            mType;
         std::string            mInstanceName;
         DiscoveredInstanceInfo mInstanceInfo;
-        AvahiServiceBrowser *  mServiceBrowser;
         AvahiServiceResolver * mServiceResolver;
+        bool                   mResolved;
+    };
+
+    typedef std::pair<std::string, std::string>           ServiceKey; ///< (type, instance name)
+    typedef SubscriptionPool<ServiceKey, ServiceResolver> ServiceResolverPool;
+
+    struct ServiceSubscription : public Subscription
+    {
+        explicit ServiceSubscription(PublisherAvahi &aPublisherAvahi, std::string aType, std::string aInstanceName)
+            : Subscription(aPublisherAvahi)
+            , mType(std::move(aType))
+            , mInstanceName(std::move(aInstanceName))
+            , mServiceBrowser(nullptr)
+        {
+        }
+
+        void Release(void);
+        void Browse(void);
+        void AddInstance(AvahiIfIndex aInterfaceIndex, const char *aInstanceName, const char *aDomain);
+        void RemoveInstance(const char *aInstanceName);
+
+        static void HandleBrowseResult(AvahiServiceBrowser *  aServiceBrowser,
+                                       AvahiIfIndex           aInterfaceIndex,
+                                       AvahiProtocol          aProtocol,
+                                       AvahiBrowserEvent      aEvent,
+                                       const char *           aName,
+                                       const char *           aType,
+                                       const char *           aDomain,
+                                       AvahiLookupResultFlags aFlags,
+                                       void *                 aContext);
+
+        void HandleBrowseResult(AvahiServiceBrowser *  aServiceBrowser,
+                                AvahiIfIndex           aInterfaceIndex,
+                                AvahiProtocol          aProtocol,
+                                AvahiBrowserEvent      aEvent,
+                                const char *           aName,
+                                const char *           aType,
+                                const char *           aDomain,
+                                AvahiLookupResultFlags aFlags);
+
+        std::string          mType;
+        std::string          mInstanceName;
+        AvahiServiceBrowser *mServiceBrowser;
+
+        struct Instance
+        {
+            uint32_t                    mInterfaceCount; ///< The number of interfaces the instance is seen on.
+            ServiceResolverPool::Handle mResolver;
+        };
+
+        // The browsed instances, or the subscribed instance if `mInstanceName` isn't empty.
+        std::map<std::string, Instance> mInstances;
     };
 
     struct HostSubscription : public Subscription
@@ -499,9 +555,9 @@ private:
         AvahiRecordBrowser *mRecordBrowser;
     };
 
-    typedef std::vector<Host>                Hosts;
-    typedef std::vector<ServiceSubscription> ServiceSubscriptionList;
-    typedef std::vector<HostSubscription>    HostSubscriptionList;
+    typedef std::vector<Host>                                 Hosts;
+    typedef SubscriptionPool<ServiceKey, ServiceSubscription> ServiceSubscriptionPool;
+    typedef SubscriptionPool<std::string, HostSubscription>   HostSubscriptionPool;
 
     static void HandleClientState(AvahiClient *aClient, AvahiClientState aState, void *aContext);
     void        HandleClientState(AvahiClient *aClient, AvahiClientState aState);
@@ -522,11 +578,24 @@ private:
     static void      HandleGroupState(AvahiEntryGroup *aGroup, AvahiEntryGroupState aState, void *aContext);
     void             HandleGroupState(AvahiEntryGroup *aGroup, AvahiEntryGroupState aState);
     void             CallHostOrServiceCallback(AvahiEntryGroup *aGroup, otbrError aError) const;
+    bool             RenameHostOrService(AvahiEntryGroup *aGroup);
+
+    static otbrError MakeTxtStringList(const TxtList &aTxtList, TxtBuffer &aBuffer, AvahiStringList *&aHead);
+    otbrError        AddService(const Service &aService);
+    otbrError        AddHost(const Host &aHost);
 
     std::string MakeFullName(const char *aName);
 
-    void        OnServiceResolved(ServiceSubscription &aService);
-    static void OnServiceResolveFailed(const ServiceSubscription &aService, int aErrorCode);
+    ServiceResolverPool::Handle AcquireServiceResolver(const std::string &aType,
+                                                       const std::string &aInstanceName,
+                                                       AvahiIfIndex       aInterfaceIndex,
+                                                       const char *       aDomain);
+    void                        ReleaseServiceResolver(ServiceResolverPool::Handle aResolver);
+
+    void        OnServiceResolved(const ServiceResolver &aResolver);
+    void        ReportResolvedService(const std::string &aType, const std::string &aInstanceName);
+    void        OnServiceRemoved(const std::string &aType, const std::string &aInstanceName);
+    static void OnServiceResolveFailed(const std::string &aType, const std::string &aInstanceName, int aErrorCode);
     void        OnHostResolved(HostSubscription &aHost);
     void        OnHostResolveFailed(const HostSubscription &aHost, int aErrorCode);
 
@@ -534,14 +603,17 @@ private:
     Hosts        mHosts;
     Services     mServices;
     Poller       mPoller;
+    TaskRunner   mTaskRunner;
     int          mProtocol;
+    AvahiIfIndex mInterfaceIndex;
     const char * mDomain;
     State        mState;
     StateHandler mStateHandler;
     void *       mContext;
 
-    ServiceSubscriptionList mSubscribedServices;
-    HostSubscriptionList    mSubscribedHosts;
+    ServiceSubscriptionPool mSubscribedServices;
+    ServiceResolverPool     mServiceResolvers;
+    HostSubscriptionPool    mSubscribedHosts;
 };
 
 } // namespace Mdns
@@ -208,14 +208,19 @@ static const char *DNSErrorToString(DNSServiceErrorType aError)
     }
 }
 
-PublisherMDnsSd::PublisherMDnsSd(int aProtocol, const char *aDomain, StateHandler aHandler, void *aContext)
+PublisherMDnsSd::PublisherMDnsSd(int          aProtocol,
+                                 const char * aDomain,
+                                 StateHandler aHandler,
+                                 void *       aContext,
+                                 uint32_t     aInterfaceIndex)
     : mHostsRef(nullptr)
+    , mProtocol(aProtocol)
+    , mInterfaceIndex(aInterfaceIndex)
     , mDomain(aDomain)
     , mState(State::kIdle)
     , mStateHandler(aHandler)
     , mContext(aContext)
 {
-    OTBR_UNUSED_VARIABLE(aProtocol);
 }
 
 PublisherMDnsSd::~PublisherMDnsSd(void)
@@ -285,29 +290,19 @@ void PublisherMDnsSd::Update(MainloopContext &aMainloop)
         aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, fd);
     }
 
-    for (Subscription &subscription : mSubscribedServices)
-    {
-        if (subscription.mServiceRef != nullptr)
+    auto updateSubscription = [&aMainloop](Subscription &aSubscription) {
+        if (aSubscription.mServiceRef != nullptr)
         {
-            int fd = DNSServiceRefSockFD(subscription.mServiceRef);
+            int fd = DNSServiceRefSockFD(aSubscription.mServiceRef);
             assert(fd != -1);
 
             FD_SET(fd, &aMainloop.mReadFdSet);
             aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, fd);
         }
-    }
-
-    for (Subscription &subscription : mSubscribedHosts)
-    {
-        if (subscription.mServiceRef != nullptr)
-        {
-            int fd = DNSServiceRefSockFD(subscription.mServiceRef);
-            assert(fd != -1);
+    };
 
-            FD_SET(fd, &aMainloop.mReadFdSet);
-            aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, fd);
-        }
-    }
+    mSubscribedServices.ForEach(updateSubscription);
+    mSubscribedHosts.ForEach(updateSubscription);
 }
 
 void PublisherMDnsSd::Process(const MainloopContext &aMainloop)
@@ -334,33 +329,21 @@ void PublisherMDnsSd::Process(const MainloopContext &aMainloop)
         }
     }
 
-    for (Subscription &subscription : mSubscribedServices)
-    {
-        if (subscription.mServiceRef != nullptr)
+    auto processSubscription = [&aMainloop, &readyServices](Subscription &aSubscription) {
+        if (aSubscription.mServiceRef != nullptr)
         {
-            int fd = DNSServiceRefSockFD(subscription.mServiceRef);
+            int fd = DNSServiceRefSockFD(aSubscription.mServiceRef);
             assert(fd != -1);
 
             if (FD_ISSET(fd, &aMainloop.mReadFdSet))
             {
-                readyServices.push_back(subscription.mServiceRef);
+                readyServices.push_back(aSubscription.mServiceRef);
             }
         }
-    }
+    };
 
-    for (Subscription &service : mSubscribedHosts)
-    {
-        if (service.mServiceRef != nullptr)
-        {
-            int fd = DNSServiceRefSockFD(service.mServiceRef);
-            assert(fd != -1);
-
-            if (FD_ISSET(fd, &aMainloop.mReadFdSet))
-            {
-                readyServices.push_back(service.mServiceRef);
-            }
-        }
-    }
+    mSubscribedServices.ForEach(processSubscription);
+    mSubscribedHosts.ForEach(processSubscription);
 
     for (DNSServiceRef serviceRef : readyServices)
     {
@@ -407,9 +390,15 @@ void PublisherMDnsSd::HandleServiceRegisterResult(DNSServiceRef         aService
 
     otbrLogInfo("Received reply for service %s.%s", originalInstanceName.c_str(), aType);
 
-    if (originalInstanceName != aName)
+    if (aError == kDNSServiceErr_NoError && service->mAdvertisedName != aName)
+    {
+        // mDNSResponder renames the service instance itself unless `kDNSServiceFlagsNoAutoRename` is set.
+        service->mAdvertisedName = aName;
+        NotifyConflict(originalInstanceName.c_str(), aType, aName);
+    }
+    else if (aError == kDNSServiceErr_NameConflict)
     {
-        otbrLogInfo("Service %s.%s renamed to %s.%s", originalInstanceName.c_str(), aType, aName, aType);
+        NotifyConflict(originalInstanceName.c_str(), aType, nullptr);
     }
 
     if (aError == kDNSServiceErr_NoError)
@@ -433,7 +422,6 @@ void PublisherMDnsSd::HandleServiceRegisterResult(DNSServiceRef         aService
 
     if (mServiceHandler != nullptr)
     {
-        // TODO: pass the renewed service instance name back to SRP server handler.
         mServiceHandler(originalInstanceName.c_str(), aType, error, mServiceHandlerContext);
     }
 
@@ -469,7 +457,8 @@ void PublisherMDnsSd::RecordService(const char *aName, const char *aType, DNSSer
 
         strcpy(newService.mName, aName);
         strcpy(newService.mType, aType);
-        newService.mService = aServiceRef;
+        newService.mAdvertisedName = aName;
+        newService.mService        = aServiceRef;
         mServices.push_back(newService);
     }
     else
@@ -478,6 +467,33 @@ void PublisherMDnsSd::RecordService(const char *aName, const char *aType, DNSSer
     }
 }
 
+DNSServiceErrorType PublisherMDnsSd::RegisterService(Service &aService)
+{
+    DNSServiceErrorType error    = kDNSServiceErr_NoError;
+    const char *        hostName = nullptr;
+    DNSServiceFlags     flags    = (mConflictPolicy == ConflictPolicy::kRename) ? 0 : kDNSServiceFlagsNoAutoRename;
+    char                fullHostName[kMaxSizeOfDomain];
+
+    if (!aService.mHostName.empty())
+    {
+        HostIterator host = FindPublishedHost(aService.mHostName.c_str());
+
+        // A renamed host is the target under its alternative name.
+        VerifyOrExit(host != mHosts.end(), error = kDNSServiceErr_BadParam);
+        VerifyOrExit(MakeFullName(fullHostName, sizeof(fullHostName), host->mAdvertisedName.c_str()) == OTBR_ERROR_NONE,
+                     error = kDNSServiceErr_BadParam);
+        hostName = fullHostName;
+    }
+
+    // A renamed service is registered under its alternative name again.
+    error = DNSServiceRegister(&aService.mService, flags, mInterfaceIndex, aService.mAdvertisedName.c_str(),
+                               aService.mType, mDomain, hostName, htons(aService.mPort), aService.mTxtData.size(),
+                               aService.mTxtData.data(), HandleServiceRegisterResult, this);
+
+exit:
+    return error;
+}
+
 otbrError PublisherMDnsSd::PublishService(const char *   aHostName,
                                           uint16_t       aPort,
                                           const char *   aName,
@@ -487,10 +503,8 @@ otbrError PublisherMDnsSd::PublishService(const char *   aHostName,
     otbrError       ret   = OTBR_ERROR_NONE;
     int             error = 0;
     uint8_t         txt[kMaxSizeOfTxtRecord];
-    uint16_t        txtLength  = sizeof(txt);
-    ServiceIterator service    = FindPublishedService(aName, aType);
-    DNSServiceRef   serviceRef = nullptr;
-    char            fullHostName[kMaxSizeOfDomain];
+    uint16_t        txtLength = sizeof(txt);
+    ServiceIterator service   = FindPublishedService(aName, aType);
 
     if (aHostName != nullptr)
     {
@@ -498,7 +512,6 @@ otbrError PublisherMDnsSd::PublishService(const char *   aHostName,
 
         // Make sure that the host has been published.
         VerifyOrExit(host != mHosts.end(), ret = OTBR_ERROR_INVALID_ARGS);
-        SuccessOrExit(error = MakeFullName(fullHostName, sizeof(fullHostName), aHostName));
     }
 
     SuccessOrExit(ret = EncodeTxtData(aTxtList, txt, txtLength));
@@ -509,6 +522,7 @@ otbrError PublisherMDnsSd::PublishService(const char *   aHostName,
 
         // Setting TTL to 0 to use default value.
         SuccessOrExit(error = DNSServiceUpdateRecord(service->mService, nullptr, 0, txtLength, txt, /* ttl */ 0));
+        service->mTxtData.assign(txt, txt + txtLength);
 
         if (mServiceHandler != nullptr)
         {
@@ -517,10 +531,18 @@ otbrError PublisherMDnsSd::PublishService(const char *   aHostName,
     }
     else
     {
-        SuccessOrExit(error = DNSServiceRegister(&serviceRef, /* flags */ 0, kDNSServiceInterfaceIndexAny, aName, aType,
-                                                 mDomain, (aHostName != nullptr) ? fullHostName : nullptr, htons(aPort),
-                                                 txtLength, txt, HandleServiceRegisterResult, this));
-        RecordService(aName, aType, serviceRef);
+        Service newService;
+
+        strcpy(newService.mName, aName);
+        strcpy(newService.mType, aType);
+        newService.mHostName       = (aHostName != nullptr) ? aHostName : "";
+        newService.mPort           = aPort;
+        newService.mAdvertisedName = aName;
+        newService.mTxtData.assign(txt, txt + txtLength);
+        SuccessOrExit(error = RegisterService(newService));
+
+        otbrLogInfo("Add service: %s.%s (ref: %p)", aName, aType, newService.mService);
+        mServices.push_back(std::move(newService));
     }
 
 exit:
@@ -588,7 +610,8 @@ void PublisherMDnsSd::RecordHost(const char *   aName,
 
         strcpy(newHost.mName, aName);
         std::copy(aAddress, aAddress + aAddressLength, newHost.mAddress.begin());
-        newHost.mRecord = aRecordRef;
+        newHost.mAdvertisedName = aName;
+        newHost.mRecord         = aRecordRef;
         mHosts.push_back(newHost);
     }
     else
@@ -635,10 +658,10 @@ otbrError PublisherMDnsSd::PublishHost(const char *aName, const uint8_t *aAddres
         DNSRecordRef record;
 
         otbrLogInfo("Publish new host %s", aName);
-        SuccessOrExit(error = DNSServiceRegisterRecord(mHostsRef, &record, kDNSServiceFlagsUnique,
-                                                       kDNSServiceInterfaceIndexAny, fullName, kDNSServiceType_AAAA,
-                                                       kDNSServiceClass_IN, aAddressLength, aAddress, /* ttl */ 0,
-                                                       HandleRegisterHostResult, this));
+        SuccessOrExit(error = DNSServiceRegisterRecord(mHostsRef, &record, kDNSServiceFlagsUnique, mInterfaceIndex,
+                                                       fullName, kDNSServiceType_AAAA, kDNSServiceClass_IN,
+                                                       aAddressLength, aAddress, /* ttl */ 0, HandleRegisterHostResult,
+                                                       this));
         RecordHost(aName, aAddress, aAddressLength, record);
     }
 
@@ -697,6 +720,8 @@ void PublisherMDnsSd::HandleRegisterHostResult(DNSServiceRef       aHostsConnect
         otbrLogWarning("failed to register host %s for mdnssd error: %s", hostName.c_str(),
                        DNSErrorToString(aErrorCode));
 
+        // A renamed host reports the result of registering its alternative name instead.
+        VerifyOrExit(aErrorCode != kDNSServiceErr_NameConflict || !RenameHost(*host));
         DiscardHost(hostName.c_str(), /* aSendGoodbye */ false);
     }
 
@@ -709,6 +734,66 @@ exit:
     return;
 }
 
+bool PublisherMDnsSd::RenameHost(Host &aHost)
+{
+    bool                                             renamed = false;
+    std::string                                      newName;
+    char                                             fullName[kMaxSizeOfDomain];
+    DNSRecordRef                                     record;
+    std::vector<std::pair<std::string, std::string>> failedServices;
+
+    VerifyOrExit(ResolveConflict(aHost.mName, nullptr, aHost.mRenameCount, newName));
+    SuccessOrExit(MakeFullName(fullName, sizeof(fullName), newName.c_str()));
+    SuccessOrExit(DNSServiceRegisterRecord(mHostsRef, &record, kDNSServiceFlagsUnique, mInterfaceIndex, fullName,
+                                           kDNSServiceType_AAAA, kDNSServiceClass_IN, aHost.mAddress.size(),
+                                           &aHost.mAddress.front(), /* ttl */ 0, HandleRegisterHostResult, this));
+
+    // The conflicting record stays allocated on the connection until it is removed.
+    DNSServiceRemoveRecord(mHostsRef, aHost.mRecord, /* flags */ 0);
+
+    aHost.mRecord         = record;
+    aHost.mAdvertisedName = newName;
+    renamed               = true;
+
+    // Services on the host follow it to its alternative name.
+    for (ServiceIterator service = mServices.begin(); service != mServices.end();)
+    {
+        DNSServiceErrorType error;
+
+        if (service->mHostName != aHost.mName)
+        {
+            ++service;
+            continue;
+        }
+
+        DNSServiceRefDeallocate(service->mService);
+        error = RegisterService(*service);
+
+        if (error == kDNSServiceErr_NoError)
+        {
+            ++service;
+        }
+        else
+        {
+            otbrLogErr("Failed to register service %s.%s: %s", service->mName, service->mType, DNSErrorToString(error));
+            failedServices.emplace_back(service->mName, service->mType);
+            service = mServices.erase(service);
+        }
+    }
+
+    // The handler may publish or unpublish, so it is only called once the services are no longer iterated.
+    if (mServiceHandler != nullptr)
+    {
+        for (const auto &service : failedServices)
+        {
+            mServiceHandler(service.first.c_str(), service.second.c_str(), OTBR_ERROR_MDNS, mServiceHandlerContext);
+        }
+    }
+
+exit:
+    return renamed;
+}
+
 otbrError PublisherMDnsSd::MakeFullName(char *aFullName, size_t aFullNameLength, const char *aName)
 {
     otbrError   error      = OTBR_ERROR_NONE;
@@ -728,6 +813,11 @@ exit:
     return error;
 }
 
+DNSServiceProtocol PublisherMDnsSd::GetAddrInfoProtocol(void) const
+{
+    return mProtocol == AF_INET6 ? kDNSServiceProtocol_IPv6 : kDNSServiceProtocol_IPv6 | kDNSServiceProtocol_IPv4;
+}
+
 PublisherMDnsSd::ServiceIterator PublisherMDnsSd::FindPublishedService(const char *aName, const char *aType)
 {
     return std::find_if(mServices.begin(), mServices.end(), [&aName, aType](const Service &service) {
@@ -755,37 +845,46 @@ PublisherMDnsSd::HostIterator PublisherMDnsSd::FindPublishedHost(const char *aHo
 
 void PublisherMDnsSd::SubscribeService(const std::string &aType, const std::string &aInstanceName)
 {
-    mSubscribedServices.emplace_back(*this, aType, aInstanceName);
+    bool                            isNew;
+    ServiceSubscriptionPool::Handle handle;
+
+    handle = mSubscribedServices.Acquire(
+        ServiceKey(aType, aInstanceName), [&]() { return new ServiceSubscription(*this, aType, aInstanceName); },
+        isNew);
 
-    otbrLogInfo("subscribe service %s.%s (total %zu)", aInstanceName.c_str(), aType.c_str(),
-                mSubscribedServices.size());
+    otbrLogInfo("subscribe service %s.%s (total %zu, references %u)", aInstanceName.c_str(), aType.c_str(),
+                mSubscribedServices.GetSize(), ServiceSubscriptionPool::GetRefCount(handle));
+
+    VerifyOrExit(isNew);
 
     if (aInstanceName.empty())
     {
-        mSubscribedServices.back().Browse();
+        ServiceSubscriptionPool::Get(handle).Browse();
     }
     else
     {
-        mSubscribedServices.back().Resolve(kDNSServiceInterfaceIndexAny, aInstanceName.c_str(), aType.c_str(),
-                                           "local.");
+        ServiceSubscriptionPool::Get(handle).Resolve(mInterfaceIndex, aInstanceName.c_str(), aType.c_str(), "local.");
     }
+
+exit:
+    return;
 }
 
 void PublisherMDnsSd::UnsubscribeService(const std::string &aType, const std::string &aInstanceName)
 {
-    ServiceSubscriptionList::iterator it =
-        std::find_if(mSubscribedServices.begin(), mSubscribedServices.end(),
-                     [&aType, &aInstanceName](const ServiceSubscription &aService) {
-                         return aService.mType == aType && aService.mInstanceName == aInstanceName;
-                     });
+    ServiceSubscriptionPool::Handle      handle = mSubscribedServices.Find(ServiceKey(aType, aInstanceName));
+    std::unique_ptr<ServiceSubscription> service;
 
-    assert(it != mSubscribedServices.end());
+    assert(mSubscribedServices.IsValid(handle));
 
-    it->Release();
-    mSubscribedServices.erase(it);
+    service = mSubscribedServices.Release(handle);
+    if (service != nullptr)
+    {
+        service->Release();
+    }
 
     otbrLogInfo("unsubscribe service %s.%s (left %zu)", aInstanceName.c_str(), aType.c_str(),
-                mSubscribedServices.size());
+                mSubscribedServices.GetSize());
 }
 
 void PublisherMDnsSd::OnServiceResolved(PublisherMDnsSd::ServiceSubscription &aService)
@@ -824,30 +923,43 @@ void PublisherMDnsSd::OnHostResolveFailed(const PublisherMDnsSd::HostSubscriptio
 
 void PublisherMDnsSd::SubscribeHost(const std::string &aHostName)
 {
-    mSubscribedHosts.emplace_back(*this, aHostName);
+    bool                         isNew;
+    HostSubscriptionPool::Handle handle;
+
+    handle = mSubscribedHosts.Acquire(aHostName, [&]() { return new HostSubscription(*this, aHostName); }, isNew);
 
-    otbrLogInfo("subscribe host %s (total %zu)", aHostName.c_str(), mSubscribedHosts.size());
+    otbrLogInfo("subscribe host %s (total %zu, references %u)", aHostName.c_str(), mSubscribedHosts.GetSize(),
+                HostSubscriptionPool::GetRefCount(handle));
 
-    mSubscribedHosts.back().Resolve();
+    if (isNew)
+    {
+        HostSubscriptionPool::Get(handle).Resolve();
+    }
 }
 
 void PublisherMDnsSd::UnsubscribeHost(const std::string &aHostName)
 {
-    HostSubscriptionList ::iterator it =
-        std::find_if(mSubscribedHosts.begin(), mSubscribedHosts.end(),
-                     [&aHostName](const HostSubscription &aHost) { return aHost.mHostName == aHostName; });
+    HostSubscriptionPool::Handle      handle = mSubscribedHosts.Find(aHostName);
+    std::unique_ptr<HostSubscription> host;
 
-    assert(it != mSubscribedHosts.end());
+    assert(mSubscribedHosts.IsValid(handle));
 
-    it->Release();
-    mSubscribedHosts.erase(it);
+    host = mSubscribedHosts.Release(handle);
+    if (host != nullptr)
+    {
+        host->Release();
+    }
 
-    otbrLogInfo("unsubscribe host %s (remaining %d)", aHostName.c_str(), mSubscribedHosts.size());
+    otbrLogInfo("unsubscribe host %s (remaining %zu)", aHostName.c_str(), mSubscribedHosts.GetSize());
 }
 
-Publisher *Publisher::Create(int aFamily, const char *aDomain, StateHandler aHandler, void *aContext)
+Publisher *Publisher::Create(int          aFamily,
+                             const char * aDomain,
+                             StateHandler aHandler,
+                             void *       aContext,
+                             uint32_t     aInterfaceIndex)
 {
-    return new PublisherMDnsSd(aFamily, aDomain, aHandler, aContext);
+    return new PublisherMDnsSd(aFamily, aDomain, aHandler, aContext, aInterfaceIndex);
 }
 
 void Publisher::Destroy(Publisher *aPublisher)
@@ -874,7 +986,7 @@ void PublisherMDnsSd::ServiceSubscription::Browse(void)
     assert(mServiceRef == nullptr);
 
     otbrLogInfo("DNSServiceBrowse %s", mType.c_str());
-    DNSServiceBrowse(&mServiceRef, /* flags */ kDNSServiceFlagsTimeout, kDNSServiceInterfaceIndexAny, mType.c_str(),
+    DNSServiceBrowse(&mServiceRef, /* flags */ kDNSServiceFlagsTimeout, mMDnsSd->mInterfaceIndex, mType.c_str(),
                      /* domain */ nullptr, HandleBrowseResult, this);
 }
 
@@ -999,9 +1111,8 @@ void PublisherMDnsSd::ServiceSubscription::GetAddrInfo(uint32_t aInterfaceIndex)
 
     otbrLogInfo("DNSServiceGetAddrInfo %s inf %d", mInstanceInfo.mHostName.c_str(), aInterfaceIndex);
 
-    DNSServiceGetAddrInfo(&mServiceRef, /* flags */ 0, aInterfaceIndex,
-                          kDNSServiceProtocol_IPv6 | kDNSServiceProtocol_IPv4, mInstanceInfo.mHostName.c_str(),
-                          HandleGetAddrInfoResult, this);
+    DNSServiceGetAddrInfo(&mServiceRef, /* flags */ 0, aInterfaceIndex, mMDnsSd->GetAddrInfoProtocol(),
+                          mInstanceInfo.mHostName.c_str(), HandleGetAddrInfoResult, this);
 }
 
 void PublisherMDnsSd::ServiceSubscription::HandleGetAddrInfoResult(DNSServiceRef          aServiceRef,
@@ -1038,12 +1149,12 @@ void PublisherMDnsSd::ServiceSubscription::HandleGetAddrInfoResult(DNSServiceRef
 
     address.CopyFrom(*reinterpret_cast<const struct sockaddr_in6 *>(aAddress));
     VerifyOrExit(!address.IsUnspecified() && !address.IsLinkLocal() && !address.IsMulticast() && !address.IsLoopback(),
-                 otbrLogDebug("DNSServiceGetAddrInfo ignores address %s", address.ToString().c_str()));
+                 otbrLogDebug("DNSServiceGetAddrInfo ignores address %s", Ip6AddressString(address).AsCString()));
 
     mInstanceInfo.mAddresses.push_back(address);
     mInstanceInfo.mTtl = aTtl;
 
-    otbrLogDebug("DNSServiceGetAddrInfo reply: address=%s, ttl=%u", address.ToString().c_str(), aTtl);
+    otbrLogDebug("DNSServiceGetAddrInfo reply: address=%s, ttl=%u", Ip6AddressString(address).AsCString(), aTtl);
 
     mMDnsSd->OnServiceResolved(*this);
 
@@ -1068,11 +1179,10 @@ void PublisherMDnsSd::HostSubscription::Resolve(void)
 
     assert(mServiceRef == nullptr);
 
-    otbrLogDebug("DNSServiceGetAddrInfo %s inf %d", fullHostName.c_str(), kDNSServiceInterfaceIndexAny);
+    otbrLogDebug("DNSServiceGetAddrInfo %s inf %u", fullHostName.c_str(), mMDnsSd->mInterfaceIndex);
 
-    DNSServiceGetAddrInfo(&mServiceRef, /* flags */ 0, kDNSServiceInterfaceIndexAny,
-                          kDNSServiceProtocol_IPv6 | kDNSServiceProtocol_IPv4, fullHostName.c_str(),
-                          HandleResolveResult, this);
+    DNSServiceGetAddrInfo(&mServiceRef, /* flags */ 0, mMDnsSd->mInterfaceIndex, mMDnsSd->GetAddrInfoProtocol(),
+                          fullHostName.c_str(), HandleResolveResult, this);
 }
 
 void PublisherMDnsSd::HostSubscription::HandleResolveResult(DNSServiceRef          aServiceRef,
@@ -1108,14 +1218,14 @@ void PublisherMDnsSd::HostSubscription::HandleResolveResult(DNSServiceRef
     VerifyOrExit((aFlags & kDNSServiceFlagsAdd) && aAddress->sa_family == AF_INET6);
 
     address.CopyFrom(*reinterpret_cast<const struct sockaddr_in6 *>(aAddress));
-    VerifyOrExit(!address.IsLinkLocal(),
-                 otbrLogDebug("DNSServiceGetAddrInfo ignore link-local address %s", address.ToString().c_str()));
+    VerifyOrExit(!address.IsLinkLocal(), otbrLogDebug("DNSServiceGetAddrInfo ignore link-local address %s",
+                                                      Ip6AddressString(address).AsCString()));
 
     mHostInfo.mHostName = aHostName;
     mHostInfo.mAddresses.push_back(address);
     mHostInfo.mTtl = aTtl;
 
-    otbrLogDebug("DNSServiceGetAddrInfo reply: address=%s, ttl=%u", address.ToString().c_str(), aTtl);
+    otbrLogDebug("DNSServiceGetAddrInfo reply: address=%s, ttl=%u", Ip6AddressString(address).AsCString(), aTtl);
 
     mMDnsSd->OnHostResolved(*this);
 
@@ -45,6 +45,7 @@
 #include "common/code_utils.hpp"
 #include "common/types.hpp"
 #include "mdns/mdns.hpp"
+#include "mdns/subscription_pool.hpp"
 
 namespace otbr {
 
@@ -60,13 +61,21 @@ public:
     /**
      * The constructor to initialize a Publisher.
      *
+     * The mDNSResponder API cannot restrict a registration to one address family, so @p aProtocol only limits the
+     * address lookups of subscriptions. Registrations are advertised by the daemon over both IPv4 and IPv6.
+     *
      * @param[in]   aProtocol           The protocol used for publishing. IPv4, IPv6 or both.
      * @param[in]   aDomain             The domain of the host. nullptr to use default.
      * @param[in]   aHandler            The function to be called when state changes.
      * @param[in]   aContext            A pointer to application-specific context.
+     * @param[in]   aInterfaceIndex     The network interface to publish and browse on, or 0 for all interfaces.
      *
      */
-    PublisherMDnsSd(int aProtocol, const char *aDomain, StateHandler aHandler, void *aContext);
+    PublisherMDnsSd(int          aProtocol,
+                    const char * aDomain,
+                    StateHandler aHandler,
+                    void *       aContext,
+                    uint32_t     aInterfaceIndex);
 
     ~PublisherMDnsSd(void) override;
 
@@ -235,15 +244,21 @@ private:
 
     struct Service
     {
-        char          mName[kMaxSizeOfServiceName];
-        char          mType[kMaxSizeOfServiceType];
-        DNSServiceRef mService;
+        char                 mName[kMaxSizeOfServiceName];
+        char                 mType[kMaxSizeOfServiceType];
+        std::string          mHostName; // The requested host name, or empty for the local host.
+        uint16_t             mPort = 0;
+        std::vector<uint8_t> mTxtData;
+        std::string          mAdvertisedName; // The instance name registered, which may be renamed by mDNSResponder.
+        DNSServiceRef        mService;
     };
 
     struct Host
     {
         char                                       mName[kMaxSizeOfServiceName];
         std::array<uint8_t, OTBR_IP6_ADDRESS_SIZE> mAddress;
+        std::string                                mAdvertisedName; // The host name registered, renamed on conflicts.
+        uint8_t                                    mRenameCount = 0;
         DNSRecordRef                               mRecord;
     };
 
@@ -359,18 +374,22 @@ private:
         DiscoveredHostInfo mHostInfo;
     };
 
-    typedef std::vector<Service>             Services;
-    typedef std::vector<Host>                Hosts;
-    typedef std::vector<Service>::iterator   ServiceIterator;
-    typedef std::vector<Host>::iterator      HostIterator;
-    typedef std::vector<ServiceSubscription> ServiceSubscriptionList;
-    typedef std::vector<HostSubscription>    HostSubscriptionList;
+    typedef std::vector<Service>                              Services;
+    typedef std::vector<Host>                                 Hosts;
+    typedef std::vector<Service>::iterator                    ServiceIterator;
+    typedef std::vector<Host>::iterator                       HostIterator;
+    typedef std::pair<std::string, std::string>               ServiceKey; ///< (type, instance name)
+    typedef SubscriptionPool<ServiceKey, ServiceSubscription> ServiceSubscriptionPool;
+    typedef SubscriptionPool<std::string, HostSubscription>   HostSubscriptionPool;
 
     void DiscardService(const char *aName, const char *aType, DNSServiceRef aServiceRef = nullptr);
     void RecordService(const char *aName, const char *aType, DNSServiceRef aServiceRef);
 
+    DNSServiceErrorType RegisterService(Service &aService);
+
     otbrError DiscardHost(const char *aName, bool aSendGoodbye = true);
     void      RecordHost(const char *aName, const uint8_t *aAddress, uint8_t aAddressLength, DNSRecordRef aRecordRef);
+    bool      RenameHost(Host &aHost);
 
     static void HandleServiceRegisterResult(DNSServiceRef         aService,
                                             const DNSServiceFlags aFlags,
@@ -395,7 +414,8 @@ private:
                                          DNSServiceFlags     aFlags,
                                          DNSServiceErrorType aErrorCode);
 
-    otbrError MakeFullName(char *aFullName, size_t aFullNameLength, const char *aName);
+    otbrError          MakeFullName(char *aFullName, size_t aFullNameLength, const char *aName);
+    DNSServiceProtocol GetAddrInfoProtocol(void) const;
 
     ServiceIterator FindPublishedService(const char *aName, const char *aType);
     ServiceIterator FindPublishedService(const DNSServiceRef &aServiceRef);
@@ -410,13 +430,15 @@ private:
     Services      mServices;
     Hosts         mHosts;
     DNSServiceRef mHostsRef;
+    int           mProtocol;
+    uint32_t      mInterfaceIndex;
     const char *  mDomain;
     State         mState;
     StateHandler  mStateHandler;
     void *        mContext;
 
-    ServiceSubscriptionList mSubscribedServices;
-    HostSubscriptionList    mSubscribedHosts;
+    ServiceSubscriptionPool mSubscribedServices;
+    HostSubscriptionPool    mSubscribedHosts;
 };
 
 /**
@@ -0,0 +1,2647 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements mDNS service with a native mDNS responder.
+ */
+
+#define OTBR_LOG_TAG "MDNS"
+
+#include "mdns/mdns_native.hpp"
+
+#include <algorithm>
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <ifaddrs.h>
+#include <limits.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "utils/socket_utils.hpp"
+
+namespace otbr {
+
+namespace Mdns {
+
+// See RFC 6762, sections 5.2, 6, 8.1, 8.3 and 10.
+static constexpr Milliseconds kProbeInterval        = Milliseconds(250);
+static constexpr Milliseconds kProbeConflictDelay   = Milliseconds(1000);
+static constexpr Milliseconds kAnnounceInterval     = Milliseconds(1000);
+static constexpr Milliseconds kMinMulticastInterval = Milliseconds(1000);
+static constexpr Milliseconds kInitialQueryInterval = Milliseconds(1000);
+static constexpr Milliseconds kMaxQueryInterval     = Milliseconds(3600 * 1000);
+static constexpr Milliseconds kResolveDelay         = Milliseconds(20);
+static constexpr Milliseconds kCacheFlushDelay      = Milliseconds(1000);
+
+enum : uint8_t
+{
+    kProbeCount      = 3,
+    kAnnounceCount   = 2,
+    kMaxRefreshCount = 2,  // Refresh queries are sent at 80% and 90% of the TTL.
+    kMaxReceiveBurst = 16, // The maximum number of messages received per mainloop iteration.
+    kSrvTargetOffset = 6,  // The priority, weight and port precede the target in SRV record data.
+};
+
+enum : uint32_t
+{
+    kHostTtl    = 120,  // The TTL of records with a host name.
+    kDefaultTtl = 4500, // The TTL of other records.
+    kLegacyTtl  = 10,   // The maximum TTL of responses to legacy unicast queries.
+};
+
+static const uint8_t  kMulticastAddress6[] = {0xff, 0x02, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xfb};
+static const uint32_t kMulticastAddress4   = 0xe00000fb; // 224.0.0.251
+static const char     kServicesName[]      = "_services._dns-sd._udp";
+
+static bool IsUsableInterface(unsigned int aFlags)
+{
+    return (aFlags & (IFF_UP | IFF_MULTICAST | IFF_LOOPBACK)) == (IFF_UP | IFF_MULTICAST);
+}
+
+static uint32_t GetTtl(uint16_t aType)
+{
+    return (aType == kTypeSrv || aType == kTypeA || aType == kTypeAaaa) ? kHostTtl : kDefaultTtl;
+}
+
+static bool ContainsRecord(const std::vector<Record> &aRecords, const Record &aRecord)
+{
+    return std::any_of(aRecords.begin(), aRecords.end(),
+                       [&aRecord](const Record &aOther) { return aOther.IsSameAs(aRecord); });
+}
+
+static bool ContainsQuestion(const std::vector<Question> &aQuestions, const Question &aQuestion)
+{
+    return std::any_of(aQuestions.begin(), aQuestions.end(), [&aQuestion](const Question &aOther) {
+        return aOther.mType == aQuestion.mType && IsNameEqual(aOther.mName, aQuestion.mName);
+    });
+}
+
+static bool IsSameInstance(const Publisher::DiscoveredInstanceInfo &aFirst,
+                           const Publisher::DiscoveredInstanceInfo &aSecond)
+{
+    return aFirst.mHostName == aSecond.mHostName && aFirst.mPort == aSecond.mPort &&
+           aFirst.mPriority == aSecond.mPriority && aFirst.mWeight == aSecond.mWeight &&
+           aFirst.mTxtData == aSecond.mTxtData && aFirst.mAddresses == aSecond.mAddresses;
+}
+
+PublisherNative::Subscription::Subscription(void)
+    : mQueryTime(Timepoint::max())
+    , mQueryInterval(kInitialQueryInterval)
+{
+}
+
+PublisherNative::PublisherNative(int          aProtocol,
+                                 const char * aDomain,
+                                 StateHandler aHandler,
+                                 void *       aContext,
+                                 uint32_t     aInterfaceIndex)
+    : mProtocol(aProtocol)
+    , mDomain(aDomain == nullptr ? "local." : aDomain)
+    , mInterfaceIndex(aInterfaceIndex)
+    , mStateHandler(aHandler)
+    , mContext(aContext)
+    , mIsStarted(false)
+    , mStateChanged(false)
+    , mCacheChanged(false)
+    , mNetlinkFd(-1)
+    , mLocalHostEntryId(0)
+    , mNextEntryId(1)
+    , mMulticastTime(Timepoint::max())
+    , mRandom(std::random_device()())
+{
+}
+
+PublisherNative::~PublisherNative(void)
+{
+    Stop();
+}
+
+otbrError PublisherNative::Start(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    char      hostName[HOST_NAME_MAX + 1];
+
+    VerifyOrExit(!mIsStarted);
+
+    // Opened first, so that no change is missed while the interfaces and addresses are read.
+    OpenNetlink();
+    mInterfaces = FindInterfaces();
+
+    if (mProtocol != AF_INET)
+    {
+        SuccessOrExit(error = OpenSocket(AF_INET6));
+    }
+
+    if (mProtocol != AF_INET6)
+    {
+        SuccessOrExit(error = OpenSocket(AF_INET));
+    }
+
+    if (gethostname(hostName, sizeof(hostName)) != 0)
+    {
+        hostName[0] = '\0';
+    }
+    hostName[sizeof(hostName) - 1] = '\0';
+    mHostName                      = std::string(hostName, strcspn(hostName, "."));
+    if (mHostName.empty())
+    {
+        mHostName = "openthread";
+    }
+
+    mIsStarted    = true;
+    mStateChanged = true;
+
+    if (AddLocalHost() != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to publish the local host %s", mHostName.c_str());
+    }
+
+    mSubscribedServices.ForEach(
+        [this](ServiceSubscription &aSubscription) { ScheduleQuery(aSubscription, RandomDelay(20, 120)); });
+    mSubscribedHosts.ForEach(
+        [this](HostSubscription &aSubscription) { ScheduleQuery(aSubscription, RandomDelay(20, 120)); });
+
+    otbrLogInfo("Started mDNS responder on %zu interfaces as %s", mInterfaces.size(), mHostName.c_str());
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        CloseSockets();
+        CloseNetlink();
+        error = OTBR_ERROR_MDNS;
+    }
+
+    return error;
+}
+
+bool PublisherNative::IsStarted(void) const
+{
+    return mIsStarted;
+}
+
+void PublisherNative::Stop(void)
+{
+    VerifyOrExit(mIsStarted);
+
+    for (const Entry &entry : mEntries)
+    {
+        if (entry.mState != EntryState::kProbing)
+        {
+            SendGoodbyes(entry.mId);
+        }
+        else if (entry.mId != mLocalHostEntryId)
+        {
+            mResults.push_back({entry.mName, entry.mType, OTBR_ERROR_MDNS});
+        }
+    }
+    SendMulticastResponse();
+    CloseSockets();
+    CloseNetlink();
+
+    // The publications in flight are withdrawn along with the responder.
+    for (PublishResult &result : mResults)
+    {
+        if (result.mError == OTBR_ERROR_NONE)
+        {
+            result.mError = OTBR_ERROR_MDNS;
+        }
+    }
+
+    mIsStarted        = false;
+    mLocalHostEntryId = 0;
+    mEntries.clear();
+    mRecords.clear();
+    mCache.clear();
+
+    mSubscribedServices.ForEach([](ServiceSubscription &aSubscription) {
+        aSubscription.mInstances.clear();
+        aSubscription.mResolveQuestions.clear();
+        aSubscription.mQueryTime     = Timepoint::max();
+        aSubscription.mQueryInterval = kInitialQueryInterval;
+    });
+    mSubscribedHosts.ForEach([](HostSubscription &aSubscription) {
+        aSubscription.mHostInfo      = DiscoveredHostInfo();
+        aSubscription.mQueryTime     = Timepoint::max();
+        aSubscription.mQueryInterval = kInitialQueryInterval;
+    });
+
+    ReportResults();
+
+exit:
+    return;
+}
+
+std::vector<uint32_t> PublisherNative::FindInterfaces(void) const
+{
+    std::vector<uint32_t> interfaces;
+    ifaddrs *             ifAddrs = nullptr;
+
+    if (mInterfaceIndex != 0)
+    {
+        interfaces.push_back(mInterfaceIndex);
+        ExitNow();
+    }
+
+    VerifyOrExit(getifaddrs(&ifAddrs) == 0, otbrLogWarning("Failed to get interfaces: %s", strerror(errno)));
+
+    for (ifaddrs *ifAddr = ifAddrs; ifAddr != nullptr; ifAddr = ifAddr->ifa_next)
+    {
+        uint32_t index;
+
+        if (!IsUsableInterface(ifAddr->ifa_flags))
+        {
+            continue;
+        }
+
+        index = if_nametoindex(ifAddr->ifa_name);
+        if (index != 0 && std::find(interfaces.begin(), interfaces.end(), index) == interfaces.end())
+        {
+            interfaces.push_back(index);
+        }
+    }
+
+exit:
+    if (ifAddrs != nullptr)
+    {
+        freeifaddrs(ifAddrs);
+    }
+
+    return interfaces;
+}
+
+bool PublisherNative::IsInterface(uint32_t aInterfaceIndex) const
+{
+    return std::find(mInterfaces.begin(), mInterfaces.end(), aInterfaceIndex) != mInterfaces.end();
+}
+
+void PublisherNative::AddInterface(uint32_t aInterfaceIndex)
+{
+    VerifyOrExit(!IsInterface(aInterfaceIndex));
+
+    mInterfaces.push_back(aInterfaceIndex);
+
+    for (const Socket &socket : mSockets)
+    {
+        UpdateMembership(socket, aInterfaceIndex, /* aJoin */ true);
+    }
+
+    otbrLogInfo("Added interface %u", aInterfaceIndex);
+
+exit:
+    return;
+}
+
+void PublisherNative::RemoveInterface(uint32_t aInterfaceIndex)
+{
+    std::vector<HostAddress> addresses;
+
+    VerifyOrExit(IsInterface(aInterfaceIndex));
+
+    for (const LocalRecord &record : mRecords)
+    {
+        if (record.mEntryId == mLocalHostEntryId && record.mInterfaceIndex == aInterfaceIndex)
+        {
+            addresses.push_back({aInterfaceIndex, record.mRecord.mType, record.mRecord.mData});
+        }
+    }
+
+    // The interface is down or gone, so goodbyes couldn't be sent on it anyway.
+    for (const HostAddress &address : addresses)
+    {
+        RemoveLocalHostAddress(address, /* aSendGoodbye */ false);
+    }
+
+    for (const Socket &socket : mSockets)
+    {
+        UpdateMembership(socket, aInterfaceIndex, /* aJoin */ false);
+    }
+
+    mInterfaces.erase(std::find(mInterfaces.begin(), mInterfaces.end(), aInterfaceIndex));
+    otbrLogInfo("Removed interface %u", aInterfaceIndex);
+
+exit:
+    return;
+}
+
+void PublisherNative::SyncInterfaces(void)
+{
+    std::vector<uint32_t> interfaces = FindInterfaces();
+    std::vector<uint32_t> removed;
+
+    for (uint32_t index : mInterfaces)
+    {
+        if (std::find(interfaces.begin(), interfaces.end(), index) == interfaces.end())
+        {
+            removed.push_back(index);
+        }
+    }
+
+    for (uint32_t index : removed)
+    {
+        RemoveInterface(index);
+    }
+
+    for (uint32_t index : interfaces)
+    {
+        AddInterface(index);
+    }
+
+    SyncLocalHostAddresses(/* aInterfaceIndex */ 0);
+}
+
+otbrError PublisherNative::OpenSocket(int aFamily)
+{
+    otbrError error = OTBR_ERROR_ERRNO;
+    int       fd    = SocketWithCloseExec(aFamily, SOCK_DGRAM, IPPROTO_UDP, kSocketNonBlock);
+    int       on    = 1;
+    int       hops  = 255; // See RFC 6762, section 11.
+
+    VerifyOrExit(fd >= 0);
+    VerifyOrExit(setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on)) == 0);
+#ifdef SO_REUSEPORT
+    VerifyOrExit(setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &on, sizeof(on)) == 0);
+#endif
+
+    if (aFamily == AF_INET6)
+    {
+        sockaddr_in6 address;
+
+        VerifyOrExit(setsockopt(fd, IPPROTO_IPV6, IPV6_V6ONLY, &on, sizeof(on)) == 0);
+        VerifyOrExit(setsockopt(fd, IPPROTO_IPV6, IPV6_RECVPKTINFO, &on, sizeof(on)) == 0);
+        VerifyOrExit(setsockopt(fd, IPPROTO_IPV6, IPV6_MULTICAST_HOPS, &hops, sizeof(hops)) == 0);
+        VerifyOrExit(setsockopt(fd, IPPROTO_IPV6, IPV6_UNICAST_HOPS, &hops, sizeof(hops)) == 0);
+
+        memset(&address, 0, sizeof(address));
+        address.sin6_family = AF_INET6;
+        address.sin6_port   = htons(kMdnsPort);
+        VerifyOrExit(bind(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) == 0);
+
+    }
+    else
+    {
+        sockaddr_in address;
+
+        VerifyOrExit(setsockopt(fd, IPPROTO_IP, IP_PKTINFO, &on, sizeof(on)) == 0);
+        VerifyOrExit(setsockopt(fd, IPPROTO_IP, IP_MULTICAST_TTL, &hops, sizeof(hops)) == 0);
+        VerifyOrExit(setsockopt(fd, IPPROTO_IP, IP_TTL, &hops, sizeof(hops)) == 0);
+
+        memset(&address, 0, sizeof(address));
+        address.sin_family      = AF_INET;
+        address.sin_port        = htons(kMdnsPort);
+        address.sin_addr.s_addr = htonl(INADDR_ANY);
+        VerifyOrExit(bind(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) == 0);
+    }
+
+    mSockets.push_back({fd, aFamily});
+    fd    = -1;
+    error = OTBR_ERROR_NONE;
+
+    for (uint32_t index : mInterfaces)
+    {
+        UpdateMembership(mSockets.back(), index, /* aJoin */ true);
+    }
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogErr("Failed to open mDNS socket: %s", strerror(errno));
+    }
+
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    return error;
+}
+
+void PublisherNative::CloseSockets(void)
+{
+    for (const Socket &socket : mSockets)
+    {
+        close(socket.mFd);
+    }
+
+    mSockets.clear();
+}
+
+void PublisherNative::UpdateMembership(const Socket &aSocket, uint32_t aInterfaceIndex, bool aJoin)
+{
+    int rval;
+
+    if (aSocket.mFamily == AF_INET6)
+    {
+        ipv6_mreq request;
+
+        memcpy(&request.ipv6mr_multiaddr, kMulticastAddress6, sizeof(request.ipv6mr_multiaddr));
+        request.ipv6mr_interface = aInterfaceIndex;
+        rval = setsockopt(aSocket.mFd, IPPROTO_IPV6, aJoin ? IPV6_JOIN_GROUP : IPV6_LEAVE_GROUP, &request,
+                          sizeof(request));
+    }
+    else
+    {
+        ip_mreqn request;
+
+        memset(&request, 0, sizeof(request));
+        request.imr_multiaddr.s_addr = htonl(kMulticastAddress4);
+        request.imr_ifindex          = static_cast<int>(aInterfaceIndex);
+        rval = setsockopt(aSocket.mFd, IPPROTO_IP, aJoin ? IP_ADD_MEMBERSHIP : IP_DROP_MEMBERSHIP, &request,
+                          sizeof(request));
+    }
+
+    // Leaving fails when the interface is already gone, which leaves the group anyway.
+    if (rval != 0 && aJoin)
+    {
+        otbrLogWarning("Failed to join %s on interface %u: %s",
+                       aSocket.mFamily == AF_INET6 ? "ff02::fb" : "224.0.0.251", aInterfaceIndex, strerror(errno));
+    }
+}
+
+void PublisherNative::OpenNetlink(void)
+{
+    sockaddr_nl address;
+
+    mNetlinkFd = SocketWithCloseExec(AF_NETLINK, SOCK_RAW, NETLINK_ROUTE, kSocketNonBlock);
+    VerifyOrExit(mNetlinkFd >= 0);
+
+    memset(&address, 0, sizeof(address));
+    address.nl_family = AF_NETLINK;
+    address.nl_groups = RTMGRP_LINK | RTMGRP_IPV4_IFADDR | RTMGRP_IPV6_IFADDR;
+
+    if (bind(mNetlinkFd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0)
+    {
+        close(mNetlinkFd);
+        mNetlinkFd = -1;
+    }
+
+exit:
+    if (mNetlinkFd < 0)
+    {
+        otbrLogWarning("Failed to open netlink socket, address changes won't be published: %s", strerror(errno));
+    }
+}
+
+void PublisherNative::CloseNetlink(void)
+{
+    if (mNetlinkFd >= 0)
+    {
+        close(mNetlinkFd);
+        mNetlinkFd = -1;
+    }
+}
+
+void PublisherNative::ProcessNetlink(void)
+{
+    char    buffer[8192];
+    ssize_t length;
+
+    while ((length = recv(mNetlinkFd, buffer, sizeof(buffer), 0)) > 0)
+    {
+        int remaining = static_cast<int>(length);
+
+        for (nlmsghdr *header = reinterpret_cast<nlmsghdr *>(buffer); NLMSG_OK(header, remaining);
+             header = NLMSG_NEXT(header, remaining))
+        {
+            if (header->nlmsg_type == RTM_NEWLINK || header->nlmsg_type == RTM_DELLINK)
+            {
+                const ifinfomsg *info = reinterpret_cast<const ifinfomsg *>(NLMSG_DATA(header));
+
+                HandleLinkChange(static_cast<uint32_t>(info->ifi_index), info->ifi_flags,
+                                 header->nlmsg_type == RTM_DELLINK);
+            }
+            else if (header->nlmsg_type == RTM_NEWADDR || header->nlmsg_type == RTM_DELADDR)
+            {
+                const ifaddrmsg *info      = reinterpret_cast<const ifaddrmsg *>(NLMSG_DATA(header));
+                const void *     address   = nullptr;
+                int              rtaLength = static_cast<int>(IFA_PAYLOAD(header));
+
+                // A tentative address is reported again once it passed duplicate address detection.
+                if (header->nlmsg_type == RTM_NEWADDR && (info->ifa_flags & IFA_F_TENTATIVE))
+                {
+                    continue;
+                }
+
+                for (const rtattr *attr = IFA_RTA(info); RTA_OK(attr, rtaLength); attr = RTA_NEXT(attr, rtaLength))
+                {
+                    // IFA_LOCAL is the local address of a point-to-point interface, where IFA_ADDRESS is the peer.
+                    if (attr->rta_type == IFA_LOCAL || (attr->rta_type == IFA_ADDRESS && address == nullptr))
+                    {
+                        address = RTA_DATA(attr);
+                    }
+                }
+
+                if (address != nullptr)
+                {
+                    HandleAddressChange(info->ifa_index, info->ifa_family, address,
+                                        header->nlmsg_type == RTM_DELADDR || (info->ifa_flags & IFA_F_DADFAILED));
+                }
+            }
+        }
+    }
+
+    if (length < 0 && errno == ENOBUFS)
+    {
+        // Changes were lost when the socket buffer overflowed, so they are read again.
+        otbrLogWarning("Netlink socket overflowed, reading the interfaces again");
+        SyncInterfaces();
+    }
+}
+
+void PublisherNative::HandleLinkChange(uint32_t aInterfaceIndex, unsigned int aFlags, bool aIsDeleted)
+{
+    bool isUsable = !aIsDeleted && IsUsableInterface(aFlags);
+
+    // An interface given at construction is used as is.
+    VerifyOrExit(mIsStarted && mInterfaceIndex == 0 && isUsable != IsInterface(aInterfaceIndex));
+
+    if (isUsable)
+    {
+        AddInterface(aInterfaceIndex);
+        // IPv4 addresses stay on an interface while it's down, and aren't reported again when it comes up.
+        SyncLocalHostAddresses(aInterfaceIndex);
+    }
+    else
+    {
+        RemoveInterface(aInterfaceIndex);
+    }
+
+exit:
+    return;
+}
+
+void PublisherNative::HandleAddressChange(uint32_t    aInterfaceIndex,
+                                          int         aFamily,
+                                          const void *aAddress,
+                                          bool        aIsDeleted)
+{
+    HostAddress address;
+
+    VerifyOrExit(mIsStarted && IsInterface(aInterfaceIndex));
+    VerifyOrExit(MakeHostAddress(aInterfaceIndex, aFamily, aAddress, address));
+
+    if (aIsDeleted)
+    {
+        RemoveLocalHostAddress(address, /* aSendGoodbye */ true);
+    }
+    else
+    {
+        AddLocalHostAddress(address);
+    }
+
+exit:
+    return;
+}
+
+otbrError PublisherNative::AddLocalHost(void)
+{
+    otbrError   error = OTBR_ERROR_NONE;
+    std::string hostName;
+
+    SuccessOrExit(error = MakeHostName(mHostName, hostName));
+
+    mLocalHostEntryId = AddEntry(mHostName, "", hostName).mId;
+
+    if ((error = SyncLocalHostAddresses(/* aInterfaceIndex */ 0)) != OTBR_ERROR_NONE)
+    {
+        RemoveEntry(mLocalHostEntryId, /* aSendGoodbye */ false);
+        mLocalHostEntryId = 0;
+        ExitNow();
+    }
+
+    StartProbing(*FindEntry(mLocalHostEntryId), RandomDelay(0, kProbeInterval.count()));
+
+exit:
+    return error;
+}
+
+otbrError PublisherNative::SyncLocalHostAddresses(uint32_t aInterfaceIndex)
+{
+    otbrError                error   = OTBR_ERROR_NONE;
+    ifaddrs *                ifAddrs = nullptr;
+    std::vector<HostAddress> addresses;
+    std::vector<HostAddress> removed;
+
+    VerifyOrExit(getifaddrs(&ifAddrs) == 0, error = OTBR_ERROR_ERRNO);
+
+    for (ifaddrs *ifAddr = ifAddrs; ifAddr != nullptr; ifAddr = ifAddr->ifa_next)
+    {
+        const sockaddr *sockAddr = ifAddr->ifa_addr;
+        uint32_t        index    = if_nametoindex(ifAddr->ifa_name);
+        HostAddress     address;
+
+        if (sockAddr == nullptr || (aInterfaceIndex != 0 && index != aInterfaceIndex) || !IsInterface(index))
+        {
+            continue;
+        }
+
+        if ((sockAddr->sa_family == AF_INET6 &&
+             MakeHostAddress(index, AF_INET6, &reinterpret_cast<const sockaddr_in6 *>(sockAddr)->sin6_addr, address)) ||
+            (sockAddr->sa_family == AF_INET &&
+             MakeHostAddress(index, AF_INET, &reinterpret_cast<const sockaddr_in *>(sockAddr)->sin_addr, address)))
+        {
+            addresses.push_back(std::move(address));
+        }
+    }
+
+    for (const LocalRecord &record : mRecords)
+    {
+        if (record.mEntryId != mLocalHostEntryId ||
+            (aInterfaceIndex != 0 && record.mInterfaceIndex != aInterfaceIndex) ||
+            std::any_of(addresses.begin(), addresses.end(),
+                        [this, &record](const HostAddress &aAddress) { return IsLocalHostAddress(record, aAddress); }))
+        {
+            continue;
+        }
+
+        removed.push_back({record.mInterfaceIndex, record.mRecord.mType, record.mRecord.mData});
+    }
+
+    for (const HostAddress &address : removed)
+    {
+        RemoveLocalHostAddress(address, /* aSendGoodbye */ true);
+    }
+
+    for (const HostAddress &address : addresses)
+    {
+        AddLocalHostAddress(address);
+    }
+
+exit:
+    if (ifAddrs != nullptr)
+    {
+        freeifaddrs(ifAddrs);
+    }
+
+    return error;
+}
+
+bool PublisherNative::MakeHostAddress(uint32_t     aInterfaceIndex,
+                                      int          aFamily,
+                                      const void * aAddress,
+                                      HostAddress &aHostAddress) const
+{
+    const uint8_t *bytes   = static_cast<const uint8_t *>(aAddress);
+    bool           isValid = true;
+
+    aHostAddress.mInterfaceIndex = aInterfaceIndex;
+
+    if (aFamily == AF_INET6 && mProtocol != AF_INET)
+    {
+        aHostAddress.mType = kTypeAaaa;
+        aHostAddress.mData.assign(bytes, bytes + OTBR_IP6_ADDRESS_SIZE);
+    }
+    else if (aFamily == AF_INET && mProtocol != AF_INET6)
+    {
+        aHostAddress.mType = kTypeA;
+        aHostAddress.mData.assign(bytes, bytes + sizeof(in_addr_t));
+    }
+    else
+    {
+        isValid = false;
+    }
+
+    return isValid;
+}
+
+bool PublisherNative::IsLocalHostAddress(const LocalRecord &aRecord, const HostAddress &aAddress) const
+{
+    return aRecord.mEntryId == mLocalHostEntryId && aRecord.mInterfaceIndex == aAddress.mInterfaceIndex &&
+           aRecord.mRecord.mType == aAddress.mType && aRecord.mRecord.mData == aAddress.mData;
+}
+
+void PublisherNative::AddLocalHostAddress(const HostAddress &aAddress)
+{
+    Entry *entry = FindEntry(mLocalHostEntryId);
+
+    VerifyOrExit(entry != nullptr);
+    VerifyOrExit(std::none_of(mRecords.begin(), mRecords.end(), [this, &aAddress](const LocalRecord &aRecord) {
+        return IsLocalHostAddress(aRecord, aAddress);
+    }));
+
+    // The addresses are published only on their own interfaces, see RFC 6762, section 15.
+    AddRecord(entry->mId, entry->mFullName, aAddress.mType, /* aUnique */ true, std::vector<uint8_t>(aAddress.mData),
+              aAddress.mInterfaceIndex);
+
+    // All addresses are announced again, as the cache-flush bit makes the peers drop those left out, see RFC 6762,
+    // section 8.4. A host still probing announces them once it's done.
+    if (entry->mState != EntryState::kProbing)
+    {
+        StartAnnouncing(*entry);
+    }
+
+exit:
+    return;
+}
+
+void PublisherNative::RemoveLocalHostAddress(const HostAddress &aAddress, bool aSendGoodbye)
+{
+    const Entry *entry  = FindEntry(mLocalHostEntryId);
+    auto         record = std::find_if(mRecords.begin(), mRecords.end(), [this, &aAddress](const LocalRecord &aRecord) {
+        return IsLocalHostAddress(aRecord, aAddress);
+    });
+
+    VerifyOrExit(entry != nullptr && record != mRecords.end());
+
+    if (aSendGoodbye && entry->mState != EntryState::kProbing && !IsRecordShared(*record))
+    {
+        Record goodbye = record->mRecord;
+
+        goodbye.mTtl = 0;
+        QueueMulticast(goodbye, record->mInterfaceIndex, Clock::now(), /* aIsAnswer */ true);
+    }
+    else if (!IsRecordShared(*record))
+    {
+        // Records not said goodbye to mustn't be announced any more.
+        RemoveMulticast(record->mRecord);
+    }
+
+    mRecords.erase(record);
+
+exit:
+    return;
+}
+
+otbrError PublisherNative::MakeServiceName(const char *aType, std::string &aName) const
+{
+    otbrError error;
+
+    aName.clear();
+    SuccessOrExit(error = AppendDottedName(aName, aType));
+    SuccessOrExit(error = AppendDottedName(aName, mDomain.c_str()));
+
+exit:
+    return error;
+}
+
+otbrError PublisherNative::MakeHostName(const std::string &aHostName, std::string &aName) const
+{
+    otbrError error;
+
+    aName.clear();
+    SuccessOrExit(error = AppendNameLabel(aName, aHostName));
+    SuccessOrExit(error = AppendDottedName(aName, mDomain.c_str()));
+
+exit:
+    return error;
+}
+
+otbrError PublisherNative::MakeTargetName(const std::string &aHostName, std::string &aName)
+{
+    otbrError    error = OTBR_ERROR_NONE;
+    const Entry *host  = aHostName.empty() ? nullptr : FindEntry(aHostName, "");
+
+    // A renamed host is the target under its alternative name.
+    if (host != nullptr)
+    {
+        aName = host->mFullName;
+    }
+    else
+    {
+        error = MakeHostName(aHostName.empty() ? mHostName : aHostName, aName);
+    }
+
+    return error;
+}
+
+otbrError PublisherNative::PublishService(const char *   aHostName,
+                                          uint16_t       aPort,
+                                          const char *   aName,
+                                          const char *   aType,
+                                          const TxtList &aTxtList)
+{
+    otbrError   error = OTBR_ERROR_NONE;
+    uint8_t     txt[kMaxSizeOfTxtRecord];
+    uint16_t    txtLength = sizeof(txt);
+    std::string serviceName;
+    std::string instanceName;
+    std::string hostName;
+    Entry *     entry;
+
+    VerifyOrExit(mIsStarted, error = OTBR_ERROR_MDNS);
+    SuccessOrExit(error = EncodeTxtData(aTxtList, txt, txtLength));
+    SuccessOrExit(error = MakeServiceName(aType, serviceName));
+    SuccessOrExit(error = AppendNameLabel(instanceName, aName));
+    instanceName += serviceName;
+    SuccessOrExit(error = MakeTargetName(aHostName == nullptr ? "" : aHostName, hostName));
+
+    entry = FindEntry(aName, aType);
+    if (entry == nullptr)
+    {
+        otbrLogInfo("Publish service %s.%s", aName, aType);
+
+        entry = &AddEntry(aName, aType, instanceName);
+        StartProbing(*entry, RandomDelay(0, kProbeInterval.count()));
+    }
+    else
+    {
+        // A renamed service keeps its alternative name.
+        otbrLogInfo("Update service %s", NameToString(entry->mFullName).c_str());
+
+        RemoveRecords(entry->mId, /* aSendGoodbye */ false);
+        if (entry->mState != EntryState::kProbing)
+        {
+            StartAnnouncing(*entry);
+            mResults.push_back({aName, aType, OTBR_ERROR_NONE});
+        }
+    }
+
+    entry->mHostName = aHostName == nullptr ? "" : aHostName;
+    entry->mPort     = aPort;
+    entry->mData.assign(txt, txt + txtLength);
+    error = AddServiceRecords(*entry);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogErr("Failed to publish service %s.%s: %s", aName, aType, otbrErrorString(error));
+    }
+
+    return error;
+}
+
+otbrError PublisherNative::UnpublishService(const char *aName, const char *aType)
+{
+    Entry *entry = FindEntry(aName, aType);
+
+    VerifyOrExit(entry != nullptr);
+
+    otbrLogInfo("Unpublish service %s", NameToString(entry->mFullName).c_str());
+    RemoveEntry(entry->mId, /* aSendGoodbye */ true);
+
+exit:
+    return OTBR_ERROR_NONE;
+}
+
+otbrError PublisherNative::PublishHost(const char *aName, const uint8_t *aAddress, uint8_t aAddressLength)
+{
+    otbrError   error = OTBR_ERROR_NONE;
+    std::string hostName;
+    Entry *     entry;
+
+    VerifyOrExit(mIsStarted, error = OTBR_ERROR_MDNS);
+    VerifyOrExit(aAddressLength == OTBR_IP6_ADDRESS_SIZE, error = OTBR_ERROR_INVALID_ARGS);
+    SuccessOrExit(error = MakeHostName(aName, hostName));
+
+    entry = FindEntry(aName, "");
+    if (entry == nullptr)
+    {
+        otbrLogInfo("Publish host %s", aName);
+
+        entry = &AddEntry(aName, "", hostName);
+        StartProbing(*entry, RandomDelay(0, kProbeInterval.count()));
+    }
+    else
+    {
+        // A renamed host keeps its alternative name.
+        otbrLogInfo("Update host %s", NameToString(entry->mFullName).c_str());
+
+        RemoveRecords(entry->mId, /* aSendGoodbye */ false);
+        if (entry->mState != EntryState::kProbing)
+        {
+            StartAnnouncing(*entry);
+            mResults.push_back({aName, "", OTBR_ERROR_NONE});
+        }
+    }
+
+    entry->mData.assign(aAddress, aAddress + aAddressLength);
+    AddHostRecords(*entry);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogErr("Failed to publish host %s: %s", aName, otbrErrorString(error));
+    }
+
+    return error;
+}
+
+otbrError PublisherNative::UnpublishHost(const char *aName)
+{
+    Entry *entry = FindEntry(aName, "");
+    bool   renamed;
+
+    VerifyOrExit(entry != nullptr);
+
+    otbrLogInfo("Unpublish host %s", NameToString(entry->mFullName).c_str());
+    renamed = entry->mRenameCount > 0;
+    RemoveEntry(entry->mId, /* aSendGoodbye */ true);
+
+    // Services left on a renamed host fall back to its requested name.
+    if (renamed)
+    {
+        UpdateServiceTargets(aName);
+    }
+
+exit:
+    return OTBR_ERROR_NONE;
+}
+
+PublisherNative::Entry *PublisherNative::FindEntry(uint32_t aId)
+{
+    auto entry =
+        std::find_if(mEntries.begin(), mEntries.end(), [aId](const Entry &aEntry) { return aEntry.mId == aId; });
+
+    return entry == mEntries.end() ? nullptr : &*entry;
+}
+
+const PublisherNative::Entry *PublisherNative::FindEntry(uint32_t aId) const
+{
+    return const_cast<PublisherNative *>(this)->FindEntry(aId);
+}
+
+PublisherNative::Entry *PublisherNative::FindEntry(const std::string &aName, const std::string &aType)
+{
+    auto entry = std::find_if(mEntries.begin(), mEntries.end(), [this, &aName, &aType](const Entry &aEntry) {
+        return aEntry.mId != mLocalHostEntryId && aEntry.mName == aName && aEntry.IsHost() == aType.empty() &&
+               IsServiceTypeEqual(aEntry.mType.c_str(), aType.c_str());
+    });
+
+    return entry == mEntries.end() ? nullptr : &*entry;
+}
+
+PublisherNative::Entry &PublisherNative::AddEntry(const std::string &aName,
+                                                  const std::string &aType,
+                                                  const std::string &aFullName)
+{
+    Entry entry;
+
+    entry.mId          = mNextEntryId++;
+    entry.mName        = aName;
+    entry.mType        = aType;
+    entry.mFullName    = aFullName;
+    entry.mPort        = 0;
+    entry.mState       = EntryState::kProbing;
+    entry.mTxCount     = 0;
+    entry.mRenameCount = 0;
+    entry.mTxTime      = Timepoint::max();
+    mEntries.push_back(std::move(entry));
+
+    return mEntries.back();
+}
+
+void PublisherNative::RemoveEntry(uint32_t aEntryId, bool aSendGoodbye)
+{
+    const Entry *entry = FindEntry(aEntryId);
+
+    VerifyOrExit(entry != nullptr);
+
+    RemoveRecords(aEntryId, aSendGoodbye && entry->mState != EntryState::kProbing);
+    mEntries.erase(mEntries.begin() + (entry - mEntries.data()));
+
+exit:
+    return;
+}
+
+void PublisherNative::AddRecord(uint32_t               aEntryId,
+                                const std::string &    aName,
+                                uint16_t               aType,
+                                bool                   aUnique,
+                                std::vector<uint8_t> &&aData,
+                                uint32_t               aInterfaceIndex)
+{
+    LocalRecord record;
+
+    record.mRecord.mName       = aName;
+    record.mRecord.mType       = aType;
+    record.mRecord.mClass      = kClassIn;
+    record.mRecord.mCacheFlush = aUnique;
+    record.mRecord.mTtl        = GetTtl(aType);
+    record.mRecord.mData       = std::move(aData);
+    record.mEntryId            = aEntryId;
+    record.mNameHash           = HashName(aName);
+    record.mInterfaceIndex     = aInterfaceIndex;
+    record.mMulticastTime      = Timepoint::min();
+    mRecords.push_back(std::move(record));
+}
+
+void PublisherNative::RemoveRecords(uint32_t aEntryId, bool aSendGoodbye)
+{
+    if (aSendGoodbye)
+    {
+        SendGoodbyes(aEntryId);
+    }
+    else
+    {
+        // Records not said goodbye to mustn't be announced any more.
+        for (const LocalRecord &record : mRecords)
+        {
+            if (record.mEntryId == aEntryId && !IsRecordShared(record))
+            {
+                RemoveMulticast(record.mRecord);
+            }
+        }
+    }
+
+    mRecords.erase(std::remove_if(mRecords.begin(), mRecords.end(),
+                                  [aEntryId](const LocalRecord &aRecord) { return aRecord.mEntryId == aEntryId; }),
+                   mRecords.end());
+}
+
+bool PublisherNative::IsRecordShared(const LocalRecord &aRecord) const
+{
+    return std::any_of(mRecords.begin(), mRecords.end(), [&aRecord](const LocalRecord &aOther) {
+        return aOther.mEntryId != aRecord.mEntryId && aOther.mRecord.IsSameAs(aRecord.mRecord);
+    });
+}
+
+bool PublisherNative::IsLocalRecord(const Record &aRecord) const
+{
+    return std::any_of(mRecords.begin(), mRecords.end(),
+                       [&aRecord](const LocalRecord &aOther) { return aOther.mRecord.IsSameAs(aRecord); });
+}
+
+void PublisherNative::StartProbing(Entry &aEntry, Milliseconds aDelay)
+{
+    aEntry.mState   = EntryState::kProbing;
+    aEntry.mTxCount = 0;
+    aEntry.mTxTime  = Clock::now() + aDelay;
+}
+
+void PublisherNative::StartAnnouncing(Entry &aEntry)
+{
+    aEntry.mState   = EntryState::kAnnouncing;
+    aEntry.mTxCount = 0;
+    aEntry.mTxTime  = Clock::now();
+}
+
+void PublisherNative::HandleConflict(uint32_t aEntryId)
+{
+    Entry *entry = FindEntry(aEntryId);
+
+    VerifyOrExit(entry != nullptr);
+
+    if (aEntryId == mLocalHostEntryId)
+    {
+        otbrLogErr("Name conflict of the local host %s", entry->mName.c_str());
+        mLocalHostEntryId = 0;
+    }
+    else
+    {
+        otbrLogWarning("Name conflict of %s %s", entry->IsHost() ? "host" : "service",
+                       NameToString(entry->mFullName).c_str());
+
+        // A renamed entry keeps probing under its alternative name.
+        VerifyOrExit(!RenameEntry(*entry));
+        mResults.push_back({entry->mName, entry->mType, OTBR_ERROR_DUPLICATED});
+    }
+
+    RemoveEntry(aEntryId, /* aSendGoodbye */ false);
+
+exit:
+    return;
+}
+
+bool PublisherNative::RenameEntry(Entry &aEntry)
+{
+    bool        renamed = false;
+    std::string newName;
+    std::string fullName;
+    std::string serviceName;
+
+    VerifyOrExit(ResolveConflict(aEntry.mName, aEntry.IsHost() ? nullptr : aEntry.mType.c_str(), aEntry.mRenameCount,
+                                 newName));
+
+    if (aEntry.IsHost())
+    {
+        SuccessOrExit(MakeHostName(newName, fullName));
+    }
+    else
+    {
+        SuccessOrExit(MakeServiceName(aEntry.mType.c_str(), serviceName));
+        SuccessOrExit(AppendNameLabel(fullName, newName));
+        fullName += serviceName;
+    }
+
+    // The records under the old name belong to the other responder now, so they are dropped without goodbyes and
+    // the entry probes its new name right away, see RFC 6762, section 9.
+    RemoveRecords(aEntry.mId, /* aSendGoodbye */ false);
+    aEntry.mFullName = fullName;
+
+    if (aEntry.IsHost())
+    {
+        AddHostRecords(aEntry);
+    }
+    else
+    {
+        SuccessOrExit(AddServiceRecords(aEntry));
+    }
+
+    StartProbing(aEntry, Milliseconds(0));
+    renamed = true;
+
+    if (aEntry.IsHost())
+    {
+        UpdateServiceTargets(aEntry.mName);
+    }
+
+exit:
+    return renamed;
+}
+
+otbrError PublisherNative::AddServiceRecords(const Entry &aEntry)
+{
+    otbrError            error = OTBR_ERROR_NONE;
+    std::string          serviceName;
+    std::string          servicesName;
+    std::string          hostName;
+    std::vector<uint8_t> data;
+
+    SuccessOrExit(error = MakeServiceName(aEntry.mType.c_str(), serviceName));
+    SuccessOrExit(error = MakeServiceName(kServicesName, servicesName));
+    SuccessOrExit(error = MakeTargetName(aEntry.mHostName, hostName));
+
+    AppendNameData(data, aEntry.mFullName);
+    AddRecord(aEntry.mId, serviceName, kTypePtr, /* aUnique */ false, std::move(data));
+
+    data.clear();
+    AppendNameData(data, serviceName);
+    AddRecord(aEntry.mId, servicesName, kTypePtr, /* aUnique */ false, std::move(data));
+
+    // The priority and weight are zero.
+    data.assign(4, 0);
+    data.push_back(static_cast<uint8_t>(aEntry.mPort >> 8));
+    data.push_back(static_cast<uint8_t>(aEntry.mPort & 0xff));
+    AppendNameData(data, hostName);
+    AddRecord(aEntry.mId, aEntry.mFullName, kTypeSrv, /* aUnique */ true, std::move(data));
+
+    // An empty TXT record has a single empty string, see RFC 6763, section 6.1.
+    data = aEntry.mData;
+    if (data.empty())
+    {
+        data.push_back(0);
+    }
+    AddRecord(aEntry.mId, aEntry.mFullName, kTypeTxt, /* aUnique */ true, std::move(data));
+
+exit:
+    return error;
+}
+
+void PublisherNative::AddHostRecords(const Entry &aEntry)
+{
+    AddRecord(aEntry.mId, aEntry.mFullName, kTypeAaaa, /* aUnique */ true, std::vector<uint8_t>(aEntry.mData));
+}
+
+void PublisherNative::UpdateServiceTargets(const std::string &aHostName)
+{
+    for (Entry &entry : mEntries)
+    {
+        if (entry.IsHost() || entry.mHostName != aHostName)
+        {
+            continue;
+        }
+
+        RemoveRecords(entry.mId, /* aSendGoodbye */ false);
+        if (AddServiceRecords(entry) == OTBR_ERROR_NONE && entry.mState != EntryState::kProbing)
+        {
+            // The new SRV record replaces the old one on the link thanks to the cache-flush bit.
+            StartAnnouncing(entry);
+        }
+    }
+}
+
+bool PublisherNative::Receive(const Socket &aSocket)
+{
+    uint8_t          buffer[kMaxReceiveSize];
+    uint8_t          control[CMSG_SPACE(sizeof(in6_pktinfo)) + CMSG_SPACE(sizeof(in_pktinfo))];
+    sockaddr_storage source;
+    iovec            vector;
+    msghdr           header;
+    ssize_t          length;
+    uint32_t         interfaceIndex = 0;
+    uint16_t         sourcePort;
+    Message          message;
+
+    vector.iov_base = buffer;
+    vector.iov_len  = sizeof(buffer);
+
+    memset(&header, 0, sizeof(header));
+    header.msg_name       = &source;
+    header.msg_namelen    = sizeof(source);
+    header.msg_iov        = &vector;
+    header.msg_iovlen     = 1;
+    header.msg_control    = control;
+    header.msg_controllen = sizeof(control);
+
+    length = recvmsg(aSocket.mFd, &header, 0);
+    VerifyOrExit(length > 0);
+
+    for (cmsghdr *cmsg = CMSG_FIRSTHDR(&header); cmsg != nullptr; cmsg = CMSG_NXTHDR(&header, cmsg))
+    {
+        if (cmsg->cmsg_level == IPPROTO_IPV6 && cmsg->cmsg_type == IPV6_PKTINFO)
+        {
+            in6_pktinfo info;
+
+            memcpy(&info, CMSG_DATA(cmsg), sizeof(info));
+            interfaceIndex = info.ipi6_ifindex;
+        }
+        else if (cmsg->cmsg_level == IPPROTO_IP && cmsg->cmsg_type == IP_PKTINFO)
+        {
+            in_pktinfo info;
+
+            memcpy(&info, CMSG_DATA(cmsg), sizeof(info));
+            interfaceIndex = static_cast<uint32_t>(info.ipi_ifindex);
+        }
+    }
+
+    VerifyOrExit(mInterfaceIndex == 0 || interfaceIndex == mInterfaceIndex);
+    VerifyOrExit(message.Parse(buffer, static_cast<size_t>(length)) == OTBR_ERROR_NONE,
+                 otbrLogDebug("Ignore a malformed mDNS message of %zd bytes", length));
+    VerifyOrExit((message.mFlags & (Message::kOpcodeMask | Message::kRcodeMask)) == 0);
+
+    sourcePort = ntohs(source.ss_family == AF_INET6 ? reinterpret_cast<sockaddr_in6 &>(source).sin6_port
+                                                    : reinterpret_cast<sockaddr_in &>(source).sin_port);
+
+    if (message.IsResponse())
+    {
+        // Responses from other ports are not mDNS responses, see RFC 6762, section 6.
+        VerifyOrExit(sourcePort == kMdnsPort);
+        HandleResponse(message, interfaceIndex);
+    }
+    else
+    {
+        HandleQuery(message, aSocket, source, /* aIsLegacy */ sourcePort != kMdnsPort, interfaceIndex);
+    }
+
+exit:
+    return length > 0;
+}
+
+void PublisherNative::HandleQuery(const Message &         aMessage,
+                                  const Socket &          aSocket,
+                                  const sockaddr_storage &aSource,
+                                  bool                    aIsLegacy,
+                                  uint32_t                aInterfaceIndex)
+{
+    Timepoint           now     = Clock::now();
+    bool                isProbe = !aMessage.mAuthorities.empty();
+    bool                isUnique;
+    std::vector<Record> multicastAnswers;
+    std::vector<Record> unicastAnswers;
+    std::vector<Record> additionals;
+    Timepoint           sendTime;
+
+    if (isProbe)
+    {
+        HandleProbe(aMessage, aInterfaceIndex);
+    }
+
+    // The known answers of this query, or of the continuation of a truncated one, suppress the pending answers on
+    // its interface.
+    mMulticastAnswers.erase(std::remove_if(mMulticastAnswers.begin(), mMulticastAnswers.end(),
+                                           [this, &aMessage, aInterfaceIndex](const QueuedRecord &aQueued) {
+                                               return aQueued.mInterfaceIndex == aInterfaceIndex &&
+                                                      IsKnownAnswer(aMessage, aQueued.mRecord);
+                                           }),
+                            mMulticastAnswers.end());
+
+    for (const Question &question : aMessage.mQuestions)
+    {
+        if (question.mUnicastResponse || aIsLegacy)
+        {
+            AppendAnswers(question, aMessage, aInterfaceIndex, now, /* aRateLimit */ false, unicastAnswers);
+        }
+        else
+        {
+            AppendAnswers(question, aMessage, aInterfaceIndex, now, /* aRateLimit */ !isProbe, multicastAnswers);
+        }
+    }
+
+    if (!unicastAnswers.empty())
+    {
+        AppendAdditionals(unicastAnswers, aInterfaceIndex, additionals);
+        SendUnicastResponse(aSocket, aSource, aMessage, aIsLegacy, unicastAnswers, additionals);
+    }
+
+    VerifyOrExit(!multicastAnswers.empty());
+
+    // Answers of unique records are sent immediately, the others are delayed so that the answers of several
+    // responders and to several queries are aggregated, see RFC 6762, section 6.
+    isUnique = std::all_of(multicastAnswers.begin(), multicastAnswers.end(),
+                           [](const Record &aRecord) { return aRecord.mCacheFlush; });
+
+    if (isProbe || isUnique)
+    {
+        sendTime = now;
+    }
+    else if (aMessage.IsTruncated())
+    {
+        sendTime = now + RandomDelay(400, 500);
+    }
+    else
+    {
+        sendTime = now + RandomDelay(20, 120);
+    }
+
+    additionals.clear();
+    AppendAdditionals(multicastAnswers, aInterfaceIndex, additionals);
+
+    // The response goes out on the interface the query came in on.
+    for (const Record &answer : multicastAnswers)
+    {
+        QueueMulticast(answer, aInterfaceIndex, sendTime, /* aIsAnswer */ true);
+    }
+
+    for (const Record &additional : additionals)
+    {
+        QueueMulticast(additional, aInterfaceIndex, sendTime, /* aIsAnswer */ false);
+    }
+
+exit:
+    return;
+}
+
+void PublisherNative::HandleProbe(const Message &aMessage, uint32_t aInterfaceIndex)
+{
+    for (Entry &entry : mEntries)
+    {
+        std::vector<const Record *> ours;
+        std::vector<const Record *> theirs;
+        int                         result = 0;
+        auto                        less   = [](const Record *aFirst, const Record *aSecond) {
+            return aFirst->Compare(*aSecond) < 0;
+        };
+
+        if (entry.mState != EntryState::kProbing)
+        {
+            continue;
+        }
+
+        for (const Record &record : aMessage.mAuthorities)
+        {
+            if (IsNameEqual(record.mName, entry.mFullName))
+            {
+                theirs.push_back(&record);
+            }
+        }
+
+        if (theirs.empty())
+        {
+            continue;
+        }
+
+        for (const LocalRecord &record : mRecords)
+        {
+            if (record.mEntryId == entry.mId && record.mRecord.mCacheFlush && record.IsOnInterface(aInterfaceIndex))
+            {
+                ours.push_back(&record.mRecord);
+            }
+        }
+
+        // Simultaneous probes are resolved by comparing the records, see RFC 6762, section 8.2.
+        std::sort(ours.begin(), ours.end(), less);
+        std::sort(theirs.begin(), theirs.end(), less);
+
+        for (size_t i = 0; result == 0 && i < std::min(ours.size(), theirs.size()); i++)
+        {
+            result = ours[i]->Compare(*theirs[i]);
+        }
+
+        if (result == 0)
+        {
+            result = (ours.size() == theirs.size()) ? 0 : (ours.size() < theirs.size() ? -1 : 1);
+        }
+
+        // Our own probe is equal to itself.
+        if (result < 0)
+        {
+            otbrLogInfo("Lost simultaneous probe of %s, probe again later", NameToString(entry.mFullName).c_str());
+            StartProbing(entry, kProbeConflictDelay);
+        }
+    }
+}
+
+void PublisherNative::HandleResponse(const Message &aMessage, uint32_t aInterfaceIndex)
+{
+    Timepoint             now = Clock::now();
+    std::vector<uint32_t> conflicts;
+
+    for (const std::vector<Record> *records : {&aMessage.mAnswers, &aMessage.mAdditionals})
+    {
+        for (const Record &record : *records)
+        {
+            CheckConflict(record, conflicts);
+
+            // Another responder has sent the answer on the same interface, see RFC 6762, section 7.4.
+            mMulticastAnswers.erase(std::remove_if(mMulticastAnswers.begin(), mMulticastAnswers.end(),
+                                                   [&record, aInterfaceIndex](const QueuedRecord &aQueued) {
+                                                       const Record &answer = aQueued.mRecord;
+
+                                                       return aQueued.mInterfaceIndex == aInterfaceIndex &&
+                                                              answer.mTtl > 0 && answer.IsSameAs(record) &&
+                                                              record.mTtl >= answer.mTtl / 2;
+                                                   }),
+                                    mMulticastAnswers.end());
+
+            UpdateCache(record, now);
+        }
+    }
+
+    for (uint32_t entryId : conflicts)
+    {
+        HandleConflict(entryId);
+    }
+}
+
+void PublisherNative::CheckConflict(const Record &aRecord, std::vector<uint32_t> &aConflicts) const
+{
+    uint32_t nameHash = HashName(aRecord.mName);
+
+    for (const LocalRecord &record : mRecords)
+    {
+        const Entry *entry;
+        bool         isConflict;
+
+        if (!record.mRecord.mCacheFlush || record.mNameHash != nameHash ||
+            std::find(aConflicts.begin(), aConflicts.end(), record.mEntryId) != aConflicts.end() ||
+            !IsNameEqual(record.mRecord.mName, aRecord.mName))
+        {
+            continue;
+        }
+
+        entry = FindEntry(record.mEntryId);
+
+        // Any other record of a name being probed conflicts, while a record of a published name conflicts only if
+        // it's of the same type, see RFC 6762, sections 8.1 and 9.
+        if (entry->mState == EntryState::kProbing)
+        {
+            isConflict = !IsLocalRecord(aRecord);
+        }
+        else
+        {
+            isConflict = aRecord.mType == record.mRecord.mType && aRecord.mClass == record.mRecord.mClass &&
+                         !IsLocalRecord(aRecord);
+        }
+
+        if (isConflict)
+        {
+            aConflicts.push_back(record.mEntryId);
+        }
+    }
+}
+
+bool PublisherNative::IsKnownAnswer(const Message &aMessage, const Record &aRecord) const
+{
+    // A known answer suppresses the answer if its TTL is at least half of the true TTL, see RFC 6762, section 7.1.
+    return aRecord.mTtl > 0 &&
+           std::any_of(aMessage.mAnswers.begin(), aMessage.mAnswers.end(), [&aRecord](const Record &aKnownAnswer) {
+               return aKnownAnswer.IsSameAs(aRecord) && aKnownAnswer.mTtl >= aRecord.mTtl / 2;
+           });
+}
+
+void PublisherNative::AppendAnswers(const Question &     aQuestion,
+                                    const Message &      aMessage,
+                                    uint32_t             aInterfaceIndex,
+                                    Timepoint            aNow,
+                                    bool                 aRateLimit,
+                                    std::vector<Record> &aAnswers) const
+{
+    uint32_t nameHash = HashName(aQuestion.mName);
+
+    VerifyOrExit(aQuestion.mClass == kClassIn || aQuestion.mClass == kClassAny);
+
+    for (const LocalRecord &record : mRecords)
+    {
+        if (record.mNameHash != nameHash || (aQuestion.mType != kTypeAny && aQuestion.mType != record.mRecord.mType) ||
+            !record.IsOnInterface(aInterfaceIndex) || !IsNameEqual(record.mRecord.mName, aQuestion.mName))
+        {
+            continue;
+        }
+
+        if (FindEntry(record.mEntryId)->mState == EntryState::kProbing || IsKnownAnswer(aMessage, record.mRecord))
+        {
+            continue;
+        }
+
+        // A record is multicast at most once per second, see RFC 6762, section 6.2.
+        if (aRateLimit && aNow < record.mMulticastTime + kMinMulticastInterval)
+        {
+            continue;
+        }
+
+        if (!ContainsRecord(aAnswers, record.mRecord))
+        {
+            aAnswers.push_back(record.mRecord);
+        }
+    }
+
+exit:
+    return;
+}
+
+void PublisherNative::AppendAdditionals(const std::vector<Record> &aAnswers,
+                                        uint32_t                   aInterfaceIndex,
+                                        std::vector<Record> &      aAdditionals) const
+{
+    std::string target;
+
+    // Answers of PTR records come with the SRV and TXT records of the service instances, and answers of SRV records
+    // with the address records of the hosts, see RFC 6763, section 12.
+    for (const Record &answer : aAnswers)
+    {
+        if (answer.mType == kTypePtr && ReadNameData(answer.mData, 0, target) == OTBR_ERROR_NONE)
+        {
+            AppendLocalRecords(target, kTypeSrv, aInterfaceIndex, aAdditionals);
+            AppendLocalRecords(target, kTypeTxt, aInterfaceIndex, aAdditionals);
+        }
+    }
+
+    for (size_t i = 0; i < aAnswers.size() + aAdditionals.size(); i++)
+    {
+        const Record &record = (i < aAnswers.size()) ? aAnswers[i] : aAdditionals[i - aAnswers.size()];
+
+        if (record.mType == kTypeSrv && ReadNameData(record.mData, kSrvTargetOffset, target) == OTBR_ERROR_NONE)
+        {
+            AppendLocalRecords(target, kTypeAaaa, aInterfaceIndex, aAdditionals);
+            AppendLocalRecords(target, kTypeA, aInterfaceIndex, aAdditionals);
+        }
+    }
+
+    aAdditionals.erase(std::remove_if(aAdditionals.begin(), aAdditionals.end(),
+                                      [&aAnswers](const Record &aRecord) { return ContainsRecord(aAnswers, aRecord); }),
+                       aAdditionals.end());
+}
+
+void PublisherNative::AppendLocalRecords(const std::string &  aName,
+                                         uint16_t             aType,
+                                         uint32_t             aInterfaceIndex,
+                                         std::vector<Record> &aRecords) const
+{
+    uint32_t nameHash = HashName(aName);
+
+    for (const LocalRecord &record : mRecords)
+    {
+        if (record.mNameHash == nameHash && record.mRecord.mType == aType && record.IsOnInterface(aInterfaceIndex) &&
+            IsNameEqual(record.mRecord.mName, aName) &&
+            FindEntry(record.mEntryId)->mState != EntryState::kProbing && !ContainsRecord(aRecords, record.mRecord))
+        {
+            aRecords.push_back(record.mRecord);
+        }
+    }
+}
+
+void PublisherNative::QueueMulticast(const Record &aRecord,
+                                     uint32_t      aInterfaceIndex,
+                                     Timepoint     aSendTime,
+                                     bool          aIsAnswer)
+{
+    std::vector<QueuedRecord> &records = aIsAnswer ? mMulticastAnswers : mMulticastAdditionals;
+    auto                       isSame  = [&aRecord, aInterfaceIndex](const QueuedRecord &aQueued) {
+        return aQueued.mInterfaceIndex == aInterfaceIndex && aQueued.mRecord.IsSameAs(aRecord);
+    };
+    auto                       queued  = std::find_if(records.begin(), records.end(), isSame);
+
+    if (queued == records.end())
+    {
+        records.push_back({aRecord, aInterfaceIndex});
+    }
+    else
+    {
+        queued->mRecord.mTtl = aRecord.mTtl;
+    }
+
+    mMulticastTime = std::min(mMulticastTime, aSendTime);
+}
+
+void PublisherNative::RemoveMulticast(const Record &aRecord)
+{
+    auto isSame = [&aRecord](const QueuedRecord &aQueued) { return aQueued.mRecord.IsSameAs(aRecord); };
+
+    mMulticastAnswers.erase(std::remove_if(mMulticastAnswers.begin(), mMulticastAnswers.end(), isSame),
+                            mMulticastAnswers.end());
+    mMulticastAdditionals.erase(std::remove_if(mMulticastAdditionals.begin(), mMulticastAdditionals.end(), isSame),
+                                mMulticastAdditionals.end());
+}
+
+void PublisherNative::SendMulticastResponse(void)
+{
+    Timepoint now = Clock::now();
+
+    for (uint32_t index : mInterfaces)
+    {
+        SendMulticastResponse(index);
+    }
+
+    for (LocalRecord &record : mRecords)
+    {
+        if (std::any_of(mMulticastAnswers.begin(), mMulticastAnswers.end(),
+                        [&record](const QueuedRecord &aQueued) { return aQueued.mRecord.IsSameAs(record.mRecord); }))
+        {
+            record.mMulticastTime = now;
+        }
+    }
+
+    mMulticastAnswers.clear();
+    mMulticastAdditionals.clear();
+    mMulticastTime = Timepoint::max();
+}
+
+void PublisherNative::SendMulticastResponse(uint32_t aInterfaceIndex)
+{
+    uint8_t             buffer[kMaxMessageSize];
+    MessageWriter       writer(buffer, sizeof(buffer));
+    std::vector<Record> answers;
+    std::vector<Record> additionals;
+
+    writer.Reset(0, Message::kFlagResponse | Message::kFlagAuthoritative);
+
+    for (const QueuedRecord &queued : mMulticastAnswers)
+    {
+        const Record &answer = queued.mRecord;
+
+        if ((queued.mInterfaceIndex != 0 && queued.mInterfaceIndex != aInterfaceIndex) ||
+            ContainsRecord(answers, answer))
+        {
+            continue;
+        }
+
+        answers.push_back(answer);
+
+        if (!writer.AppendRecord(MessageWriter::kAnswer, answer, answer.mTtl))
+        {
+            if (writer.GetEntryCount() > 0)
+            {
+                SendMulticast(writer, aInterfaceIndex);
+                writer.Reset(0, Message::kFlagResponse | Message::kFlagAuthoritative);
+            }
+
+            if (!writer.AppendRecord(MessageWriter::kAnswer, answer, answer.mTtl))
+            {
+                otbrLogWarning("Record %s is too large to send", NameToString(answer.mName).c_str());
+            }
+        }
+    }
+
+    // Additional records are sent only if they fit in the last message.
+    for (const QueuedRecord &queued : mMulticastAdditionals)
+    {
+        const Record &additional = queued.mRecord;
+
+        if ((queued.mInterfaceIndex != 0 && queued.mInterfaceIndex != aInterfaceIndex) ||
+            ContainsRecord(answers, additional) || ContainsRecord(additionals, additional))
+        {
+            continue;
+        }
+
+        additionals.push_back(additional);
+        writer.AppendRecord(MessageWriter::kAdditional, additional, additional.mTtl);
+    }
+
+    if (writer.GetEntryCount() > 0)
+    {
+        SendMulticast(writer, aInterfaceIndex);
+    }
+}
+
+void PublisherNative::SendUnicastResponse(const Socket &          aSocket,
+                                          const sockaddr_storage &aDestination,
+                                          const Message &         aQuery,
+                                          bool                    aIsLegacy,
+                                          std::vector<Record> &   aAnswers,
+                                          std::vector<Record> &   aAdditionals)
+{
+    uint8_t       buffer[kMaxMessageSize];
+    MessageWriter writer(buffer, sizeof(buffer));
+    uint16_t      flags = Message::kFlagResponse | Message::kFlagAuthoritative;
+
+    // Responses to legacy queries repeat the questions and have no cache-flush bits and short TTLs, see RFC 6762,
+    // section 6.7.
+    writer.Reset(aIsLegacy ? aQuery.mId : 0, flags);
+
+    if (aIsLegacy)
+    {
+        for (Question question : aQuery.mQuestions)
+        {
+            question.mUnicastResponse = false;
+            writer.AppendQuestion(question);
+        }
+
+        for (Record &record : aAnswers)
+        {
+            record.mCacheFlush = false;
+            record.mTtl        = std::min<uint32_t>(record.mTtl, kLegacyTtl);
+        }
+
+        for (Record &record : aAdditionals)
+        {
+            record.mCacheFlush = false;
+            record.mTtl        = std::min<uint32_t>(record.mTtl, kLegacyTtl);
+        }
+    }
+
+    for (const Record &answer : aAnswers)
+    {
+        if (!writer.AppendRecord(MessageWriter::kAnswer, answer, answer.mTtl))
+        {
+            writer.SetFlags(flags | Message::kFlagTruncated);
+            break;
+        }
+    }
+
+    for (const Record &additional : aAdditionals)
+    {
+        writer.AppendRecord(MessageWriter::kAdditional, additional, additional.mTtl);
+    }
+
+    SendTo(aSocket, aDestination, writer);
+}
+
+void PublisherNative::SendProbes(Timepoint aNow)
+{
+    uint8_t              buffer[kMaxMessageSize];
+    MessageWriter        writer(buffer, sizeof(buffer));
+    std::vector<Entry *> entries;
+
+    for (Entry &entry : mEntries)
+    {
+        if (entry.mState != EntryState::kProbing || aNow < entry.mTxTime)
+        {
+            continue;
+        }
+
+        if (entry.mTxCount == kProbeCount)
+        {
+            otbrLogInfo("Probed %s successfully", NameToString(entry.mFullName).c_str());
+
+            StartAnnouncing(entry);
+            if (entry.mId != mLocalHostEntryId)
+            {
+                mResults.push_back({entry.mName, entry.mType, OTBR_ERROR_NONE});
+            }
+        }
+        else
+        {
+            entry.mTxCount++;
+            entry.mTxTime = aNow + kProbeInterval;
+            entries.push_back(&entry);
+        }
+    }
+
+    // Probes of several names are sent in one message as long as they fit, with the records of each interface.
+    for (uint32_t index : mInterfaces)
+    {
+        size_t begin = 0;
+
+        while (begin < entries.size())
+        {
+            size_t end = entries.size();
+
+            while (!WriteProbes(writer, entries, begin, end, index) && end - begin > 1)
+            {
+                end = begin + (end - begin) / 2;
+            }
+
+            if (writer.GetEntryCount() > 0)
+            {
+                SendMulticast(writer, index);
+            }
+
+            begin = end;
+        }
+    }
+}
+
+bool PublisherNative::WriteProbes(MessageWriter &             aWriter,
+                                  const std::vector<Entry *> &aEntries,
+                                  size_t                      aBegin,
+                                  size_t                      aEnd,
+                                  uint32_t                    aInterfaceIndex) const
+{
+    bool fits = true;
+
+    aWriter.Reset(0, 0);
+
+    for (size_t i = aBegin; fits && i < aEnd; i++)
+    {
+        fits = aWriter.AppendQuestion({aEntries[i]->mFullName, kTypeAny, kClassIn, /* mUnicastResponse */ true});
+    }
+
+    for (size_t i = aBegin; fits && i < aEnd; i++)
+    {
+        for (const LocalRecord &record : mRecords)
+        {
+            if (record.mEntryId == aEntries[i]->mId && record.mRecord.mCacheFlush &&
+                record.IsOnInterface(aInterfaceIndex))
+            {
+                VerifyOrExit(fits = aWriter.AppendRecord(MessageWriter::kAuthority, record.mRecord,
+                                                         record.mRecord.mTtl));
+            }
+        }
+    }
+
+exit:
+    return fits;
+}
+
+void PublisherNative::SendAnnouncements(Timepoint aNow)
+{
+    for (Entry &entry : mEntries)
+    {
+        if (entry.mState != EntryState::kAnnouncing || aNow < entry.mTxTime)
+        {
+            continue;
+        }
+
+        for (const LocalRecord &record : mRecords)
+        {
+            if (record.mEntryId == entry.mId)
+            {
+                QueueMulticast(record.mRecord, record.mInterfaceIndex, aNow, /* aIsAnswer */ true);
+            }
+        }
+
+        if (++entry.mTxCount == kAnnounceCount)
+        {
+            entry.mState = EntryState::kRegistered;
+        }
+        else
+        {
+            entry.mTxTime = aNow + kAnnounceInterval;
+        }
+    }
+}
+
+void PublisherNative::SendGoodbyes(uint32_t aEntryId)
+{
+    Timepoint now = Clock::now();
+
+    for (const LocalRecord &record : mRecords)
+    {
+        if (record.mEntryId == aEntryId && !IsRecordShared(record))
+        {
+            Record goodbye = record.mRecord;
+
+            goodbye.mTtl = 0;
+            QueueMulticast(goodbye, record.mInterfaceIndex, now, /* aIsAnswer */ true);
+        }
+    }
+}
+
+void PublisherNative::SendQueries(Timepoint aNow)
+{
+    uint8_t               buffer[kMaxMessageSize];
+    MessageWriter         writer(buffer, sizeof(buffer));
+    std::vector<Question> questions;
+    std::vector<Record>   knownAnswers;
+
+    auto collect = [aNow, &questions](Subscription &aSubscription, const std::vector<Question> &aAsked) {
+        if (aNow >= aSubscription.mQueryTime)
+        {
+            for (const Question &question : aAsked)
+            {
+                if (!ContainsQuestion(questions, question))
+                {
+                    questions.push_back(question);
+                }
+            }
+
+            aSubscription.mQueryTime     = aNow + aSubscription.mQueryInterval;
+            aSubscription.mQueryInterval = std::min(aSubscription.mQueryInterval * 2, kMaxQueryInterval);
+        }
+    };
+
+    mSubscribedServices.ForEach([this, &collect](ServiceSubscription &aSubscription) {
+        std::vector<Question> asked;
+
+        AppendQuestions(aSubscription, asked);
+        collect(aSubscription, asked);
+    });
+    mSubscribedHosts.ForEach([&collect](HostSubscription &aSubscription) {
+        std::vector<Question> asked;
+
+        asked.push_back({aSubscription.mQueryName, kTypeAaaa, kClassIn, /* mUnicastResponse */ false});
+        collect(aSubscription, asked);
+    });
+
+    VerifyOrExit(!questions.empty());
+
+    for (const Question &question : questions)
+    {
+        AppendKnownAnswers(question, aNow, knownAnswers);
+    }
+
+    // Known answers which don't fit follow in other messages, see RFC 6762, section 7.2.
+    writer.Reset(0, 0);
+
+    for (const Question &question : questions)
+    {
+        if (!writer.AppendQuestion(question))
+        {
+            SendMulticast(writer, /* aInterfaceIndex */ 0);
+            writer.Reset(0, 0);
+            writer.AppendQuestion(question);
+        }
+    }
+
+    for (const Record &knownAnswer : knownAnswers)
+    {
+        if (!writer.AppendRecord(MessageWriter::kAnswer, knownAnswer, knownAnswer.mTtl))
+        {
+            writer.SetFlags(Message::kFlagTruncated);
+            SendMulticast(writer, /* aInterfaceIndex */ 0);
+            writer.Reset(0, 0);
+            writer.AppendRecord(MessageWriter::kAnswer, knownAnswer, knownAnswer.mTtl);
+        }
+    }
+
+    if (writer.GetEntryCount() > 0)
+    {
+        SendMulticast(writer, /* aInterfaceIndex */ 0);
+    }
+
+exit:
+    return;
+}
+
+void PublisherNative::SendMulticast(const MessageWriter &aWriter, uint32_t aInterfaceIndex)
+{
+    for (const Socket &socket : mSockets)
+    {
+        sockaddr_storage destination;
+
+        memset(&destination, 0, sizeof(destination));
+
+        if (socket.mFamily == AF_INET6)
+        {
+            sockaddr_in6 &address = reinterpret_cast<sockaddr_in6 &>(destination);
+
+            address.sin6_family = AF_INET6;
+            address.sin6_port   = htons(kMdnsPort);
+            memcpy(&address.sin6_addr, kMulticastAddress6, sizeof(address.sin6_addr));
+        }
+        else
+        {
+            sockaddr_in &address = reinterpret_cast<sockaddr_in &>(destination);
+
+            address.sin_family      = AF_INET;
+            address.sin_port        = htons(kMdnsPort);
+            address.sin_addr.s_addr = htonl(kMulticastAddress4);
+        }
+
+        for (uint32_t index : mInterfaces)
+        {
+            int rval;
+
+            if (aInterfaceIndex != 0 && index != aInterfaceIndex)
+            {
+                continue;
+            }
+
+            if (socket.mFamily == AF_INET6)
+            {
+                rval = setsockopt(socket.mFd, IPPROTO_IPV6, IPV6_MULTICAST_IF, &index, sizeof(index));
+            }
+            else
+            {
+                ip_mreqn request;
+
+                memset(&request, 0, sizeof(request));
+                request.imr_ifindex = static_cast<int>(index);
+                rval                = setsockopt(socket.mFd, IPPROTO_IP, IP_MULTICAST_IF, &request, sizeof(request));
+            }
+
+            if (rval == 0)
+            {
+                SendTo(socket, destination, aWriter);
+            }
+        }
+    }
+}
+
+void PublisherNative::SendTo(const Socket &aSocket, const sockaddr_storage &aDestination, const MessageWriter &aWriter)
+{
+    socklen_t length = (aSocket.mFamily == AF_INET6) ? sizeof(sockaddr_in6) : sizeof(sockaddr_in);
+
+    if (sendto(aSocket.mFd, aWriter.GetBuffer(), aWriter.GetLength(), 0,
+               reinterpret_cast<const sockaddr *>(&aDestination), length) < 0)
+    {
+        otbrLogWarning("Failed to send mDNS message: %s", strerror(errno));
+    }
+}
+
+void PublisherNative::UpdateCache(const Record &aRecord, Timepoint aNow)
+{
+    uint32_t nameHash = HashName(aRecord.mName);
+    bool     found    = false;
+
+    VerifyOrExit(aRecord.mClass == kClassIn);
+
+    for (CacheRecord &cached : mCache)
+    {
+        if (cached.mNameHash != nameHash || cached.mRecord.mType != aRecord.mType ||
+            !IsNameEqual(cached.mRecord.mName, aRecord.mName))
+        {
+            continue;
+        }
+
+        if (cached.mRecord.mData == aRecord.mData)
+        {
+            found = true;
+
+            // A goodbye keeps the record for one more second, see RFC 6762, section 10.1.
+            cached.mRecord.mTtl  = (aRecord.mTtl == 0) ? 1 : aRecord.mTtl;
+            cached.mReceiveTime  = aNow;
+            cached.mRefreshCount = (aRecord.mTtl == 0) ? static_cast<uint8_t>(kMaxRefreshCount) : 0;
+        }
+        else if (aRecord.mCacheFlush && aNow - cached.mReceiveTime > kCacheFlushDelay)
+        {
+            // The other records of a unique record set are flushed one second later, see RFC 6762, section 10.2.
+            cached.mRecord.mTtl  = 1;
+            cached.mReceiveTime  = aNow;
+            cached.mRefreshCount = kMaxRefreshCount;
+        }
+    }
+
+    if (!found && aRecord.mTtl > 0)
+    {
+        CacheRecord cached;
+
+        if (mCache.size() >= kMaxCacheSize)
+        {
+            mCache.erase(std::min_element(mCache.begin(), mCache.end(),
+                                          [](const CacheRecord &aFirst, const CacheRecord &aSecond) {
+                                              return aFirst.GetExpireTime() < aSecond.GetExpireTime();
+                                          }));
+        }
+
+        cached.mRecord       = aRecord;
+        cached.mNameHash     = nameHash;
+        cached.mReceiveTime  = aNow;
+        cached.mRefreshCount = 0;
+        mCache.push_back(std::move(cached));
+    }
+
+    mCacheChanged = true;
+
+exit:
+    return;
+}
+
+void PublisherNative::ExpireCache(Timepoint aNow)
+{
+    size_t size = mCache.size();
+
+    mCache.erase(std::remove_if(mCache.begin(), mCache.end(),
+                                [aNow](const CacheRecord &aRecord) { return aRecord.GetExpireTime() <= aNow; }),
+                 mCache.end());
+
+    if (mCache.size() != size)
+    {
+        mCacheChanged = true;
+    }
+}
+
+void PublisherNative::RefreshCache(Timepoint aNow)
+{
+    for (CacheRecord &cached : mCache)
+    {
+        const std::string &name = cached.mRecord.mName;
+
+        if (cached.mRefreshCount >= kMaxRefreshCount || aNow < GetRefreshTime(cached))
+        {
+            continue;
+        }
+
+        // Records which are still wanted are queried again before they expire, see RFC 6762, section 5.2.
+        cached.mRefreshCount++;
+
+        mSubscribedServices.ForEach([aNow, &name](ServiceSubscription &aSubscription) {
+            if (IsNameEqual(aSubscription.mQueryName, name))
+            {
+                aSubscription.mQueryTime = aNow;
+            }
+        });
+        mSubscribedHosts.ForEach([aNow, &name](HostSubscription &aSubscription) {
+            if (IsNameEqual(aSubscription.mQueryName, name))
+            {
+                aSubscription.mQueryTime = aNow;
+            }
+        });
+    }
+}
+
+Timepoint PublisherNative::GetRefreshTime(const CacheRecord &aRecord)
+{
+    // At 80% and then 90% of the TTL.
+    return aRecord.mReceiveTime + Milliseconds(static_cast<uint64_t>(aRecord.mRecord.mTtl) *
+                                               (800 + 100 * aRecord.mRefreshCount));
+}
+
+void PublisherNative::AppendQuestions(const ServiceSubscription &aSubscription, std::vector<Question> &aQuestions) const
+{
+    if (aSubscription.mInstanceName.empty())
+    {
+        aQuestions.push_back({aSubscription.mQueryName, kTypePtr, kClassIn, /* mUnicastResponse */ false});
+    }
+    else
+    {
+        aQuestions.push_back({aSubscription.mQueryName, kTypeSrv, kClassIn, /* mUnicastResponse */ false});
+        aQuestions.push_back({aSubscription.mQueryName, kTypeTxt, kClassIn, /* mUnicastResponse */ false});
+    }
+
+    aQuestions.insert(aQuestions.end(), aSubscription.mResolveQuestions.begin(),
+                      aSubscription.mResolveQuestions.end());
+}
+
+void PublisherNative::AppendKnownAnswers(const Question &aQuestion, Timepoint aNow, std::vector<Record> &aAnswers) const
+{
+    uint32_t nameHash = HashName(aQuestion.mName);
+
+    for (const CacheRecord &cached : mCache)
+    {
+        Seconds remaining = std::chrono::duration_cast<Seconds>(cached.GetExpireTime() - aNow);
+
+        // Only the records with more than half of their TTL remaining are known answers, see RFC 6762, section 7.1.
+        if (cached.mNameHash != nameHash || cached.mRecord.mType != aQuestion.mType ||
+            !IsNameEqual(cached.mRecord.mName, aQuestion.mName) ||
+            static_cast<uint64_t>(remaining.count()) * 2 <= cached.mRecord.mTtl)
+        {
+            continue;
+        }
+
+        if (!ContainsRecord(aAnswers, cached.mRecord))
+        {
+            aAnswers.push_back(cached.mRecord);
+            aAnswers.back().mTtl = static_cast<uint32_t>(remaining.count());
+        }
+    }
+}
+
+const PublisherNative::CacheRecord *PublisherNative::FindCacheRecord(const std::string &aName, uint16_t aType) const
+{
+    uint32_t nameHash = HashName(aName);
+    auto     cached   = std::find_if(mCache.begin(), mCache.end(), [&](const CacheRecord &aRecord) {
+        return aRecord.mNameHash == nameHash && aRecord.mRecord.mType == aType &&
+               IsNameEqual(aRecord.mRecord.mName, aName);
+    });
+
+    return cached == mCache.end() ? nullptr : &*cached;
+}
+
+bool PublisherNative::ResolveInstance(const std::string &     aInstanceName,
+                                      DiscoveredInstanceInfo &aInstanceInfo,
+                                      std::string &           aHostName) const
+{
+    const CacheRecord *srv      = FindCacheRecord(aInstanceName, kTypeSrv);
+    const CacheRecord *txt      = FindCacheRecord(aInstanceName, kTypeTxt);
+    bool               resolved = false;
+
+    VerifyOrExit(srv != nullptr && txt != nullptr);
+    VerifyOrExit(ReadNameData(srv->mRecord.mData, kSrvTargetOffset, aHostName) == OTBR_ERROR_NONE);
+
+    aInstanceInfo.mName     = GetFirstNameLabel(aInstanceName);
+    aInstanceInfo.mHostName = NameToString(aHostName);
+    aInstanceInfo.mPriority = static_cast<uint16_t>(srv->mRecord.mData[0] << 8 | srv->mRecord.mData[1]);
+    aInstanceInfo.mWeight   = static_cast<uint16_t>(srv->mRecord.mData[2] << 8 | srv->mRecord.mData[3]);
+    aInstanceInfo.mPort     = static_cast<uint16_t>(srv->mRecord.mData[4] << 8 | srv->mRecord.mData[5]);
+    aInstanceInfo.mTxtData  = txt->mRecord.mData;
+    aInstanceInfo.mTtl      = std::min(srv->mRecord.mTtl, txt->mRecord.mTtl);
+    ResolveAddresses(aHostName, aInstanceInfo.mAddresses, aInstanceInfo.mTtl);
+
+    resolved = true;
+
+exit:
+    return resolved;
+}
+
+void PublisherNative::ResolveAddresses(const std::string &      aHostName,
+                                       std::vector<Ip6Address> &aAddresses,
+                                       uint32_t &               aTtl) const
+{
+    uint32_t nameHash = HashName(aHostName);
+
+    aAddresses.clear();
+
+    for (const CacheRecord &cached : mCache)
+    {
+        Ip6Address address;
+
+        if (cached.mNameHash != nameHash || cached.mRecord.mType != kTypeAaaa ||
+            cached.mRecord.mData.size() != sizeof(address) || !IsNameEqual(cached.mRecord.mName, aHostName))
+        {
+            continue;
+        }
+
+        memcpy(&address, cached.mRecord.mData.data(), sizeof(address));
+        if (address.IsUnspecified() || address.IsLinkLocal() || address.IsMulticast() || address.IsLoopback())
+        {
+            continue;
+        }
+
+        aAddresses.push_back(address);
+        aTtl = (aAddresses.size() == 1) ? cached.mRecord.mTtl : std::min(aTtl, cached.mRecord.mTtl);
+    }
+
+    std::sort(aAddresses.begin(), aAddresses.end());
+    aAddresses.erase(std::unique(aAddresses.begin(), aAddresses.end()), aAddresses.end());
+}
+
+void PublisherNative::EvaluateSubscriptions(void)
+{
+    InstanceList                                             instances;
+    std::vector<std::pair<std::string, DiscoveredHostInfo>> hosts;
+
+    VerifyOrExit(mCacheChanged);
+    mCacheChanged = false;
+
+    mSubscribedServices.ForEach(
+        [this, &instances](ServiceSubscription &aSubscription) { EvaluateSubscription(aSubscription, instances); });
+
+    mSubscribedHosts.ForEach([this, &hosts](HostSubscription &aSubscription) {
+        DiscoveredHostInfo hostInfo;
+
+        hostInfo.mHostName = NameToString(aSubscription.mQueryName);
+        ResolveAddresses(aSubscription.mQueryName, hostInfo.mAddresses, hostInfo.mTtl);
+
+        if (hostInfo.mAddresses != aSubscription.mHostInfo.mAddresses)
+        {
+            aSubscription.mHostInfo = hostInfo;
+            if (!hostInfo.mAddresses.empty())
+            {
+                hosts.emplace_back(aSubscription.mHostName, hostInfo);
+            }
+        }
+    });
+
+    // The callbacks may subscribe or unsubscribe, so they are called after evaluating all subscriptions.
+    for (const auto &instance : instances)
+    {
+        otbrLogInfo("Service %s instance %s is %s", instance.first.c_str(), instance.second.mName.c_str(),
+                    instance.second.mRemoved ? "removed" : "resolved");
+
+        if (mDiscoveredServiceInstanceCallback != nullptr)
+        {
+            mDiscoveredServiceInstanceCallback(instance.first, instance.second);
+        }
+    }
+
+    for (const auto &host : hosts)
+    {
+        otbrLogInfo("Host %s is resolved with %zu addresses", host.first.c_str(), host.second.mAddresses.size());
+
+        if (mDiscoveredHostCallback != nullptr)
+        {
+            mDiscoveredHostCallback(host.first, host.second);
+        }
+    }
+
+exit:
+    return;
+}
+
+void PublisherNative::EvaluateSubscription(ServiceSubscription &aSubscription, InstanceList &aInstances)
+{
+    std::vector<std::string> instanceNames;
+    std::vector<std::string> present;
+    std::vector<Question>    questions;
+
+    VerifyOrExit(!aSubscription.mQueryName.empty());
+
+    if (aSubscription.mInstanceName.empty())
+    {
+        for (const CacheRecord &cached : mCache)
+        {
+            std::string instanceName;
+
+            if (cached.mRecord.mType == kTypePtr && IsNameEqual(cached.mRecord.mName, aSubscription.mQueryName) &&
+                ReadNameData(cached.mRecord.mData, 0, instanceName) == OTBR_ERROR_NONE &&
+                IsNameEqual(GetParentName(instanceName), aSubscription.mQueryName))
+            {
+                instanceNames.push_back(instanceName);
+                present.push_back(GetFirstNameLabel(instanceName));
+            }
+        }
+    }
+    else
+    {
+        instanceNames.push_back(aSubscription.mQueryName);
+    }
+
+    for (const std::string &instanceName : instanceNames)
+    {
+        DiscoveredInstanceInfo instanceInfo;
+        std::string            hostName;
+
+        // Details which didn't come along with the PTR records are queried.
+        if (!ResolveInstance(instanceName, instanceInfo, hostName))
+        {
+            questions.push_back({instanceName, kTypeSrv, kClassIn, /* mUnicastResponse */ false});
+            questions.push_back({instanceName, kTypeTxt, kClassIn, /* mUnicastResponse */ false});
+            continue;
+        }
+
+        if (instanceInfo.mAddresses.empty())
+        {
+            questions.push_back({hostName, kTypeAaaa, kClassIn, /* mUnicastResponse */ false});
+        }
+
+        if (!aSubscription.mInstanceName.empty())
+        {
+            present.push_back(instanceInfo.mName);
+        }
+
+        auto reported = aSubscription.mInstances.find(instanceInfo.mName);
+
+        if (reported == aSubscription.mInstances.end() || !IsSameInstance(reported->second, instanceInfo))
+        {
+            aSubscription.mInstances[instanceInfo.mName] = instanceInfo;
+            aInstances.emplace_back(aSubscription.mType, instanceInfo);
+        }
+    }
+
+    for (auto reported = aSubscription.mInstances.begin(); reported != aSubscription.mInstances.end();)
+    {
+        if (std::find(present.begin(), present.end(), reported->first) == present.end())
+        {
+            DiscoveredInstanceInfo instanceInfo;
+
+            instanceInfo.mRemoved = true;
+            instanceInfo.mName    = reported->first;
+            aInstances.emplace_back(aSubscription.mType, instanceInfo);
+            reported = aSubscription.mInstances.erase(reported);
+        }
+        else
+        {
+            ++reported;
+        }
+    }
+
+    for (const Question &question : questions)
+    {
+        if (!ContainsQuestion(aSubscription.mResolveQuestions, question))
+        {
+            ScheduleQuery(aSubscription, kResolveDelay);
+            break;
+        }
+    }
+    aSubscription.mResolveQuestions = std::move(questions);
+
+exit:
+    return;
+}
+
+void PublisherNative::ScheduleQuery(Subscription &aSubscription, Milliseconds aDelay)
+{
+    aSubscription.mQueryTime = std::min(aSubscription.mQueryTime, Clock::now() + aDelay);
+}
+
+void PublisherNative::SubscribeService(const std::string &aType, const std::string &aInstanceName)
+{
+    bool                            isNew;
+    ServiceSubscriptionPool::Handle handle;
+    std::string                     serviceName;
+    std::string                     queryName;
+
+    handle = mSubscribedServices.Acquire(
+        ServiceKey(aType, aInstanceName), [&]() { return new ServiceSubscription(aType, aInstanceName); }, isNew);
+
+    otbrLogInfo("subscribe service %s.%s (total %zu, references %u)", aInstanceName.c_str(), aType.c_str(),
+                mSubscribedServices.GetSize(), ServiceSubscriptionPool::GetRefCount(handle));
+
+    VerifyOrExit(isNew);
+
+    if (!aInstanceName.empty())
+    {
+        VerifyOrExit(AppendNameLabel(queryName, aInstanceName) == OTBR_ERROR_NONE,
+                     otbrLogWarning("Invalid service instance name %s", aInstanceName.c_str()));
+    }
+    VerifyOrExit(MakeServiceName(aType.c_str(), serviceName) == OTBR_ERROR_NONE,
+                 otbrLogWarning("Invalid service type %s", aType.c_str()));
+
+    ServiceSubscriptionPool::Get(handle).mQueryName = queryName + serviceName;
+    ScheduleQuery(ServiceSubscriptionPool::Get(handle), RandomDelay(20, 120));
+
+    // Report the instances already in the cache.
+    mCacheChanged = true;
+
+exit:
+    return;
+}
+
+void PublisherNative::UnsubscribeService(const std::string &aType, const std::string &aInstanceName)
+{
+    ServiceSubscriptionPool::Handle handle = mSubscribedServices.Find(ServiceKey(aType, aInstanceName));
+
+    assert(mSubscribedServices.IsValid(handle));
+    mSubscribedServices.Release(handle);
+
+    otbrLogInfo("unsubscribe service %s.%s (left %zu)", aInstanceName.c_str(), aType.c_str(),
+                mSubscribedServices.GetSize());
+}
+
+void PublisherNative::SubscribeHost(const std::string &aHostName)
+{
+    bool                         isNew;
+    HostSubscriptionPool::Handle handle;
+    std::string                  queryName;
+
+    handle = mSubscribedHosts.Acquire(aHostName, [&]() { return new HostSubscription(aHostName); }, isNew);
+
+    otbrLogInfo("subscribe host %s (total %zu, references %u)", aHostName.c_str(), mSubscribedHosts.GetSize(),
+                HostSubscriptionPool::GetRefCount(handle));
+
+    VerifyOrExit(isNew);
+    VerifyOrExit(MakeHostName(aHostName, queryName) == OTBR_ERROR_NONE,
+                 otbrLogWarning("Invalid host name %s", aHostName.c_str()));
+
+    HostSubscriptionPool::Get(handle).mQueryName = queryName;
+    ScheduleQuery(HostSubscriptionPool::Get(handle), RandomDelay(20, 120));
+    mCacheChanged = true;
+
+exit:
+    return;
+}
+
+void PublisherNative::UnsubscribeHost(const std::string &aHostName)
+{
+    HostSubscriptionPool::Handle handle = mSubscribedHosts.Find(aHostName);
+
+    assert(mSubscribedHosts.IsValid(handle));
+    mSubscribedHosts.Release(handle);
+
+    otbrLogInfo("unsubscribe host %s (remaining %zu)", aHostName.c_str(), mSubscribedHosts.GetSize());
+}
+
+void PublisherNative::Update(MainloopContext &aMainloop)
+{
+    Timepoint now      = Clock::now();
+    Timepoint deadline = Timepoint::max();
+
+    for (const Socket &socket : mSockets)
+    {
+        FD_SET(socket.mFd, &aMainloop.mReadFdSet);
+        aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, socket.mFd);
+    }
+
+    if (mNetlinkFd >= 0)
+    {
+        FD_SET(mNetlinkFd, &aMainloop.mReadFdSet);
+        aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, mNetlinkFd);
+    }
+
+    if (mStateChanged || mCacheChanged || !mResults.empty())
+    {
+        deadline = now;
+    }
+
+    VerifyOrExit(mIsStarted);
+
+    for (const Entry &entry : mEntries)
+    {
+        if (entry.mState != EntryState::kRegistered)
+        {
+            deadline = std::min(deadline, entry.mTxTime);
+        }
+    }
+
+    deadline = std::min(deadline, mMulticastTime);
+
+    for (const CacheRecord &cached : mCache)
+    {
+        deadline = std::min(deadline, cached.GetExpireTime());
+        if (cached.mRefreshCount < kMaxRefreshCount)
+        {
+            deadline = std::min(deadline, GetRefreshTime(cached));
+        }
+    }
+
+    mSubscribedServices.ForEach(
+        [&deadline](ServiceSubscription &aSubscription) { deadline = std::min(deadline, aSubscription.mQueryTime); });
+    mSubscribedHosts.ForEach(
+        [&deadline](HostSubscription &aSubscription) { deadline = std::min(deadline, aSubscription.mQueryTime); });
+
+exit:
+    if (deadline != Timepoint::max())
+    {
+        Microseconds delay = (deadline <= now) ? Microseconds::zero()
+                                               : std::chrono::duration_cast<Microseconds>(deadline - now);
+
+        if (delay < FromTimeval<Microseconds>(aMainloop.mTimeout))
+        {
+            aMainloop.mTimeout = ToTimeval(delay);
+        }
+    }
+}
+
+void PublisherNative::Process(const MainloopContext &aMainloop)
+{
+    for (const Socket &socket : mSockets)
+    {
+        if (FD_ISSET(socket.mFd, &aMainloop.mReadFdSet))
+        {
+            for (uint8_t count = 0; count < kMaxReceiveBurst && Receive(socket); count++)
+            {
+            }
+        }
+    }
+
+    if (mNetlinkFd >= 0 && FD_ISSET(mNetlinkFd, &aMainloop.mReadFdSet))
+    {
+        ProcessNetlink();
+    }
+
+    if (mIsStarted)
+    {
+        Timepoint now = Clock::now();
+
+        ExpireCache(now);
+        RefreshCache(now);
+        SendProbes(now);
+        SendAnnouncements(now);
+        SendQueries(now);
+
+        if (now >= mMulticastTime)
+        {
+            SendMulticastResponse();
+        }
+    }
+
+    EvaluateSubscriptions();
+
+    if (mStateChanged)
+    {
+        mStateChanged = false;
+        mStateHandler(mContext, mIsStarted ? State::kReady : State::kIdle);
+    }
+
+    ReportResults();
+}
+
+void PublisherNative::ReportResults(void)
+{
+    std::vector<PublishResult> results;
+
+    // The handlers may publish again, so they are called on a copy of the pending results.
+    results.swap(mResults);
+
+    for (const PublishResult &result : results)
+    {
+        if (result.mType.empty())
+        {
+            if (mHostHandler != nullptr)
+            {
+                mHostHandler(result.mName.c_str(), result.mError, mHostHandlerContext);
+            }
+        }
+        else if (mServiceHandler != nullptr)
+        {
+            mServiceHandler(result.mName.c_str(), result.mType.c_str(), result.mError, mServiceHandlerContext);
+        }
+    }
+}
+
+Milliseconds PublisherNative::RandomDelay(uint32_t aMin, uint32_t aMax)
+{
+    return Milliseconds(std::uniform_int_distribution<uint32_t>(aMin, aMax)(mRandom));
+}
+
+Publisher *Publisher::Create(int          aFamily,
+                             const char * aDomain,
+                             StateHandler aHandler,
+                             void *       aContext,
+                             uint32_t     aInterfaceIndex)
+{
+    return new PublisherNative(aFamily, aDomain, aHandler, aContext, aInterfaceIndex);
+}
+
+void Publisher::Destroy(Publisher *aPublisher)
+{
+    delete static_cast<PublisherNative *>(aPublisher);
+}
+
+} // namespace Mdns
+
+} // namespace otbr
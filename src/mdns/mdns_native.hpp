@@ -0,0 +1,387 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for an mDNS responder running in the agent, without an mDNS daemon.
+ */
+
+#ifndef OTBR_AGENT_MDNS_NATIVE_HPP_
+#define OTBR_AGENT_MDNS_NATIVE_HPP_
+
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <sys/socket.h>
+
+#include "common/time.hpp"
+#include "common/types.hpp"
+#include "mdns/mdns.hpp"
+#include "mdns/mdns_packet.hpp"
+#include "mdns/subscription_pool.hpp"
+
+namespace otbr {
+
+namespace Mdns {
+
+/**
+ * This class implements MDNS service with a native mDNS responder and querier (RFC 6762).
+ *
+ * Hosts and services are probed and announced by the agent itself on its mainloop. Their records are kept in a flat
+ * array which queries scan by name hash. Responses to multicast queries are delayed and aggregated into as few
+ * packets as possible, leaving out the answers which the querier already knows. The addresses of the local host are
+ * published only on their own interfaces, and queries are answered on the interface which they came in on. Interfaces
+ * and addresses which come and go later are followed through netlink.
+ *
+ */
+class PublisherNative : public Publisher
+{
+public:
+    /**
+     * The constructor to initialize a Publisher.
+     *
+     * @param[in]   aProtocol           The protocol used for publishing. IPv4, IPv6 or both.
+     * @param[in]   aDomain             The domain of the host. nullptr to use default.
+     * @param[in]   aHandler            The function to be called when state changes.
+     * @param[in]   aContext            A pointer to application-specific context.
+     * @param[in]   aInterfaceIndex     The network interface to publish and browse on, or 0 for all interfaces.
+     *
+     */
+    PublisherNative(int          aProtocol,
+                    const char * aDomain,
+                    StateHandler aHandler,
+                    void *       aContext,
+                    uint32_t     aInterfaceIndex);
+
+    ~PublisherNative(void) override;
+
+    otbrError PublishService(const char *   aHostName,
+                             uint16_t       aPort,
+                             const char *   aName,
+                             const char *   aType,
+                             const TxtList &aTxtList) override;
+    otbrError UnpublishService(const char *aName, const char *aType) override;
+    otbrError PublishHost(const char *aName, const uint8_t *aAddress, uint8_t aAddressLength) override;
+    otbrError UnpublishHost(const char *aName) override;
+    void      SubscribeService(const std::string &aType, const std::string &aInstanceName) override;
+    void      UnsubscribeService(const std::string &aType, const std::string &aInstanceName) override;
+    void      SubscribeHost(const std::string &aHostName) override;
+    void      UnsubscribeHost(const std::string &aHostName) override;
+    otbrError Start(void) override;
+    bool      IsStarted(void) const override;
+    void      Stop(void) override;
+    void      Update(MainloopContext &aMainloop) override;
+    void      Process(const MainloopContext &aMainloop) override;
+
+private:
+    friend class PublisherNativeTest; // Drives the responder with crafted messages in the unit tests.
+
+    enum : uint16_t
+    {
+        kMdnsPort           = 5353,
+        kMaxMessageSize     = 1440, // Fits in an Ethernet frame with the IPv6 and UDP headers.
+        kMaxReceiveSize     = 9000, // See RFC 6762, section 17.
+        kMaxSizeOfTxtRecord = 1024,
+        kMaxCacheSize       = 1024,
+    };
+
+    enum class EntryState : uint8_t
+    {
+        kProbing,    ///< Probing for the uniqueness of its names.
+        kAnnouncing, ///< Announcing its records.
+        kRegistered, ///< Answering queries for its records.
+    };
+
+    // A host or a service instance, which is probed and announced as a whole.
+    struct Entry
+    {
+        uint32_t             mId;
+        std::string          mName;     // The requested host name, or the requested service instance name.
+        std::string          mType;     // The service type, or empty for hosts.
+        std::string          mFullName; // The domain name of the host or the service instance, renamed on conflicts.
+        std::string          mHostName; // The requested host name of a service, or empty for the local host.
+        uint16_t             mPort;     // The port of a service.
+        std::vector<uint8_t> mData;     // The TXT data of a service, or the address of a host.
+        EntryState           mState;
+        uint8_t              mTxCount;     // The number of probes or announcements sent in the current state.
+        uint8_t              mRenameCount; // The number of renames after name conflicts.
+        Timepoint            mTxTime;      // When to send the next probe or announcement.
+
+        bool IsHost(void) const { return mType.empty(); }
+    };
+
+    struct LocalRecord
+    {
+        Record    mRecord;
+        uint32_t  mEntryId;
+        uint32_t  mNameHash;
+        uint32_t  mInterfaceIndex; // The interface of the address in the record, or 0 for all interfaces.
+        Timepoint mMulticastTime;  // When the record was last multicast.
+
+        bool IsOnInterface(uint32_t aInterfaceIndex) const
+        {
+            return mInterfaceIndex == 0 || aInterfaceIndex == 0 || mInterfaceIndex == aInterfaceIndex;
+        }
+    };
+
+    // A record waiting for the aggregated multicast response.
+    struct QueuedRecord
+    {
+        Record   mRecord;
+        uint32_t mInterfaceIndex; // The interface to send the record on, or 0 for all interfaces.
+    };
+
+    struct CacheRecord
+    {
+        Record    mRecord;
+        uint32_t  mNameHash;
+        Timepoint mReceiveTime;
+        uint8_t   mRefreshCount; // The number of queries sent to refresh the record before it expires.
+
+        Timepoint GetExpireTime(void) const { return mReceiveTime + Seconds(mRecord.mTtl); }
+    };
+
+    // A question which is asked again and again with exponential back-off, see RFC 6762, section 5.2.
+    struct Subscription
+    {
+        Subscription(void);
+
+        Timepoint    mQueryTime;
+        Milliseconds mQueryInterval;
+    };
+
+    struct ServiceSubscription : public Subscription
+    {
+        ServiceSubscription(const std::string &aType, const std::string &aInstanceName)
+            : mType(aType)
+            , mInstanceName(aInstanceName)
+        {
+        }
+
+        std::string                                   mType;
+        std::string                                   mInstanceName;
+        std::string                                   mQueryName; // The service name, or the instance name.
+        std::map<std::string, DiscoveredInstanceInfo> mInstances; // The instances reported, by name.
+        std::vector<Question> mResolveQuestions; // The questions for the details of incomplete instances.
+    };
+
+    struct HostSubscription : public Subscription
+    {
+        explicit HostSubscription(const std::string &aHostName)
+            : mHostName(aHostName)
+        {
+        }
+
+        std::string        mHostName;
+        std::string        mQueryName;
+        DiscoveredHostInfo mHostInfo; // The host reported.
+    };
+
+    struct Socket
+    {
+        int mFd;
+        int mFamily;
+    };
+
+    struct PublishResult
+    {
+        std::string mName;
+        std::string mType;
+        otbrError   mError;
+    };
+
+    typedef std::pair<std::string, std::string>                         ServiceKey; // The service type and instance.
+    typedef SubscriptionPool<ServiceKey, ServiceSubscription>           ServiceSubscriptionPool;
+    typedef SubscriptionPool<std::string, HostSubscription>             HostSubscriptionPool;
+    typedef std::vector<std::pair<std::string, DiscoveredInstanceInfo>> InstanceList;
+
+    // An address of the local host on one of its interfaces.
+    struct HostAddress
+    {
+        uint32_t             mInterfaceIndex;
+        uint16_t             mType; // The type of the address record.
+        std::vector<uint8_t> mData;
+    };
+
+    std::vector<uint32_t> FindInterfaces(void) const;
+    bool                  IsInterface(uint32_t aInterfaceIndex) const;
+    void                  AddInterface(uint32_t aInterfaceIndex);
+    void                  RemoveInterface(uint32_t aInterfaceIndex);
+    void                  SyncInterfaces(void);
+    otbrError             OpenSocket(int aFamily);
+    void                  CloseSockets(void);
+    void                  UpdateMembership(const Socket &aSocket, uint32_t aInterfaceIndex, bool aJoin);
+    void                  OpenNetlink(void);
+    void                  CloseNetlink(void);
+    void                  ProcessNetlink(void);
+    void                  HandleLinkChange(uint32_t aInterfaceIndex, unsigned int aFlags, bool aIsDeleted);
+    void                  HandleAddressChange(uint32_t    aInterfaceIndex,
+                                              int         aFamily,
+                                              const void *aAddress,
+                                              bool        aIsDeleted);
+
+    otbrError AddLocalHost(void);
+    otbrError SyncLocalHostAddresses(uint32_t aInterfaceIndex);
+    bool      MakeHostAddress(uint32_t     aInterfaceIndex,
+                              int          aFamily,
+                              const void * aAddress,
+                              HostAddress &aHostAddress) const;
+    bool      IsLocalHostAddress(const LocalRecord &aRecord, const HostAddress &aAddress) const;
+    void      AddLocalHostAddress(const HostAddress &aAddress);
+    void      RemoveLocalHostAddress(const HostAddress &aAddress, bool aSendGoodbye);
+
+    otbrError MakeServiceName(const char *aType, std::string &aName) const;
+    otbrError MakeHostName(const std::string &aHostName, std::string &aName) const;
+    otbrError MakeTargetName(const std::string &aHostName, std::string &aName);
+
+    Entry *      FindEntry(uint32_t aId);
+    const Entry *FindEntry(uint32_t aId) const;
+    Entry *      FindEntry(const std::string &aName, const std::string &aType);
+    Entry &      AddEntry(const std::string &aName, const std::string &aType, const std::string &aFullName);
+    void         RemoveEntry(uint32_t aEntryId, bool aSendGoodbye);
+    void         AddRecord(uint32_t               aEntryId,
+                           const std::string &    aName,
+                           uint16_t               aType,
+                           bool                   aUnique,
+                           std::vector<uint8_t> &&aData,
+                           uint32_t               aInterfaceIndex = 0);
+    void         RemoveRecords(uint32_t aEntryId, bool aSendGoodbye);
+    bool         IsRecordShared(const LocalRecord &aRecord) const;
+    bool         IsLocalRecord(const Record &aRecord) const;
+    void         StartProbing(Entry &aEntry, Milliseconds aDelay);
+    void         StartAnnouncing(Entry &aEntry);
+    void         HandleConflict(uint32_t aEntryId);
+    bool         RenameEntry(Entry &aEntry);
+    otbrError    AddServiceRecords(const Entry &aEntry);
+    void         AddHostRecords(const Entry &aEntry);
+    void         UpdateServiceTargets(const std::string &aHostName);
+
+    bool Receive(const Socket &aSocket);
+    void HandleQuery(const Message &         aMessage,
+                     const Socket &          aSocket,
+                     const sockaddr_storage &aSource,
+                     bool                    aIsLegacy,
+                     uint32_t                aInterfaceIndex);
+    void HandleProbe(const Message &aMessage, uint32_t aInterfaceIndex);
+    void HandleResponse(const Message &aMessage, uint32_t aInterfaceIndex);
+    void CheckConflict(const Record &aRecord, std::vector<uint32_t> &aConflicts) const;
+    bool IsKnownAnswer(const Message &aMessage, const Record &aRecord) const;
+    void AppendAnswers(const Question &     aQuestion,
+                       const Message &      aMessage,
+                       uint32_t             aInterfaceIndex,
+                       Timepoint            aNow,
+                       bool                 aRateLimit,
+                       std::vector<Record> &aAnswers) const;
+    void AppendAdditionals(const std::vector<Record> &aAnswers,
+                           uint32_t                   aInterfaceIndex,
+                           std::vector<Record> &      aAdditionals) const;
+    void AppendLocalRecords(const std::string &  aName,
+                            uint16_t             aType,
+                            uint32_t             aInterfaceIndex,
+                            std::vector<Record> &aRecords) const;
+    void QueueMulticast(const Record &aRecord, uint32_t aInterfaceIndex, Timepoint aSendTime, bool aIsAnswer);
+    void RemoveMulticast(const Record &aRecord);
+    void SendMulticastResponse(void);
+    void SendMulticastResponse(uint32_t aInterfaceIndex);
+    void SendUnicastResponse(const Socket &          aSocket,
+                             const sockaddr_storage &aDestination,
+                             const Message &         aQuery,
+                             bool                    aIsLegacy,
+                             std::vector<Record> &   aAnswers,
+                             std::vector<Record> &   aAdditionals);
+    void SendProbes(Timepoint aNow);
+    bool WriteProbes(MessageWriter &             aWriter,
+                     const std::vector<Entry *> &aEntries,
+                     size_t                      aBegin,
+                     size_t                      aEnd,
+                     uint32_t                    aInterfaceIndex) const;
+    void SendAnnouncements(Timepoint aNow);
+    void SendGoodbyes(uint32_t aEntryId);
+    void SendQueries(Timepoint aNow);
+    void SendMulticast(const MessageWriter &aWriter, uint32_t aInterfaceIndex);
+    void SendTo(const Socket &aSocket, const sockaddr_storage &aDestination, const MessageWriter &aWriter);
+
+    void             UpdateCache(const Record &aRecord, Timepoint aNow);
+    void             ExpireCache(Timepoint aNow);
+    void             RefreshCache(Timepoint aNow);
+    static Timepoint GetRefreshTime(const CacheRecord &aRecord);
+
+    void AppendQuestions(const ServiceSubscription &aSubscription, std::vector<Question> &aQuestions) const;
+    void AppendKnownAnswers(const Question &aQuestion, Timepoint aNow, std::vector<Record> &aAnswers) const;
+    const CacheRecord *FindCacheRecord(const std::string &aName, uint16_t aType) const;
+    bool               ResolveInstance(const std::string &     aInstanceName,
+                                       DiscoveredInstanceInfo &aInstanceInfo,
+                                       std::string &           aHostName) const;
+    void ResolveAddresses(const std::string &aHostName, std::vector<Ip6Address> &aAddresses, uint32_t &aTtl) const;
+    void EvaluateSubscriptions(void);
+    void EvaluateSubscription(ServiceSubscription &aSubscription, InstanceList &aInstances);
+    void ScheduleQuery(Subscription &aSubscription, Milliseconds aDelay);
+
+    void         ReportResults(void);
+    Milliseconds RandomDelay(uint32_t aMin, uint32_t aMax);
+
+    int          mProtocol;
+    std::string  mDomain;
+    uint32_t     mInterfaceIndex;
+    StateHandler mStateHandler;
+    void *       mContext;
+    bool         mIsStarted;
+    bool         mStateChanged;
+    bool         mCacheChanged;
+
+    std::vector<Socket>   mSockets;
+    int                   mNetlinkFd; // Reports the interfaces and addresses which come and go.
+    std::vector<uint32_t> mInterfaces;
+    std::string           mHostName;
+    uint32_t              mLocalHostEntryId;
+    uint32_t              mNextEntryId;
+
+    std::vector<Entry>       mEntries;
+    std::vector<LocalRecord> mRecords;
+    std::vector<CacheRecord> mCache;
+
+    std::vector<QueuedRecord> mMulticastAnswers;
+    std::vector<QueuedRecord> mMulticastAdditionals;
+    Timepoint                 mMulticastTime; // When to send the aggregated multicast response.
+
+    std::vector<PublishResult> mResults; // The publication results to report.
+
+    ServiceSubscriptionPool mSubscribedServices;
+    HostSubscriptionPool    mSubscribedHosts;
+
+    std::mt19937 mRandom;
+};
+
+} // namespace Mdns
+
+} // namespace otbr
+
+#endif // OTBR_AGENT_MDNS_NATIVE_HPP_
@@ -0,0 +1,602 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements encoding and decoding mDNS packets.
+ */
+
+#include "mdns/mdns_packet.hpp"
+
+#include <algorithm>
+
+#include <assert.h>
+#include <string.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+namespace Mdns {
+
+enum : uint16_t
+{
+    kMaxLabelLength   = 63,
+    kMaxNameLength    = 255, // Including the length bytes and the root label.
+    kMaxPointerOffset = 0x3fff,
+    kClassFlag        = 0x8000, // The cache-flush bit of records or the unicast-response bit of questions.
+    kSrvFixedLength   = 6,      // The priority, weight and port before the target of SRV records.
+    kRecordFixedSize  = 10,     // The type, class, TTL and data length after the name of records.
+    kMinQuestionSize  = 5,      // The root name, type and class.
+};
+
+static uint16_t ReadUint16(const uint8_t *aBuffer)
+{
+    return static_cast<uint16_t>(aBuffer[0] << 8 | aBuffer[1]);
+}
+
+static uint32_t ReadUint32(const uint8_t *aBuffer)
+{
+    return static_cast<uint32_t>(ReadUint16(aBuffer)) << 16 | ReadUint16(aBuffer + 2);
+}
+
+static uint8_t ToLower(uint8_t aChar)
+{
+    return (aChar >= 'A' && aChar <= 'Z') ? static_cast<uint8_t>(aChar - 'A' + 'a') : aChar;
+}
+
+// Reads a possibly compressed name at @p aOffset, which is advanced past the name in the message.
+static otbrError ReadName(const uint8_t *aBuffer, size_t aLength, size_t &aOffset, std::string &aName)
+{
+    otbrError error  = OTBR_ERROR_PARSE;
+    size_t    offset = aOffset;
+    size_t    limit  = aOffset; // Pointers must go strictly backwards so that they can't loop.
+    bool      jumped = false;
+
+    aName.clear();
+
+    while (true)
+    {
+        uint8_t labelLength;
+
+        VerifyOrExit(offset < aLength);
+        labelLength = aBuffer[offset];
+
+        if (labelLength == 0)
+        {
+            offset++;
+            break;
+        }
+
+        if ((labelLength & 0xc0) == 0xc0)
+        {
+            size_t pointer;
+
+            VerifyOrExit(offset + 1 < aLength);
+            pointer = ReadUint16(&aBuffer[offset]) & kMaxPointerOffset;
+            VerifyOrExit(pointer < limit);
+
+            if (!jumped)
+            {
+                aOffset = offset + sizeof(uint16_t);
+                jumped  = true;
+            }
+
+            limit  = pointer;
+            offset = pointer;
+            continue;
+        }
+
+        VerifyOrExit(labelLength <= kMaxLabelLength);
+        VerifyOrExit(offset + 1 + labelLength <= aLength);
+        VerifyOrExit(aName.size() + 1 + labelLength < kMaxNameLength);
+
+        aName.append(reinterpret_cast<const char *>(&aBuffer[offset]), 1 + labelLength);
+        offset += 1 + labelLength;
+    }
+
+    if (!jumped)
+    {
+        aOffset = offset;
+    }
+
+    error = OTBR_ERROR_NONE;
+
+exit:
+    return error;
+}
+
+static otbrError ReadQuestion(const uint8_t *aBuffer, size_t aLength, size_t &aOffset, Question &aQuestion)
+{
+    otbrError error;
+    uint16_t  rrClass;
+
+    SuccessOrExit(error = ReadName(aBuffer, aLength, aOffset, aQuestion.mName));
+    VerifyOrExit(aOffset + 2 * sizeof(uint16_t) <= aLength, error = OTBR_ERROR_PARSE);
+
+    aQuestion.mType            = ReadUint16(&aBuffer[aOffset]);
+    rrClass                    = ReadUint16(&aBuffer[aOffset + sizeof(uint16_t)]);
+    aQuestion.mClass           = rrClass & ~kClassFlag;
+    aQuestion.mUnicastResponse = (rrClass & kClassFlag) != 0;
+    aOffset += 2 * sizeof(uint16_t);
+
+exit:
+    return error;
+}
+
+// Reads a name within record data and appends it uncompressed to @p aData.
+static otbrError ReadDataName(const uint8_t *       aBuffer,
+                              size_t                aLength,
+                              size_t &              aOffset,
+                              std::vector<uint8_t> &aData)
+{
+    otbrError   error;
+    std::string name;
+
+    SuccessOrExit(error = ReadName(aBuffer, aLength, aOffset, name));
+    AppendNameData(aData, name);
+
+exit:
+    return error;
+}
+
+static otbrError ReadRecord(const uint8_t *aBuffer, size_t aLength, size_t &aOffset, Record &aRecord)
+{
+    otbrError error;
+    uint16_t  rrClass;
+    uint16_t  dataLength;
+    size_t    dataEnd;
+    size_t    offset;
+
+    SuccessOrExit(error = ReadName(aBuffer, aLength, aOffset, aRecord.mName));
+    VerifyOrExit(aOffset + kRecordFixedSize <= aLength, error = OTBR_ERROR_PARSE);
+
+    aRecord.mType       = ReadUint16(&aBuffer[aOffset]);
+    rrClass             = ReadUint16(&aBuffer[aOffset + 2]);
+    aRecord.mClass      = rrClass & ~kClassFlag;
+    aRecord.mCacheFlush = (rrClass & kClassFlag) != 0;
+    aRecord.mTtl        = ReadUint32(&aBuffer[aOffset + 4]);
+    dataLength          = ReadUint16(&aBuffer[aOffset + 8]);
+    aOffset += kRecordFixedSize;
+
+    dataEnd = aOffset + dataLength;
+    VerifyOrExit(dataEnd <= aLength, error = OTBR_ERROR_PARSE);
+
+    aRecord.mData.clear();
+    offset = aOffset;
+
+    switch (aRecord.mType)
+    {
+    case kTypePtr:
+        SuccessOrExit(error = ReadDataName(aBuffer, dataEnd, offset, aRecord.mData));
+        break;
+
+    case kTypeSrv:
+        VerifyOrExit(dataLength > kSrvFixedLength, error = OTBR_ERROR_PARSE);
+        aRecord.mData.assign(&aBuffer[offset], &aBuffer[offset + kSrvFixedLength]);
+        offset += kSrvFixedLength;
+        SuccessOrExit(error = ReadDataName(aBuffer, dataEnd, offset, aRecord.mData));
+        break;
+
+    default:
+        aRecord.mData.assign(&aBuffer[offset], &aBuffer[dataEnd]);
+        offset = dataEnd;
+        break;
+    }
+
+    VerifyOrExit(offset == dataEnd, error = OTBR_ERROR_PARSE);
+    aOffset = dataEnd;
+
+exit:
+    return error;
+}
+
+static otbrError ReadRecords(const uint8_t *      aBuffer,
+                             size_t               aLength,
+                             size_t &             aOffset,
+                             uint16_t             aCount,
+                             std::vector<Record> &aRecords)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    // Check the count against the length before allocating the records.
+    VerifyOrExit(aCount <= (aLength - aOffset) / (1 + kRecordFixedSize), error = OTBR_ERROR_PARSE);
+    aRecords.resize(aCount);
+
+    for (Record &record : aRecords)
+    {
+        SuccessOrExit(error = ReadRecord(aBuffer, aLength, aOffset, record));
+    }
+
+exit:
+    return error;
+}
+
+bool Record::IsSameAs(const Record &aOther) const
+{
+    return mType == aOther.mType && mClass == aOther.mClass && IsNameEqual(mName, aOther.mName) &&
+           mData == aOther.mData;
+}
+
+int Record::Compare(const Record &aOther) const
+{
+    int result;
+
+    VerifyOrExit(mClass == aOther.mClass, result = (mClass < aOther.mClass) ? -1 : 1);
+    VerifyOrExit(mType == aOther.mType, result = (mType < aOther.mType) ? -1 : 1);
+
+    result = memcmp(mData.data(), aOther.mData.data(), std::min(mData.size(), aOther.mData.size()));
+    VerifyOrExit(result == 0);
+
+    result = (mData.size() == aOther.mData.size()) ? 0 : (mData.size() < aOther.mData.size() ? -1 : 1);
+
+exit:
+    return result;
+}
+
+otbrError Message::Parse(const uint8_t *aBuffer, size_t aLength)
+{
+    otbrError error  = OTBR_ERROR_PARSE;
+    size_t    offset = MessageWriter::kHeaderSize;
+    uint16_t  questionCount;
+
+    VerifyOrExit(aLength >= MessageWriter::kHeaderSize);
+
+    mId           = ReadUint16(&aBuffer[0]);
+    mFlags        = ReadUint16(&aBuffer[2]);
+    questionCount = ReadUint16(&aBuffer[4]);
+
+    VerifyOrExit(questionCount <= (aLength - offset) / kMinQuestionSize);
+    mQuestions.resize(questionCount);
+    for (Question &question : mQuestions)
+    {
+        SuccessOrExit(error = ReadQuestion(aBuffer, aLength, offset, question));
+    }
+
+    SuccessOrExit(error = ReadRecords(aBuffer, aLength, offset, ReadUint16(&aBuffer[6]), mAnswers));
+    SuccessOrExit(error = ReadRecords(aBuffer, aLength, offset, ReadUint16(&aBuffer[8]), mAuthorities));
+    SuccessOrExit(error = ReadRecords(aBuffer, aLength, offset, ReadUint16(&aBuffer[10]), mAdditionals));
+
+exit:
+    return error;
+}
+
+MessageWriter::MessageWriter(uint8_t *aBuffer, uint16_t aSize)
+    : mBuffer(aBuffer)
+    , mSize(aSize)
+    , mLength(0)
+    , mSection(kQuestion)
+{
+    assert(aSize >= kHeaderSize);
+    Reset(0, 0);
+}
+
+void MessageWriter::Reset(uint16_t aId, uint16_t aFlags)
+{
+    memset(mBuffer, 0, kHeaderSize);
+    mLength  = 0;
+    mSection = kQuestion;
+    mNames.clear();
+
+    WriteUint16(aId);
+    WriteUint16(aFlags);
+    mLength = kHeaderSize;
+}
+
+void MessageWriter::SetFlags(uint16_t aFlags)
+{
+    mBuffer[2] = static_cast<uint8_t>(aFlags >> 8);
+    mBuffer[3] = static_cast<uint8_t>(aFlags & 0xff);
+}
+
+uint16_t MessageWriter::GetEntryCount(void) const
+{
+    uint16_t count = 0;
+
+    for (uint8_t section = kQuestion; section <= kAdditional; section++)
+    {
+        count += ReadUint16(&mBuffer[4 + section * sizeof(uint16_t)]);
+    }
+
+    return count;
+}
+
+bool MessageWriter::AppendQuestion(const Question &aQuestion)
+{
+    uint16_t length    = mLength;
+    size_t   nameCount = mNames.size();
+    bool     fits;
+
+    assert(mSection == kQuestion);
+
+    fits = WriteName(aQuestion.mName) && WriteUint16(aQuestion.mType) &&
+           WriteUint16(aQuestion.mClass | (aQuestion.mUnicastResponse ? kClassFlag : 0));
+
+    if (fits)
+    {
+        IncreaseCount(kQuestion);
+    }
+    else
+    {
+        mLength = length;
+        mNames.resize(nameCount);
+    }
+
+    return fits;
+}
+
+bool MessageWriter::AppendRecord(Section aSection, const Record &aRecord, uint32_t aTtl)
+{
+    uint16_t length    = mLength;
+    size_t   nameCount = mNames.size();
+    uint16_t dataOffset;
+    bool     fits;
+
+    assert(aSection != kQuestion && aSection >= mSection);
+    mSection = aSection;
+
+    fits = WriteName(aRecord.mName) && WriteUint16(aRecord.mType) &&
+           WriteUint16(aRecord.mClass | (aRecord.mCacheFlush ? kClassFlag : 0)) && WriteUint32(aTtl) &&
+           WriteUint16(0);
+    VerifyOrExit(fits);
+
+    dataOffset = mLength;
+
+    switch (aRecord.mType)
+    {
+    case kTypePtr:
+        fits = WriteNameData(aRecord.mData, 0);
+        break;
+
+    case kTypeSrv:
+        fits = aRecord.mData.size() > kSrvFixedLength && WriteBytes(aRecord.mData.data(), kSrvFixedLength) &&
+               WriteNameData(aRecord.mData, kSrvFixedLength);
+        break;
+
+    default:
+        fits = WriteBytes(aRecord.mData.data(), aRecord.mData.size());
+        break;
+    }
+    VerifyOrExit(fits);
+
+    mBuffer[dataOffset - 2] = static_cast<uint8_t>((mLength - dataOffset) >> 8);
+    mBuffer[dataOffset - 1] = static_cast<uint8_t>((mLength - dataOffset) & 0xff);
+    IncreaseCount(aSection);
+
+exit:
+    if (!fits)
+    {
+        mLength = length;
+        mNames.resize(nameCount);
+    }
+
+    return fits;
+}
+
+bool MessageWriter::WriteName(const std::string &aName)
+{
+    bool   fits = true;
+    size_t offset;
+
+    for (offset = 0; offset < aName.size(); offset += 1 + static_cast<uint8_t>(aName[offset]))
+    {
+        std::string suffix = aName.substr(offset);
+        auto        match  = std::find_if(
+            mNames.begin(), mNames.end(),
+            [&suffix](const std::pair<std::string, uint16_t> &aEntry) { return IsNameEqual(aEntry.first, suffix); });
+
+        if (match != mNames.end())
+        {
+            ExitNow(fits = WriteUint16(0xc000 | match->second));
+        }
+
+        if (mLength <= kMaxPointerOffset)
+        {
+            mNames.emplace_back(std::move(suffix), mLength);
+        }
+
+        VerifyOrExit(fits = WriteBytes(&aName[offset], 1 + static_cast<uint8_t>(aName[offset])));
+    }
+
+    fits = WriteBytes("", 1);
+
+exit:
+    return fits;
+}
+
+bool MessageWriter::WriteNameData(const std::vector<uint8_t> &aData, size_t aOffset)
+{
+    std::string name;
+    bool        fits;
+
+    if (ReadNameData(aData, aOffset, name) == OTBR_ERROR_NONE)
+    {
+        fits = WriteName(name);
+    }
+    else
+    {
+        fits = WriteBytes(aData.data() + aOffset, aData.size() - aOffset);
+    }
+
+    return fits;
+}
+
+bool MessageWriter::WriteUint16(uint16_t aValue)
+{
+    uint8_t bytes[] = {static_cast<uint8_t>(aValue >> 8), static_cast<uint8_t>(aValue & 0xff)};
+
+    return WriteBytes(bytes, sizeof(bytes));
+}
+
+bool MessageWriter::WriteUint32(uint32_t aValue)
+{
+    return WriteUint16(static_cast<uint16_t>(aValue >> 16)) && WriteUint16(static_cast<uint16_t>(aValue & 0xffff));
+}
+
+bool MessageWriter::WriteBytes(const void *aBytes, size_t aLength)
+{
+    bool fits = (aLength <= static_cast<size_t>(mSize - mLength));
+
+    if (fits && aLength > 0)
+    {
+        memcpy(&mBuffer[mLength], aBytes, aLength);
+        mLength += static_cast<uint16_t>(aLength);
+    }
+
+    return fits;
+}
+
+void MessageWriter::IncreaseCount(Section aSection)
+{
+    uint8_t *count = &mBuffer[4 + aSection * sizeof(uint16_t)];
+    uint16_t value = ReadUint16(count) + 1;
+
+    count[0] = static_cast<uint8_t>(value >> 8);
+    count[1] = static_cast<uint8_t>(value & 0xff);
+}
+
+otbrError AppendNameLabel(std::string &aName, const std::string &aLabel)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(!aLabel.empty() && aLabel.size() <= kMaxLabelLength, error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(aName.size() + 1 + aLabel.size() < kMaxNameLength, error = OTBR_ERROR_INVALID_ARGS);
+
+    aName.push_back(static_cast<char>(aLabel.size()));
+    aName.append(aLabel);
+
+exit:
+    return error;
+}
+
+otbrError AppendDottedName(std::string &aName, const char *aDotted)
+{
+    otbrError   error = OTBR_ERROR_NONE;
+    const char *label = aDotted;
+
+    while (*label != '\0')
+    {
+        const char *dot = strchr(label, '.');
+        size_t      length;
+
+        length = (dot == nullptr) ? strlen(label) : static_cast<size_t>(dot - label);
+        SuccessOrExit(error = AppendNameLabel(aName, std::string(label, length)));
+
+        label += length;
+        if (*label == '.')
+        {
+            label++;
+        }
+    }
+
+exit:
+    return error;
+}
+
+std::string NameToString(const std::string &aName)
+{
+    std::string dotted;
+
+    for (size_t offset = 0; offset < aName.size(); offset += 1 + static_cast<uint8_t>(aName[offset]))
+    {
+        dotted.append(aName, offset + 1, static_cast<uint8_t>(aName[offset]));
+        dotted.push_back('.');
+    }
+
+    if (dotted.empty())
+    {
+        dotted = ".";
+    }
+
+    return dotted;
+}
+
+std::string GetFirstNameLabel(const std::string &aName)
+{
+    return aName.empty() ? std::string() : aName.substr(1, static_cast<uint8_t>(aName[0]));
+}
+
+std::string GetParentName(const std::string &aName)
+{
+    return aName.empty() ? std::string() : aName.substr(1 + static_cast<uint8_t>(aName[0]));
+}
+
+bool IsNameEqual(const std::string &aFirst, const std::string &aSecond)
+{
+    bool equal = (aFirst.size() == aSecond.size());
+
+    for (size_t i = 0; equal && i < aFirst.size(); i++)
+    {
+        equal = ToLower(static_cast<uint8_t>(aFirst[i])) == ToLower(static_cast<uint8_t>(aSecond[i]));
+    }
+
+    return equal;
+}
+
+uint32_t HashName(const std::string &aName)
+{
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+
+    for (char c : aName)
+    {
+        hash = (hash ^ ToLower(static_cast<uint8_t>(c))) * 16777619u;
+    }
+
+    return hash;
+}
+
+void AppendNameData(std::vector<uint8_t> &aData, const std::string &aName)
+{
+    aData.insert(aData.end(), aName.begin(), aName.end());
+    aData.push_back(0);
+}
+
+otbrError ReadNameData(const std::vector<uint8_t> &aData, size_t aOffset, std::string &aName)
+{
+    otbrError error  = OTBR_ERROR_PARSE;
+    size_t    offset = aOffset;
+
+    while (offset < aData.size() && aData[offset] != 0)
+    {
+        VerifyOrExit(aData[offset] <= kMaxLabelLength);
+        offset += 1 + aData[offset];
+    }
+
+    VerifyOrExit(offset < aData.size() && offset - aOffset < kMaxNameLength);
+
+    aName.assign(reinterpret_cast<const char *>(&aData[aOffset]), offset - aOffset);
+    error = OTBR_ERROR_NONE;
+
+exit:
+    return error;
+}
+
+} // namespace Mdns
+
+} // namespace otbr
@@ -0,0 +1,403 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for encoding and decoding mDNS packets.
+ */
+
+#ifndef OTBR_AGENT_MDNS_PACKET_HPP_
+#define OTBR_AGENT_MDNS_PACKET_HPP_
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/types.hpp"
+
+namespace otbr {
+
+namespace Mdns {
+
+/**
+ * @addtogroup border-router-mdns
+ *
+ * @{
+ */
+
+/**
+ * DNS record types used by mDNS.
+ *
+ */
+enum RecordType : uint16_t
+{
+    kTypeA    = 1,   ///< IPv4 address.
+    kTypePtr  = 12,  ///< Domain name pointer.
+    kTypeTxt  = 16,  ///< Text strings.
+    kTypeAaaa = 28,  ///< IPv6 address.
+    kTypeSrv  = 33,  ///< Service location.
+    kTypeNsec = 47,  ///< Next secure record.
+    kTypeAny  = 255, ///< Any type, in questions only.
+};
+
+enum : uint16_t
+{
+    kClassIn  = 1,   ///< The Internet class.
+    kClassAny = 255, ///< Any class, in questions only.
+};
+
+/**
+ * This structure represents a question.
+ *
+ * Names are kept in uncompressed wire format without the root label, i.e. a sequence of length-prefixed labels, so
+ * that labels may contain dots and names are compared without parsing. Use the `*Name*` functions to build them.
+ *
+ */
+struct Question
+{
+    std::string mName;            ///< The name.
+    uint16_t    mType;            ///< The record type.
+    uint16_t    mClass;           ///< The class, without the unicast-response bit.
+    bool        mUnicastResponse; ///< Whether a unicast response is requested (the QU bit).
+};
+
+/**
+ * This structure represents a resource record.
+ *
+ * Domain names within the data of PTR and SRV records are kept uncompressed, including the root label.
+ *
+ */
+struct Record
+{
+    std::string          mName;       ///< The name.
+    uint16_t             mType;       ///< The record type.
+    uint16_t             mClass;      ///< The class, without the cache-flush bit.
+    bool                 mCacheFlush; ///< Whether the cache-flush bit is set, i.e. the record set is unique.
+    uint32_t             mTtl;        ///< The TTL in seconds.
+    std::vector<uint8_t> mData;       ///< The record data.
+
+    /**
+     * This method indicates whether two records have the same name, type, class and data.
+     *
+     * @param[in] aOther  The other record.
+     *
+     * @returns Whether the records are the same regardless of TTL and cache-flush bit.
+     *
+     */
+    bool IsSameAs(const Record &aOther) const;
+
+    /**
+     * This method compares two records in the lexicographical order used to break ties of simultaneous probes.
+     *
+     * See RFC 6762, section 8.2.
+     *
+     * @param[in] aOther  The other record.
+     *
+     * @returns A negative value, zero or a positive value if this record is less than, equal to or greater than
+     *          @p aOther.
+     *
+     */
+    int Compare(const Record &aOther) const;
+};
+
+/**
+ * This class represents a parsed mDNS message.
+ *
+ */
+class Message
+{
+public:
+    enum : uint16_t
+    {
+        kFlagResponse      = 0x8000, ///< The QR bit.
+        kFlagAuthoritative = 0x0400, ///< The AA bit.
+        kFlagTruncated     = 0x0200, ///< The TC bit.
+        kOpcodeMask        = 0x7800, ///< The OPCODE field.
+        kRcodeMask         = 0x000f, ///< The RCODE field.
+    };
+
+    uint16_t              mId;          ///< The message ID.
+    uint16_t              mFlags;       ///< The flags.
+    std::vector<Question> mQuestions;   ///< The questions.
+    std::vector<Record>   mAnswers;     ///< The answer records.
+    std::vector<Record>   mAuthorities; ///< The authority records.
+    std::vector<Record>   mAdditionals; ///< The additional records.
+
+    /**
+     * This method indicates whether the message is a response.
+     *
+     * @returns Whether the QR bit is set.
+     *
+     */
+    bool IsResponse(void) const { return (mFlags & kFlagResponse) != 0; }
+
+    /**
+     * This method indicates whether more known answers follow in other messages.
+     *
+     * @returns Whether the TC bit is set.
+     *
+     */
+    bool IsTruncated(void) const { return (mFlags & kFlagTruncated) != 0; }
+
+    /**
+     * This method parses a message.
+     *
+     * Records of unknown types are kept with their data as is.
+     *
+     * @param[in]  aBuffer  A pointer to the message.
+     * @param[in]  aLength  The length of the message.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully parsed the message.
+     * @retval OTBR_ERROR_PARSE  The message is malformed.
+     *
+     */
+    otbrError Parse(const uint8_t *aBuffer, size_t aLength);
+};
+
+/**
+ * This class writes an mDNS message with name compression into a fixed size buffer.
+ *
+ * Sections must be written in order: questions, answers, authorities and additionals.
+ *
+ */
+class MessageWriter
+{
+public:
+    enum Section : uint8_t
+    {
+        kQuestion   = 0, ///< The question section.
+        kAnswer     = 1, ///< The answer section.
+        kAuthority  = 2, ///< The authority section.
+        kAdditional = 3, ///< The additional section.
+    };
+
+    enum : uint16_t
+    {
+        kHeaderSize = 12, ///< The size of the message header.
+    };
+
+    /**
+     * This constructor initializes the writer.
+     *
+     * @param[in]  aBuffer  A pointer to the buffer.
+     * @param[in]  aSize    The size of the buffer, i.e. the maximum size of the message.
+     *
+     */
+    MessageWriter(uint8_t *aBuffer, uint16_t aSize);
+
+    /**
+     * This method starts a new message.
+     *
+     * @param[in]  aId     The message ID.
+     * @param[in]  aFlags  The flags.
+     *
+     */
+    void Reset(uint16_t aId, uint16_t aFlags);
+
+    /**
+     * This method appends a question.
+     *
+     * @param[in]  aQuestion  The question.
+     *
+     * @returns Whether the question fits in the message. The message is unchanged if not.
+     *
+     */
+    bool AppendQuestion(const Question &aQuestion);
+
+    /**
+     * This method appends a record.
+     *
+     * @param[in]  aSection  The section, which mustn't be before the section of the last record.
+     * @param[in]  aRecord   The record.
+     * @param[in]  aTtl      The TTL to write instead of the one of @p aRecord.
+     *
+     * @returns Whether the record fits in the message. The message is unchanged if not.
+     *
+     */
+    bool AppendRecord(Section aSection, const Record &aRecord, uint32_t aTtl);
+
+    /**
+     * This method sets the flags of the message.
+     *
+     * @param[in]  aFlags  The flags.
+     *
+     */
+    void SetFlags(uint16_t aFlags);
+
+    /**
+     * This method returns the number of questions and records in the message.
+     *
+     * @returns The number of entries.
+     *
+     */
+    uint16_t GetEntryCount(void) const;
+
+    /**
+     * This method returns the message.
+     *
+     * @returns A pointer to the message.
+     *
+     */
+    const uint8_t *GetBuffer(void) const { return mBuffer; }
+
+    /**
+     * This method returns the length of the message.
+     *
+     * @returns The length of the message.
+     *
+     */
+    uint16_t GetLength(void) const { return mLength; }
+
+private:
+    bool WriteName(const std::string &aName);
+    bool WriteNameData(const std::vector<uint8_t> &aData, size_t aOffset);
+    bool WriteUint16(uint16_t aValue);
+    bool WriteUint32(uint32_t aValue);
+    bool WriteBytes(const void *aBytes, size_t aLength);
+    void IncreaseCount(Section aSection);
+
+    uint8_t *mBuffer;
+    uint16_t mSize;
+    uint16_t mLength;
+    Section  mSection;
+
+    // The names written so far with their offsets, for compression.
+    std::vector<std::pair<std::string, uint16_t>> mNames;
+};
+
+/**
+ * This function appends a label to a name.
+ *
+ * @param[inout]  aName   The name in wire format.
+ * @param[in]     aLabel  The label, which may contain dots.
+ *
+ * @retval OTBR_ERROR_NONE          Successfully appended the label.
+ * @retval OTBR_ERROR_INVALID_ARGS  The label is empty or too long.
+ *
+ */
+otbrError AppendNameLabel(std::string &aName, const std::string &aLabel);
+
+/**
+ * This function appends the labels of a dotted name to a name.
+ *
+ * @param[inout]  aName    The name in wire format.
+ * @param[in]     aDotted  The dotted name, e.g. "_meshcop._udp.local.", the trailing dot is optional.
+ *
+ * @retval OTBR_ERROR_NONE          Successfully appended the labels.
+ * @retval OTBR_ERROR_INVALID_ARGS  There is an empty or too long label.
+ *
+ */
+otbrError AppendDottedName(std::string &aName, const char *aDotted);
+
+/**
+ * This function converts a name to the dotted form with a trailing dot.
+ *
+ * Dots within labels are not escaped.
+ *
+ * @param[in]  aName  The name in wire format.
+ *
+ * @returns The dotted name.
+ *
+ */
+std::string NameToString(const std::string &aName);
+
+/**
+ * This function returns the first label of a name.
+ *
+ * @param[in]  aName  The name in wire format.
+ *
+ * @returns The first label, or an empty string for the root name.
+ *
+ */
+std::string GetFirstNameLabel(const std::string &aName);
+
+/**
+ * This function removes the first label of a name.
+ *
+ * @param[in]  aName  The name in wire format.
+ *
+ * @returns The name without its first label.
+ *
+ */
+std::string GetParentName(const std::string &aName);
+
+/**
+ * This function compares two names ignoring ASCII case.
+ *
+ * @param[in]  aFirst   The first name in wire format.
+ * @param[in]  aSecond  The second name in wire format.
+ *
+ * @returns Whether the names are equal.
+ *
+ */
+bool IsNameEqual(const std::string &aFirst, const std::string &aSecond);
+
+/**
+ * This function hashes a name ignoring ASCII case.
+ *
+ * @param[in]  aName  The name in wire format.
+ *
+ * @returns The hash, which is equal for names equal per `IsNameEqual()`.
+ *
+ */
+uint32_t HashName(const std::string &aName);
+
+/**
+ * This function appends a name with the root label to record data.
+ *
+ * @param[inout]  aData  The record data.
+ * @param[in]     aName  The name in wire format.
+ *
+ */
+void AppendNameData(std::vector<uint8_t> &aData, const std::string &aName);
+
+/**
+ * This function reads a name with the root label from record data, e.g. the target of a PTR or SRV record.
+ *
+ * @param[in]   aData    The record data.
+ * @param[in]   aOffset  The offset of the name in @p aData.
+ * @param[out]  aName    The name in wire format.
+ *
+ * @retval OTBR_ERROR_NONE   Successfully read the name.
+ * @retval OTBR_ERROR_PARSE  There is no valid name at @p aOffset.
+ *
+ */
+otbrError ReadNameData(const std::vector<uint8_t> &aData, size_t aOffset, std::string &aName);
+
+/**
+ * @}
+ */
+
+} // namespace Mdns
+
+} // namespace otbr
+
+#endif // OTBR_AGENT_MDNS_PACKET_HPP_
@@ -0,0 +1,215 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a stub MDNS publisher.
+ */
+
+#define OTBR_LOG_TAG "MDNS"
+
+#include "mdns/mdns_stub.hpp"
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+
+namespace Mdns {
+
+PublisherStub::PublisherStub(StateHandler aHandler, void *aContext)
+    : mStateHandler(aHandler)
+    , mContext(aContext)
+    , mIsStarted(false)
+    , mStateChanged(false)
+{
+}
+
+otbrError PublisherStub::Start(void)
+{
+    mIsStarted    = true;
+    mStateChanged = true;
+
+    return OTBR_ERROR_NONE;
+}
+
+bool PublisherStub::IsStarted(void) const
+{
+    return mIsStarted;
+}
+
+void PublisherStub::Stop(void)
+{
+    VerifyOrExit(mIsStarted);
+
+    mIsStarted = false;
+    mHosts.clear();
+    mServices.clear();
+    mPendingHosts.clear();
+    mPendingServices.clear();
+
+exit:
+    return;
+}
+
+otbrError PublisherStub::PublishService(const char *   aHostName,
+                                        uint16_t       aPort,
+                                        const char *   aName,
+                                        const char *   aType,
+                                        const TxtList &aTxtList)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    uint8_t   txt[kMaxSizeOfTxtRecord];
+    uint16_t  txtLength = sizeof(txt);
+
+    OTBR_UNUSED_VARIABLE(aHostName);
+
+    VerifyOrExit(mIsStarted, error = OTBR_ERROR_MDNS);
+    SuccessOrExit(error = EncodeTxtData(aTxtList, txt, txtLength));
+
+    mServices[ServiceKey(aName, aType)] = aPort;
+    mPendingServices.emplace_back(aName, aType);
+    otbrLogDebug("Publish service %s.%s, %zu services registered", aName, aType, mServices.size());
+
+exit:
+    return error;
+}
+
+otbrError PublisherStub::UnpublishService(const char *aName, const char *aType)
+{
+    mServices.erase(ServiceKey(aName, aType));
+
+    return OTBR_ERROR_NONE;
+}
+
+otbrError PublisherStub::PublishHost(const char *aName, const uint8_t *aAddress, uint8_t aAddressLength)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mIsStarted, error = OTBR_ERROR_MDNS);
+
+    mHosts[aName].assign(aAddress, aAddress + aAddressLength);
+    mPendingHosts.emplace_back(aName);
+    otbrLogDebug("Publish host %s, %zu hosts registered", aName, mHosts.size());
+
+exit:
+    return error;
+}
+
+otbrError PublisherStub::UnpublishHost(const char *aName)
+{
+    mHosts.erase(aName);
+
+    return OTBR_ERROR_NONE;
+}
+
+void PublisherStub::SubscribeService(const std::string &aType, const std::string &aInstanceName)
+{
+    OTBR_UNUSED_VARIABLE(aType);
+    OTBR_UNUSED_VARIABLE(aInstanceName);
+}
+
+void PublisherStub::UnsubscribeService(const std::string &aType, const std::string &aInstanceName)
+{
+    OTBR_UNUSED_VARIABLE(aType);
+    OTBR_UNUSED_VARIABLE(aInstanceName);
+}
+
+void PublisherStub::SubscribeHost(const std::string &aHostName)
+{
+    OTBR_UNUSED_VARIABLE(aHostName);
+}
+
+void PublisherStub::UnsubscribeHost(const std::string &aHostName)
+{
+    OTBR_UNUSED_VARIABLE(aHostName);
+}
+
+void PublisherStub::Update(MainloopContext &aMainloop)
+{
+    if (mStateChanged || !mPendingHosts.empty() || !mPendingServices.empty())
+    {
+        aMainloop.mTimeout = {0, 0};
+    }
+}
+
+void PublisherStub::Process(const MainloopContext &aMainloop)
+{
+    std::vector<std::string> hosts;
+    std::vector<ServiceKey>  services;
+
+    OTBR_UNUSED_VARIABLE(aMainloop);
+
+    if (mStateChanged)
+    {
+        mStateChanged = false;
+        mStateHandler(mContext, mIsStarted ? State::kReady : State::kIdle);
+    }
+
+    // The handlers may publish again, so they are called on a copy of the pending results.
+    hosts.swap(mPendingHosts);
+    services.swap(mPendingServices);
+
+    for (const std::string &host : hosts)
+    {
+        if (mHostHandler != nullptr)
+        {
+            mHostHandler(host.c_str(), OTBR_ERROR_NONE, mHostHandlerContext);
+        }
+    }
+
+    for (const ServiceKey &service : services)
+    {
+        if (mServiceHandler != nullptr)
+        {
+            mServiceHandler(service.first.c_str(), service.second.c_str(), OTBR_ERROR_NONE, mServiceHandlerContext);
+        }
+    }
+}
+
+Publisher *Publisher::Create(int          aFamily,
+                             const char * aDomain,
+                             StateHandler aHandler,
+                             void *       aContext,
+                             uint32_t     aInterfaceIndex)
+{
+    OTBR_UNUSED_VARIABLE(aFamily);
+    OTBR_UNUSED_VARIABLE(aDomain);
+    OTBR_UNUSED_VARIABLE(aInterfaceIndex);
+
+    return new PublisherStub(aHandler, aContext);
+}
+
+void Publisher::Destroy(Publisher *aPublisher)
+{
+    delete static_cast<PublisherStub *>(aPublisher);
+}
+
+} // namespace Mdns
+
+} // namespace otbr
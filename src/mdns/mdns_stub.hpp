@@ -0,0 +1,111 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for a stub MDNS publisher, which accepts every registration without sending any
+ *   packet. It lets the agent run without an mDNS daemon, e.g. in performance tests.
+ */
+
+#ifndef OTBR_AGENT_MDNS_STUB_HPP_
+#define OTBR_AGENT_MDNS_STUB_HPP_
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/types.hpp"
+#include "mdns/mdns.hpp"
+
+namespace otbr {
+
+namespace Mdns {
+
+/**
+ * This class implements a stub MDNS publisher.
+ *
+ * Registrations are kept in memory and reported successful from the next mainloop iteration, as a real daemon
+ * reports them asynchronously. Subscriptions never discover anything.
+ *
+ */
+class PublisherStub : public Publisher
+{
+public:
+    /**
+     * The constructor to initialize a Publisher.
+     *
+     * @param[in]   aHandler            The function to be called when state changes.
+     * @param[in]   aContext            A pointer to application-specific context.
+     *
+     */
+    PublisherStub(StateHandler aHandler, void *aContext);
+
+    otbrError PublishService(const char *   aHostName,
+                             uint16_t       aPort,
+                             const char *   aName,
+                             const char *   aType,
+                             const TxtList &aTxtList) override;
+    otbrError UnpublishService(const char *aName, const char *aType) override;
+    otbrError PublishHost(const char *aName, const uint8_t *aAddress, uint8_t aAddressLength) override;
+    otbrError UnpublishHost(const char *aName) override;
+    void      SubscribeService(const std::string &aType, const std::string &aInstanceName) override;
+    void      UnsubscribeService(const std::string &aType, const std::string &aInstanceName) override;
+    void      SubscribeHost(const std::string &aHostName) override;
+    void      UnsubscribeHost(const std::string &aHostName) override;
+    otbrError Start(void) override;
+    bool      IsStarted(void) const override;
+    void      Stop(void) override;
+    void      Update(MainloopContext &aMainloop) override;
+    void      Process(const MainloopContext &aMainloop) override;
+
+private:
+    enum : uint16_t
+    {
+        kMaxSizeOfTxtRecord = 1024,
+    };
+
+    typedef std::pair<std::string, std::string> ServiceKey; // The service instance name and type.
+
+    StateHandler mStateHandler;
+    void *       mContext;
+    bool         mIsStarted;
+    bool         mStateChanged;
+
+    std::map<std::string, std::vector<uint8_t>> mHosts;
+    std::map<ServiceKey, uint16_t>              mServices;
+
+    std::vector<std::string> mPendingHosts;
+    std::vector<ServiceKey>  mPendingServices;
+};
+
+} // namespace Mdns
+
+} // namespace otbr
+
+#endif // OTBR_AGENT_MDNS_STUB_HPP_
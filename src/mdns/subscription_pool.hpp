@@ -0,0 +1,209 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the pool of mDNS subscriptions.
+ */
+
+#ifndef OTBR_AGENT_MDNS_SUBSCRIPTION_POOL_HPP_
+#define OTBR_AGENT_MDNS_SUBSCRIPTION_POOL_HPP_
+
+#include <assert.h>
+#include <stdint.h>
+
+#include <map>
+#include <memory>
+#include <utility>
+
+namespace otbr {
+
+namespace Mdns {
+
+/**
+ * @addtogroup border-router-mdns
+ *
+ * @{
+ */
+
+/**
+ * This class template implements a pool of reference-counted subscriptions.
+ *
+ * Subscriptions are allocated one by one so that their addresses stay stable while the pool grows and shrinks, as
+ * the mDNS libraries keep them as callback contexts. Acquiring a key that's already subscribed shares the existing
+ * subscription.
+ *
+ * @tparam KeyType           The type of the key identifying a subscription.
+ * @tparam SubscriptionType  The type of the subscription.
+ *
+ */
+template <typename KeyType, typename SubscriptionType> class SubscriptionPool
+{
+    struct Entry
+    {
+        std::unique_ptr<SubscriptionType> mSubscription;
+        uint32_t                          mRefCount;
+    };
+
+    typedef std::map<KeyType, Entry> EntryMap;
+
+public:
+    /**
+     * This type represents a handle of a subscription in the pool.
+     *
+     * A handle stays valid until the last reference of the subscription is released.
+     *
+     */
+    typedef typename EntryMap::iterator Handle;
+
+    /**
+     * This method acquires a reference of the subscription of a key.
+     *
+     * @param[in]   aKey        The key of the subscription.
+     * @param[in]   aCreate     A function returning a new `SubscriptionType *`, called if @p aKey isn't subscribed.
+     * @param[out]  aIsNew      Whether the subscription has been created by this call.
+     *
+     * @returns The handle of the subscription.
+     *
+     */
+    template <typename CreateFunc> Handle Acquire(const KeyType &aKey, CreateFunc aCreate, bool &aIsNew)
+    {
+        Handle handle = mEntries.find(aKey);
+
+        aIsNew = (handle == mEntries.end());
+        if (aIsNew)
+        {
+            handle                       = mEntries.emplace(aKey, Entry()).first;
+            handle->second.mSubscription = std::unique_ptr<SubscriptionType>(aCreate());
+            handle->second.mRefCount     = 0;
+        }
+        handle->second.mRefCount++;
+
+        return handle;
+    }
+
+    /**
+     * This method releases a reference of a subscription.
+     *
+     * @param[in]  aHandle  The handle of the subscription.
+     *
+     * @returns The subscription if this was its last reference, or null otherwise. @p aHandle is invalid then.
+     *
+     */
+    std::unique_ptr<SubscriptionType> Release(Handle aHandle)
+    {
+        std::unique_ptr<SubscriptionType> subscription;
+
+        assert(aHandle != mEntries.end() && aHandle->second.mRefCount > 0);
+
+        if (--aHandle->second.mRefCount == 0)
+        {
+            subscription = std::move(aHandle->second.mSubscription);
+            mEntries.erase(aHandle);
+        }
+
+        return subscription;
+    }
+
+    /**
+     * This method finds the subscription of a key.
+     *
+     * @param[in]  aKey  The key of the subscription.
+     *
+     * @returns The handle of the subscription, or an invalid handle if @p aKey isn't subscribed.
+     *
+     */
+    Handle Find(const KeyType &aKey) { return mEntries.find(aKey); }
+
+    /**
+     * This method indicates whether a handle refers to a subscription.
+     *
+     * @param[in]  aHandle  The handle.
+     *
+     * @returns Whether @p aHandle refers to a subscription.
+     *
+     */
+    bool IsValid(Handle aHandle) const { return aHandle != mEntries.end(); }
+
+    /**
+     * This method returns the subscription referred by a handle.
+     *
+     * @param[in]  aHandle  A valid handle of a subscription.
+     *
+     * @returns A reference to the subscription.
+     *
+     */
+    static SubscriptionType &Get(Handle aHandle) { return *aHandle->second.mSubscription; }
+
+    /**
+     * This method returns the number of references of a subscription.
+     *
+     * @param[in]  aHandle  The handle of the subscription.
+     *
+     * @returns The number of references.
+     *
+     */
+    static uint32_t GetRefCount(Handle aHandle) { return aHandle->second.mRefCount; }
+
+    /**
+     * This method returns the number of subscriptions in the pool.
+     *
+     * @returns The number of subscriptions.
+     *
+     */
+    size_t GetSize(void) const { return mEntries.size(); }
+
+    /**
+     * This method calls a function for every subscription in the pool.
+     *
+     * The function must not acquire or release subscriptions.
+     *
+     * @param[in]  aFunc  The function taking a `SubscriptionType &`.
+     *
+     */
+    template <typename Func> void ForEach(Func aFunc)
+    {
+        for (auto &entry : mEntries)
+        {
+            aFunc(*entry.second.mSubscription);
+        }
+    }
+
+private:
+    EntryMap mEntries;
+};
+
+/**
+ * @}
+ */
+
+} // namespace Mdns
+
+} // namespace otbr
+
+#endif // OTBR_AGENT_MDNS_SUBSCRIPTION_POOL_HPP_
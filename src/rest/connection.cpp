@@ -35,6 +35,8 @@
 #include <sys/socket.h>
 #include <sys/time.h>
 
+#include "common/metrics.hpp"
+
 using std::chrono::duration_cast;
 using std::chrono::microseconds;
 using std::chrono::seconds;
@@ -55,8 +57,13 @@ static const uint32_t kWriteTimeout = 10000000;
 // The timeout (in microseconds) since a connection is in wait read state
 static const uint32_t kReadTimeout = 1000000;
 
+static Metrics::Counter   sRequests("otbr_rest_requests_total", "Number of REST requests responded.");
+static Metrics::Histogram sRequestDuration("otbr_rest_request_duration_seconds",
+                                           "Time from accepting a REST connection to responding.");
+
 Connection::Connection(steady_clock::time_point aStartTime, Resource *aResource, int aFd)
     : mTimeStamp(aStartTime)
+    , mStartTime(aStartTime)
     , mFd(aFd)
     , mState(ConnectionState::kInit)
     , mParser(&mRequest)
@@ -312,6 +319,9 @@ void Connection::Write(void)
         mState        = ConnectionState::kWriteWait;
         mTimeStamp    = steady_clock::now();
         mWriteContent = mResponse.Serialize();
+
+        sRequests.Increment();
+        sRequestDuration.Observe(duration_cast<microseconds>(mTimeStamp - mStartTime));
     }
 
     // Check we do have something to write.
@@ -116,6 +116,9 @@ private:
     // Timestamp used for each check point of a connection
     steady_clock::time_point mTimeStamp;
 
+    // Timestamp when this connection was accepted
+    steady_clock::time_point mStartTime;
+
     // File descriptor for this connection
     int mFd;
 
@@ -111,7 +111,7 @@ static cJSON *IpAddr2Json(const otIp6Address &aAddress)
 {
     Ip6Address addr(aAddress.mFields.m8);
 
-    return cJSON_CreateString(addr.ToString().c_str());
+    return cJSON_CreateString(Ip6AddressString(addr).AsCString());
 }
 
 static cJSON *ChildTableEntry2Json(const otNetworkDiagChildEntry &aChildEntry)
@@ -191,6 +191,29 @@ static cJSON *Route2Json(const otNetworkDiagRoute &aRoute)
     return route;
 }
 
+static cJSON *RouteTableEntry2Json(const Route &aRoute)
+{
+    cJSON *route = cJSON_CreateObject();
+
+    cJSON_AddItemToObject(route, "Prefix", cJSON_CreateString(aRoute.mPrefix.ToString().c_str()));
+    cJSON_AddItemToObject(route, "Rloc16", cJSON_CreateNumber(aRoute.mRloc16));
+    cJSON_AddItemToObject(route, "Preference", cJSON_CreateNumber(aRoute.mPreference));
+    cJSON_AddItemToObject(route, "OnMesh", cJSON_CreateBool(aRoute.mOnMesh));
+    cJSON_AddItemToObject(route, "Stable", cJSON_CreateBool(aRoute.mStable));
+    cJSON_AddItemToObject(route, "Local", cJSON_CreateBool(aRoute.mLocal));
+
+    if (aRoute.mOnMesh)
+    {
+        cJSON_AddItemToObject(route, "Preferred", cJSON_CreateBool(aRoute.mPreferred));
+        cJSON_AddItemToObject(route, "Slaac", cJSON_CreateBool(aRoute.mSlaac));
+        cJSON_AddItemToObject(route, "Dhcp", cJSON_CreateBool(aRoute.mDhcp));
+        cJSON_AddItemToObject(route, "Configure", cJSON_CreateBool(aRoute.mConfigure));
+        cJSON_AddItemToObject(route, "DefaultRoute", cJSON_CreateBool(aRoute.mDefaultRoute));
+    }
+
+    return route;
+}
+
 static cJSON *LeaderData2Json(const otLeaderData &aLeaderData)
 {
     cJSON *leaderData = cJSON_CreateObject();
@@ -477,6 +500,57 @@ std::string Error2JsonString(HttpStatusCode aErrorCode, std::string aErrorMessag
     return ret;
 }
 
+std::string RouteTableEntry2JsonString(const Route &aRoute)
+{
+    cJSON *     route = RouteTableEntry2Json(aRoute);
+    std::string ret   = Json2String(route);
+
+    cJSON_Delete(route);
+
+    return ret;
+}
+
+std::string RouteTable2JsonString(const std::vector<Route> &aRoutes)
+{
+    std::string ret;
+    cJSON *     routes = cJSON_CreateArray();
+
+    for (const Route &route : aRoutes)
+    {
+        cJSON_AddItemToArray(routes, RouteTableEntry2Json(route));
+    }
+
+    ret = Json2String(routes);
+
+    cJSON_Delete(routes);
+
+    return ret;
+}
+
+std::string MainloopProfile2JsonString(const std::vector<MainloopProfiler::HandlerStats> &aStats)
+{
+    std::string ret;
+    cJSON *     profile = cJSON_CreateArray();
+
+    for (const MainloopProfiler::HandlerStats &stats : aStats)
+    {
+        cJSON *handler = cJSON_CreateObject();
+
+        cJSON_AddItemToObject(handler, "Name", cJSON_CreateString(stats.mName));
+        cJSON_AddItemToObject(handler, "Count", cJSON_CreateNumber(stats.mCount));
+        cJSON_AddItemToObject(handler, "SlowCount", cJSON_CreateNumber(stats.mSlowCount));
+        cJSON_AddItemToObject(handler, "TotalUs", cJSON_CreateNumber(stats.mTotal.count()));
+        cJSON_AddItemToObject(handler, "MaxUs", cJSON_CreateNumber(stats.mMax.count()));
+        cJSON_AddItemToArray(profile, handler);
+    }
+
+    ret = Json2String(profile);
+
+    cJSON_Delete(profile);
+
+    return ret;
+}
+
 } // namespace Json
 } // namespace rest
 } // namespace otbr
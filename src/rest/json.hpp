@@ -37,6 +37,8 @@
 #include "openthread/link.h"
 #include "openthread/thread_ftd.h"
 
+#include "common/mainloop_profiler.hpp"
+#include "common/route_table.hpp"
 #include "rest/types.hpp"
 #include "utils/hex.hpp"
 
@@ -201,6 +203,36 @@ std::string ChildTableEntry2JsonString(const otNetworkDiagChildEntry &aChildEntr
  */
 std::string Error2JsonString(HttpStatusCode aErrorCode, std::string aErrorMessage);
 
+/**
+ * This method formats a route table entry to a Json object and serialize it to a string.
+ *
+ * @param[in]   aRoute  A route table entry.
+ *
+ * @returns     A string serlialized by a Json object.
+ *
+ */
+std::string RouteTableEntry2JsonString(const Route &aRoute);
+
+/**
+ * This method formats route table entries to a Json array and serialize it to a string.
+ *
+ * @param[in]   aRoutes  A vector of route table entries.
+ *
+ * @returns     A string serlialized by a Json array.
+ *
+ */
+std::string RouteTable2JsonString(const std::vector<Route> &aRoutes);
+
+/**
+ * This method formats the statistics of mainloop handlers to a Json array and serialize it to a string.
+ *
+ * @param[in]   aStats  A vector of handler statistics.
+ *
+ * @returns     A string serlialized by a Json array.
+ *
+ */
+std::string MainloopProfile2JsonString(const std::vector<MainloopProfiler::HandlerStats> &aStats);
+
 }; // namespace Json
 
 } // namespace rest
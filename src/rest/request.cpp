@@ -87,6 +87,29 @@ exit:
     return url;
 }
 
+bool Request::GetQueryParameter(const std::string &aName, std::string &aValue) const
+{
+    bool   found = false;
+    size_t begin = mUrl.find('?');
+
+    while (begin != std::string::npos)
+    {
+        size_t end = mUrl.find('&', ++begin);
+        size_t sep = mUrl.find('=', begin);
+
+        if (mUrl.compare(begin, sep - begin, aName) == 0 && sep < end)
+        {
+            aValue = mUrl.substr(sep + 1, end == std::string::npos ? std::string::npos : end - sep - 1);
+            ExitNow(found = true);
+        }
+
+        begin = end;
+    }
+
+exit:
+    return found;
+}
+
 void Request::SetReadComplete(void)
 {
     mComplete = true;
@@ -123,6 +123,16 @@ public:
      */
     std::string GetUrl(void) const;
 
+    /**
+     * This method returns the value of a query parameter of the url.
+     *
+     * @param[in]   aName   The name of the query parameter.
+     * @param[out]  aValue  A reference to the string to receive the value.
+     *
+     * @returns Whether the query parameter is present.
+     */
+    bool GetQueryParameter(const std::string &aName, std::string &aValue) const;
+
     /**
      * This method indicates whether this request is parsed completely.
      *
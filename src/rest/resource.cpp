@@ -32,6 +32,10 @@
 
 #include "string.h"
 
+#include "common/metrics.hpp"
+
+#define OT_REST_RESPONSE_CONTENT_TYPE_PROMETHEUS "text/plain; version=0.0.4"
+
 #define OT_PSKC_MAX_LENGTH 16
 #define OT_EXTENDED_PANID_LENGTH 8
 
@@ -45,12 +49,16 @@
 #define OT_REST_RESOURCE_PATH_NODE_LEADERDATA "/node/leader-data"
 #define OT_REST_RESOURCE_PATH_NODE_NUMOFROUTER "/node/num-of-router"
 #define OT_REST_RESOURCE_PATH_NODE_EXTPANID "/node/ext-panid"
+#define OT_REST_RESOURCE_PATH_NODE_ROUTES "/node/routes"
+#define OT_REST_RESOURCE_PATH_METRICS "/metrics"
+#define OT_REST_RESOURCE_PATH_MAINLOOP_PROFILE "/mainloop/profile"
 #define OT_REST_RESOURCE_PATH_NETWORK "/networks"
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT "/networks/current"
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT_COMMISSION "/networks/commission"
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT_PREFIX "/networks/current/prefix"
 
 #define OT_REST_HTTP_STATUS_200 "200 OK"
+#define OT_REST_HTTP_STATUS_400 "400 Bad Request"
 #define OT_REST_HTTP_STATUS_404 "404 Not Found"
 #define OT_REST_HTTP_STATUS_405 "405 Method Not Allowed"
 #define OT_REST_HTTP_STATUS_408 "408 Request Timeout"
@@ -87,6 +95,9 @@ static std::string GetHttpStatus(HttpStatusCode aErrorCode)
     case HttpStatusCode::kStatusOk:
         httpStatus = OT_REST_HTTP_STATUS_200;
         break;
+    case HttpStatusCode::kStatusBadRequest:
+        httpStatus = OT_REST_HTTP_STATUS_400;
+        break;
     case HttpStatusCode::kStatusResourceNotFound:
         httpStatus = OT_REST_HTTP_STATUS_404;
         break;
@@ -120,6 +131,9 @@ Resource::Resource(ControllerOpenThread *aNcp)
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_NUMOFROUTER, &Resource::NumOfRoute);
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_EXTPANID, &Resource::ExtendedPanId);
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_RLOC, &Resource::Rloc);
+    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_ROUTES, &Resource::Routes);
+    mResourceMap.emplace(OT_REST_RESOURCE_PATH_METRICS, &Resource::Metrics);
+    mResourceMap.emplace(OT_REST_RESOURCE_PATH_MAINLOOP_PROFILE, &Resource::MainloopProfile);
 
     // Resource callback handler
     mResourceCallbackMap.emplace(OT_REST_RESOURCE_PATH_DIAGNOETIC, &Resource::HandleDiagnosticCallback);
@@ -489,6 +503,95 @@ void Resource::Rloc(const Request &aRequest, Response &aResponse) const
     }
 }
 
+void Resource::GetDataMetrics(Response &aResponse) const
+{
+    std::string body = otbr::Metrics::Registry::Get().Serialize();
+    std::string errorCode;
+
+    aResponse.SetContentType(OT_REST_RESPONSE_CONTENT_TYPE_PROMETHEUS);
+    aResponse.SetBody(body);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+}
+
+void Resource::Metrics(const Request &aRequest, Response &aResponse) const
+{
+    if (aRequest.GetMethod() == HttpMethod::kGet)
+    {
+        GetDataMetrics(aResponse);
+    }
+    else
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
+    }
+}
+
+void Resource::GetDataMainloopProfile(Response &aResponse) const
+{
+    std::string body = Json::MainloopProfile2JsonString(MainloopProfiler::Get().GetStats());
+    std::string errorCode;
+
+    aResponse.SetBody(body);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+}
+
+void Resource::MainloopProfile(const Request &aRequest, Response &aResponse) const
+{
+    if (aRequest.GetMethod() == HttpMethod::kGet)
+    {
+        GetDataMainloopProfile(aResponse);
+    }
+    else
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
+    }
+}
+
+void Resource::GetDataRoutes(const Request &aRequest, Response &aResponse) const
+{
+    const RouteTable &routeTable = mNcp->GetRouteManager().GetRouteTable();
+    std::string       address;
+    std::string       body;
+    std::string       errorCode;
+
+    // With an address, only the longest matching route is returned.
+    if (aRequest.GetQueryParameter("address", address))
+    {
+        Ip6Address   ip6Address;
+        const Route *route;
+
+        VerifyOrExit(Ip6Address::FromString(address.c_str(), ip6Address) == OTBR_ERROR_NONE,
+                     ErrorHandler(aResponse, HttpStatusCode::kStatusBadRequest));
+        route = routeTable.Lookup(ip6Address);
+        VerifyOrExit(route != nullptr, ErrorHandler(aResponse, HttpStatusCode::kStatusResourceNotFound));
+        body = Json::RouteTableEntry2JsonString(*route);
+    }
+    else
+    {
+        body = Json::RouteTable2JsonString(routeTable.GetRoutes());
+    }
+
+    aResponse.SetBody(body);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+
+exit:
+    return;
+}
+
+void Resource::Routes(const Request &aRequest, Response &aResponse) const
+{
+    if (aRequest.GetMethod() == HttpMethod::kGet)
+    {
+        GetDataRoutes(aRequest, aResponse);
+    }
+    else
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
+    }
+}
+
 void Resource::DeleteOutDatedDiagnostic(void)
 {
     auto eraseIt = mDiagSet.begin();
@@ -86,6 +86,12 @@ void Response::SetResponsCode(std::string &aCode)
     mCode = aCode;
 }
 
+void Response::SetContentType(const std::string &aContentType)
+{
+    // The content type is always the first pre-defined header.
+    mHeaderValue[0] = aContentType;
+}
+
 void Response::SetCallback(void)
 {
     mCallback = true;
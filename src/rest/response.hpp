@@ -86,6 +86,14 @@ public:
      */
     void SetResponsCode(std::string &aCode);
 
+    /**
+     * This method sets the content type of the response, which is JSON by default.
+     *
+     * @param[in] aContentType A string representing the content type such as "text/plain".
+     *
+     */
+    void SetContentType(const std::string &aContentType);
+
     /**
      * This method labels the response as need callback.
      *
@@ -62,17 +62,38 @@ RestWebServer::~RestWebServer(void)
     }
 }
 
-RestWebServer *RestWebServer::GetRestWebServer(ControllerOpenThread *aNcp)
+void RestWebServer::Init(int aListenFd)
 {
-    static RestWebServer *sServer = new RestWebServer(aNcp);
+    mResource.Init();
 
-    return sServer;
+    if (aListenFd < 0 || !AdoptListenFd(aListenFd))
+    {
+        InitializeListenFd();
+    }
 }
 
-void RestWebServer::Init(void)
+bool RestWebServer::AdoptListenFd(int aListenFd)
 {
-    mResource.Init();
-    InitializeListenFd();
+    bool adopted = false;
+    int  flags;
+
+    // The socket was inherited across exec, so it must be close-on-exec again for any child process.
+    VerifyOrExit(fcntl(aListenFd, F_SETFD, FD_CLOEXEC) == 0);
+    VerifyOrExit((flags = fcntl(aListenFd, F_GETFL, 0)) != -1);
+    VerifyOrExit(fcntl(aListenFd, F_SETFL, flags | O_NONBLOCK) == 0);
+
+    mListenFd = aListenFd;
+    adopted   = true;
+    otbrLogInfo("Reuse inherited listening socket %d", aListenFd);
+
+exit:
+    if (!adopted)
+    {
+        otbrLogWarning("Failed to reuse inherited listening socket %d: %s", aListenFd, strerror(errno));
+        close(aListenFd);
+    }
+
+    return adopted;
 }
 
 void RestWebServer::Update(MainloopContext &aMainloop)
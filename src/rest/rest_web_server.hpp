@@ -55,14 +55,12 @@ class RestWebServer : public MainloopProcessor
 {
 public:
     /**
-     * a static function which call the constructor of REST server and return a pointer to the server instance.
+     * The constructor initializes a REST server serving the given NCP controller.
      *
      * @param[in]   aNcp  A pointer to the NCP controller.
      *
-     * @returns A pointer pointing to the static rest server instance.
-     *
      */
-    static RestWebServer *GetRestWebServer(ControllerOpenThread *aNcp);
+    explicit RestWebServer(ControllerOpenThread *aNcp);
 
     /**
      * The destructor destroys the server instance.
@@ -73,8 +71,18 @@ public:
     /**
      * This method initializes the REST server.
      *
+     * @param[in]  aListenFd  A listening socket inherited from the previous process image, or -1 to create one.
+     *
+     */
+    void Init(int aListenFd = -1);
+
+    /**
+     * This method returns the listening socket.
+     *
+     * @returns The file descriptor of the listening socket, or -1 if the server is not initialized.
+     *
      */
-    void Init(void);
+    int GetListenFd(void) const { return mListenFd; }
 
     /**
      * This method updates the mainloop context.
@@ -93,11 +101,11 @@ public:
     void Process(const MainloopContext &aMainloop) override;
 
 private:
-    RestWebServer(ControllerOpenThread *aNcp);
     void      UpdateConnections(const fd_set &aReadFdSet);
     void      CreateNewConnection(int32_t &aFd);
     otbrError Accept(int32_t aListenFd);
     void      InitializeListenFd(void);
+    bool      AdoptListenFd(int aListenFd);
     bool      SetFdNonblocking(int32_t fd);
 
     // Resource handler
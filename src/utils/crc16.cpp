@@ -35,30 +35,104 @@
 
 namespace otbr {
 
+namespace {
+
+// The number of bytes processed in one step, each needs its own table.
+constexpr size_t kSliceCount = 8;
+
+constexpr uint16_t ShiftBits(uint16_t aPolynomial, uint16_t aCrc, uint8_t aBits)
+{
+    return aBits == 0 ? aCrc
+                      : ShiftBits(aPolynomial,
+                                  (aCrc & 0x8000) ? static_cast<uint16_t>((aCrc << 1) ^ aPolynomial)
+                                                  : static_cast<uint16_t>(aCrc << 1),
+                                  aBits - 1);
+}
+
+// Returns the CRC of `aByte` followed by `aSlice` zero bytes.
+constexpr uint16_t TableEntry(uint16_t aPolynomial, size_t aSlice, uint16_t aCrc)
+{
+    return aSlice == 0 ? aCrc
+                       : TableEntry(aPolynomial, aSlice - 1,
+                                    static_cast<uint16_t>(aCrc << 8) ^ ShiftBits(aPolynomial, aCrc & 0xff00, 8));
+}
+
+constexpr uint16_t TableEntry(uint16_t aPolynomial, size_t aIndex)
+{
+    return TableEntry(aPolynomial, aIndex / 256, ShiftBits(aPolynomial, static_cast<uint16_t>((aIndex % 256) << 8), 8));
+}
+
+template <size_t... kIndexes> struct IndexSequence
+{
+};
+
+template <typename First, typename Second> struct ConcatIndexSequence;
+
+template <size_t... kFirst, size_t... kSecond>
+struct ConcatIndexSequence<IndexSequence<kFirst...>, IndexSequence<kSecond...>>
+{
+    typedef IndexSequence<kFirst..., (sizeof...(kFirst) + kSecond)...> Type;
+};
+
+// Builds `IndexSequence<0, ..., kCount - 1>` by halving, which keeps the template instantiation depth logarithmic.
+template <size_t kCount> struct MakeIndexSequence
+{
+    typedef typename ConcatIndexSequence<typename MakeIndexSequence<kCount / 2>::Type,
+                                         typename MakeIndexSequence<kCount - kCount / 2>::Type>::Type Type;
+};
+
+template <> struct MakeIndexSequence<0>
+{
+    typedef IndexSequence<> Type;
+};
+
+template <> struct MakeIndexSequence<1>
+{
+    typedef IndexSequence<0> Type;
+};
+
+template <uint16_t kPolynomial, typename Sequence> struct Table;
+
+template <uint16_t kPolynomial, size_t... kIndexes> struct Table<kPolynomial, IndexSequence<kIndexes...>>
+{
+    static constexpr uint16_t kEntries[sizeof...(kIndexes)] = {TableEntry(kPolynomial, kIndexes)...};
+};
+
+template <uint16_t kPolynomial, size_t... kIndexes>
+constexpr uint16_t Table<kPolynomial, IndexSequence<kIndexes...>>::kEntries[sizeof...(kIndexes)];
+
+template <uint16_t kPolynomial> const uint16_t *GetTable(void)
+{
+    return Table<kPolynomial, MakeIndexSequence<kSliceCount * 256>::Type>::kEntries;
+}
+
+} // namespace
+
 Crc16::Crc16(Polynomial aPolynomial)
+    : mTable(aPolynomial == kCcitt ? GetTable<kCcitt>() : GetTable<kAnsi>())
 {
-    mPolynomial = static_cast<uint16_t>(aPolynomial);
     Init();
 }
 
-void Crc16::Update(uint8_t aByte)
+void Crc16::Update(const uint8_t *aBuffer, size_t aLength)
 {
-    uint8_t i;
+    uint16_t crc = mCrc;
+
+    for (; aLength >= kSliceCount; aBuffer += kSliceCount, aLength -= kSliceCount)
+    {
+        // The current CRC is folded into the first two bytes, each byte then contributes the CRC of itself followed
+        // by the number of bytes after it in this slice.
+        crc = mTable[7 * 256 + ((crc >> 8) ^ aBuffer[0])] ^ mTable[6 * 256 + ((crc & 0xff) ^ aBuffer[1])] ^
+              mTable[5 * 256 + aBuffer[2]] ^ mTable[4 * 256 + aBuffer[3]] ^ mTable[3 * 256 + aBuffer[4]] ^
+              mTable[2 * 256 + aBuffer[5]] ^ mTable[1 * 256 + aBuffer[6]] ^ mTable[aBuffer[7]];
+    }
 
-    mCrc = mCrc ^ static_cast<uint16_t>(aByte << 8);
-    i    = 8;
+    mCrc = crc;
 
-    do
+    while (aLength-- > 0)
     {
-        if (mCrc & 0x8000)
-        {
-            mCrc = static_cast<uint16_t>(mCrc << 1) ^ mPolynomial;
-        }
-        else
-        {
-            mCrc = static_cast<uint16_t>(mCrc << 1);
-        }
-    } while (--i);
+        Update(*aBuffer++);
+    }
 }
 
 } // namespace otbr
@@ -36,6 +36,7 @@
 
 #include "openthread-br/config.h"
 
+#include <stddef.h>
 #include <stdint.h>
 
 namespace otbr {
@@ -67,13 +68,22 @@ public:
      */
     void Init(void) { mCrc = 0; }
 
-    /*c*
+    /**
      * This method feeds a byte value into the CRC16 computation.
      *
      * @param[in]  aByte  The byte value.
      *
      */
-    void Update(uint8_t aByte);
+    void Update(uint8_t aByte) { mCrc = static_cast<uint16_t>(mCrc << 8) ^ mTable[(mCrc >> 8) ^ aByte]; }
+
+    /**
+     * This method feeds a buffer into the CRC16 computation.
+     *
+     * @param[in]  aBuffer  A pointer to the buffer.
+     * @param[in]  aLength  The number of bytes in @p aBuffer.
+     *
+     */
+    void Update(const uint8_t *aBuffer, size_t aLength);
 
     /**
      * This method gets the current CRC16 value.
@@ -84,8 +94,9 @@ public:
     uint16_t Get(void) const { return mCrc; }
 
 private:
-    uint16_t mPolynomial;
-    uint16_t mCrc;
+    // The lookup tables for slicing-by-8, table `k` is at offset `k * 256`.
+    const uint16_t *mTable;
+    uint16_t        mCrc;
 };
 
 } // namespace otbr
@@ -33,98 +33,197 @@
 
 #include "utils/hex.hpp"
 
-#include <string>
-
-#include <stdio.h>
 #include <string.h>
 
+#include "common/code_utils.hpp"
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
 namespace otbr {
 
 namespace Utils {
 
-int Hex2Bytes(const char *aHex, uint8_t *aBytes, uint16_t aBytesLength)
+namespace {
+
+const char kHexDigits[] = "0123456789ABCDEF";
+
+// The value of each hex digit, 0xff for characters which are not hex digits.
+const uint8_t kHexValues[256] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+#if defined(__SSSE3__)
+
+// Decodes 32 hex digits into 16 bytes, returns false if any character is not a hex digit.
+bool DecodeBlock(const char *aHex, uint8_t *aBytes)
 {
-    size_t      hexLength = strlen(aHex);
-    const char *hexEnd    = aHex + hexLength;
-    uint8_t *   cur       = aBytes;
-    uint8_t     numChars  = hexLength & 1;
-    uint8_t     byte      = 0;
+    const __m128i kZero    = _mm_setzero_si128();
+    const __m128i kOne     = _mm_set1_epi8(1);
+    const __m128i kNibbles = _mm_set1_epi16(0x0110);
+    __m128i       values[2];
+    int           valid = 0xffff;
 
-    if ((hexLength + 1) / 2 > aBytesLength)
+    for (int i = 0; i < 2; i++)
     {
-        return -1;
+        __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(aHex + 16 * i));
+
+        // After the subtractions, only '0'..'9' map to 1..10 and only 'A'..'F' and 'a'..'f' map to 1..6.
+        __m128i digit   = _mm_sub_epi8(chars, _mm_set1_epi8('0' - 1));
+        __m128i alpha   = _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)), _mm_set1_epi8('a' - 1));
+        __m128i isDigit = _mm_and_si128(_mm_cmpgt_epi8(digit, kZero), _mm_cmplt_epi8(digit, _mm_set1_epi8(11)));
+        __m128i isAlpha = _mm_and_si128(_mm_cmpgt_epi8(alpha, kZero), _mm_cmplt_epi8(alpha, _mm_set1_epi8(7)));
+
+        valid &= _mm_movemask_epi8(_mm_or_si128(isDigit, isAlpha));
+
+        values[i] = _mm_or_si128(_mm_and_si128(isDigit, _mm_sub_epi8(digit, kOne)),
+                                 _mm_and_si128(isAlpha, _mm_add_epi8(alpha, _mm_set1_epi8(9))));
+
+        // Each 16-bit lane becomes high nibble * 16 + low nibble.
+        values[i] = _mm_maddubs_epi16(values[i], kNibbles);
     }
 
-    while (aHex < hexEnd)
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(aBytes), _mm_packus_epi16(values[0], values[1]));
+
+    return valid == 0xffff;
+}
+
+// Encodes 16 bytes into 32 hex digits.
+void EncodeBlock(const uint8_t *aBytes, char *aHex)
+{
+    const __m128i kDigits = _mm_loadu_si128(reinterpret_cast<const __m128i *>(kHexDigits));
+    const __m128i kMask   = _mm_set1_epi8(0x0f);
+    __m128i       bytes   = _mm_loadu_si128(reinterpret_cast<const __m128i *>(aBytes));
+    __m128i       high    = _mm_shuffle_epi8(kDigits, _mm_and_si128(_mm_srli_epi16(bytes, 4), kMask));
+    __m128i       low     = _mm_shuffle_epi8(kDigits, _mm_and_si128(bytes, kMask));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(aHex), _mm_unpacklo_epi8(high, low));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(aHex + 16), _mm_unpackhi_epi8(high, low));
+}
+
+#endif // defined(__SSSE3__)
+
+} // namespace
+
+otbrError Hex2Bytes(const char *aHex, size_t aHexLength, uint8_t *aBytes, size_t aBytesSize, size_t &aLength)
+{
+    otbrError      error   = OTBR_ERROR_NONE;
+    const uint8_t *hex     = reinterpret_cast<const uint8_t *>(aHex);
+    size_t         length  = (aHexLength + 1) / 2;
+    size_t         offset  = 0;
+    uint8_t *      cur     = aBytes;
+    uint8_t        invalid = 0;
+
+    VerifyOrExit(length <= aBytesSize, error = OTBR_ERROR_INVALID_ARGS);
+
+    if (aHexLength & 1)
     {
-        if ('A' <= *aHex && *aHex <= 'F')
-        {
-            byte |= 10 + (*aHex - 'A');
-        }
-        else if ('a' <= *aHex && *aHex <= 'f')
-        {
-            byte |= 10 + (*aHex - 'a');
-        }
-        else if ('0' <= *aHex && *aHex <= '9')
-        {
-            byte |= *aHex - '0';
-        }
-        else
-        {
-            return -1;
-        }
+        invalid |= kHexValues[hex[0]];
+        *cur++ = kHexValues[hex[0]];
+        offset = 1;
+    }
 
-        aHex++;
-        numChars++;
+#if defined(__SSSE3__)
+    for (; offset + 32 <= aHexLength; offset += 32, cur += 16)
+    {
+        invalid |= DecodeBlock(aHex + offset, cur) ? 0 : 0xff;
+    }
+#endif
 
-        if (numChars >= 2)
-        {
-            numChars = 0;
-            *cur++   = byte;
-            byte     = 0;
-        }
-        else
+    // Invalid characters are accumulated rather than checked one by one to keep the loop free of branches.
+    for (; offset < aHexLength; offset += 2)
+    {
+        uint8_t high = kHexValues[hex[offset]];
+        uint8_t low  = kHexValues[hex[offset + 1]];
+
+        invalid |= high | low;
+        *cur++ = static_cast<uint8_t>((high << 4) | (low & 0x0f));
+    }
+
+    if (invalid & 0xf0)
+    {
+        // Locate the first invalid character to report it precisely.
+        for (offset = 0; kHexValues[hex[offset]] != 0xff; offset++)
         {
-            byte <<= 4;
         }
+
+        ExitNow(error = OTBR_ERROR_PARSE);
     }
 
-    return static_cast<int>(cur - aBytes);
+    offset = length;
+
+exit:
+    aLength = offset;
+    return error;
 }
 
-size_t Bytes2Hex(const uint8_t *aBytes, const uint16_t aBytesLength, char *aHex)
+int Hex2Bytes(const char *aHex, uint8_t *aBytes, uint16_t aBytesLength)
 {
-    char byteHex[3];
+    size_t length;
 
-    std::string hexString;
-    uint8_t     cur[aBytesLength];
+    return Hex2Bytes(aHex, strlen(aHex), aBytes, aBytesLength, length) == OTBR_ERROR_NONE ? static_cast<int>(length)
+                                                                                            : -1;
+}
 
-    memcpy(cur, aBytes, aBytesLength);
+otbrError Bytes2Hex(const uint8_t *aBytes, size_t aBytesLength, char *aHex, size_t aHexSize)
+{
+    otbrError error  = OTBR_ERROR_NONE;
+    size_t    offset = 0;
+
+    VerifyOrExit(aHexSize >= aBytesLength * 2 + 1, error = OTBR_ERROR_INVALID_ARGS);
 
-    for (int i = 0; i < aBytesLength; i++)
+#if defined(__SSSE3__)
+    for (; offset + 16 <= aBytesLength; offset += 16)
     {
-        sprintf(byteHex, "%02X", cur[i]);
-        hexString += byteHex;
+        EncodeBlock(aBytes + offset, aHex + offset * 2);
     }
-    strcpy(aHex, hexString.c_str());
-    return strlen(aHex);
+#endif
+
+    for (; offset < aBytesLength; offset++)
+    {
+        aHex[offset * 2]     = kHexDigits[aBytes[offset] >> 4];
+        aHex[offset * 2 + 1] = kHexDigits[aBytes[offset] & 0x0f];
+    }
+
+    aHex[aBytesLength * 2] = '\0';
+
+exit:
+    return error;
+}
+
+size_t Bytes2Hex(const uint8_t *aBytes, const uint16_t aBytesLength, char *aHex)
+{
+    Bytes2Hex(aBytes, aBytesLength, aHex, aBytesLength * 2 + 1);
+
+    return aBytesLength * 2;
 }
 
 size_t Long2Hex(const uint64_t aLong, char *aHex)
 {
-    std::string hexString;
-    char        byteHex[3];
-    uint64_t    longValue = aLong;
+    uint8_t bytes[sizeof(uint64_t)];
 
     for (uint8_t i = 0; i < sizeof(uint64_t); i++)
     {
-        uint8_t byte = longValue & 0xff;
-        sprintf(byteHex, "%02X", byte);
-        hexString += byteHex;
-        longValue = longValue >> 8;
+        bytes[i] = static_cast<uint8_t>(aLong >> (8 * i));
     }
-    strcpy(aHex, hexString.c_str());
-    return strlen(aHex);
+
+    return Bytes2Hex(bytes, sizeof(bytes), aHex);
 }
 
 } // namespace Utils
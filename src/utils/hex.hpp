@@ -39,14 +39,81 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "common/types.hpp"
+
 namespace otbr {
 
 namespace Utils {
 
+/**
+ * This function decodes a NUL-terminated hex string.
+ *
+ * An odd number of hex digits is decoded as if it was prefixed with '0'.
+ *
+ * @param[in]   aHex          A pointer to the hex string.
+ * @param[out]  aBytes        A pointer to the output buffer.
+ * @param[in]   aBytesLength  The size of @p aBytes.
+ *
+ * @returns The number of decoded bytes, or -1 if @p aHex is invalid or @p aBytes is too small.
+ *
+ */
 int Hex2Bytes(const char *aHex, uint8_t *aBytes, uint16_t aBytesLength);
 
+/**
+ * This function decodes a hex string into a caller provided buffer.
+ *
+ * An odd number of hex digits is decoded as if it was prefixed with '0'.
+ *
+ * @param[in]   aHex          A pointer to the hex digits, not necessarily NUL-terminated.
+ * @param[in]   aHexLength    The number of hex digits.
+ * @param[out]  aBytes        A pointer to the output buffer.
+ * @param[in]   aBytesSize    The size of @p aBytes.
+ * @param[out]  aLength       The number of decoded bytes on success, or the offset of the first invalid character
+ *                            on OTBR_ERROR_PARSE.
+ *
+ * @retval OTBR_ERROR_NONE          Successfully decoded the hex string.
+ * @retval OTBR_ERROR_PARSE         @p aHex contains a character which is not a hex digit.
+ * @retval OTBR_ERROR_INVALID_ARGS  @p aBytes is too small.
+ *
+ */
+otbrError Hex2Bytes(const char *aHex, size_t aHexLength, uint8_t *aBytes, size_t aBytesSize, size_t &aLength);
+
+/**
+ * This function encodes bytes into upper case hex digits followed by a NUL character.
+ *
+ * @param[in]   aBytes        A pointer to the bytes.
+ * @param[in]   aBytesLength  The number of bytes.
+ * @param[out]  aHex          A pointer to the output buffer, which MUST have room for 2 * @p aBytesLength + 1
+ *                            characters.
+ *
+ * @returns The number of hex digits written.
+ *
+ */
 size_t Bytes2Hex(const uint8_t *aBytes, const uint16_t aBytesLength, char *aHex);
 
+/**
+ * This function encodes bytes into upper case hex digits followed by a NUL character.
+ *
+ * @param[in]   aBytes        A pointer to the bytes.
+ * @param[in]   aBytesLength  The number of bytes.
+ * @param[out]  aHex          A pointer to the output buffer.
+ * @param[in]   aHexSize      The size of @p aHex.
+ *
+ * @retval OTBR_ERROR_NONE          Successfully encoded the bytes.
+ * @retval OTBR_ERROR_INVALID_ARGS  @p aHex is smaller than 2 * @p aBytesLength + 1 characters.
+ *
+ */
+otbrError Bytes2Hex(const uint8_t *aBytes, size_t aBytesLength, char *aHex, size_t aHexSize);
+
+/**
+ * This function encodes a 64-bit integer into upper case hex digits, least significant byte first.
+ *
+ * @param[in]   aLong  The integer.
+ * @param[out]  aHex   A pointer to the output buffer, which MUST have room for 17 characters.
+ *
+ * @returns The number of hex digits written.
+ *
+ */
 size_t Long2Hex(const uint64_t aLong, char *aHex);
 
 } // namespace Utils
@@ -33,6 +33,10 @@
 
 #include "utils/pskc.hpp"
 
+#include <algorithm>
+
+#include <mbedtls/sha256.h>
+
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
 
@@ -116,5 +120,162 @@ const uint8_t *Pskc::ComputePskc(const uint8_t *aExtPanId, const char *aNetworkN
     return mPskc;
 }
 
+PskcService::PskcService(size_t aWorkerCount)
+    : mWorkerCount(aWorkerCount)
+    , mStopping(false)
+{
+    if (mWorkerCount == 0)
+    {
+        mWorkerCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+PskcService::~PskcService(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mStopping = true;
+    }
+
+    mCondVar.notify_all();
+
+    for (std::thread &worker : mWorkers)
+    {
+        worker.join();
+    }
+}
+
+PskcService &PskcService::Get(void)
+{
+    static PskcService sPskcService;
+
+    return sPskcService;
+}
+
+std::string PskcService::MakeCacheKey(const uint8_t *aExtPanId, const char *aNetworkName, const char *aPassphrase)
+{
+    uint8_t                passphraseHash[32];
+    mbedtls_sha256_context sha256;
+    std::string            key;
+
+    mbedtls_sha256_init(&sha256);
+    mbedtls_sha256_starts(&sha256, 0);
+    mbedtls_sha256_update(&sha256, reinterpret_cast<const uint8_t *>(aPassphrase), strlen(aPassphrase));
+    mbedtls_sha256_finish(&sha256, passphraseHash);
+    mbedtls_sha256_free(&sha256);
+
+    key.append(reinterpret_cast<const char *>(passphraseHash), sizeof(passphraseHash));
+    key.append(reinterpret_cast<const char *>(aExtPanId), OT_EXTENDED_PAN_ID_LENGTH);
+    key.append(aNetworkName);
+
+    return key;
+}
+
+std::shared_future<PskcValue> PskcService::ComputeAsync(const uint8_t *aExtPanId,
+                                                        const char *   aNetworkName,
+                                                        const char *   aPassphrase)
+{
+    std::string                   key = MakeCacheKey(aExtPanId, aNetworkName, aPassphrase);
+    std::shared_future<PskcValue> result;
+    std::lock_guard<std::mutex>   lock(mMutex);
+    auto                          cached = mCache.find(key);
+
+    // Identical requests share the same result, whether it is ready or still being computed.
+    VerifyOrExit(cached == mCache.end(), result = cached->second);
+
+    mJobs.emplace_back();
+    memcpy(mJobs.back().mRequest.mExtPanId, aExtPanId, OT_EXTENDED_PAN_ID_LENGTH);
+    mJobs.back().mRequest.mNetworkName = aNetworkName;
+    mJobs.back().mRequest.mPassphrase  = aPassphrase;
+    result                             = mJobs.back().mPromise.get_future().share();
+
+    if (mCacheOrder.size() >= kCacheSize)
+    {
+        mCache.erase(mCacheOrder.front());
+        mCacheOrder.pop_front();
+    }
+
+    mCache.emplace(key, result);
+    mCacheOrder.push_back(std::move(key));
+
+    StartWorkers();
+    mCondVar.notify_one();
+
+exit:
+    return result;
+}
+
+std::vector<PskcValue> PskcService::ComputeBatch(const std::vector<Request> &aRequests)
+{
+    std::vector<std::shared_future<PskcValue>> futures;
+    std::vector<PskcValue>                     values;
+
+    futures.reserve(aRequests.size());
+    values.reserve(aRequests.size());
+
+    for (const Request &request : aRequests)
+    {
+        futures.push_back(ComputeAsync(request.mExtPanId, request.mNetworkName.c_str(), request.mPassphrase.c_str()));
+    }
+
+    for (const std::shared_future<PskcValue> &future : futures)
+    {
+        values.push_back(future.get());
+    }
+
+    return values;
+}
+
+void PskcService::ClearCache(void)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    mCache.clear();
+    mCacheOrder.clear();
+}
+
+void PskcService::StartWorkers(void)
+{
+    while (mWorkers.size() < mWorkerCount)
+    {
+        mWorkers.emplace_back(&PskcService::RunWorker, this);
+    }
+}
+
+void PskcService::RunWorker(void)
+{
+    Pskc pskc;
+
+    while (true)
+    {
+        Job       job;
+        PskcValue value;
+
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+
+            mCondVar.wait(lock, [this]() { return mStopping || !mJobs.empty(); });
+
+            if (mJobs.empty())
+            {
+                break;
+            }
+
+            job = std::move(mJobs.front());
+            mJobs.pop_front();
+        }
+
+        memcpy(value.data(),
+               pskc.ComputePskc(job.mRequest.mExtPanId, job.mRequest.mNetworkName.c_str(),
+                                job.mRequest.mPassphrase.c_str()),
+               value.size());
+        // Only the hash in the cache key outlives the computation.
+        std::fill(job.mRequest.mPassphrase.begin(), job.mRequest.mPassphrase.end(), '\0');
+        job.mRequest.mPassphrase.clear();
+        job.mPromise.set_value(value);
+    }
+}
+
 } // namespace Psk
 } // namespace otbr
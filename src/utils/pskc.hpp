@@ -42,6 +42,16 @@
 #define OT_PBKDF2_SALT_MAX_LENGTH 30
 #define OT_PSKC_LENGTH 16
 
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
 #include <stdint.h>
 #include <string.h>
 
@@ -79,6 +89,114 @@ private:
     uint8_t  mPskc[OT_PSKC_LENGTH];
 };
 
+/**
+ * This type represents a PSKc value.
+ *
+ */
+typedef std::array<uint8_t, OT_PSKC_LENGTH> PskcValue;
+
+/**
+ * This class computes PSKc values on a pool of worker threads and caches the results.
+ *
+ * Results are cached by the SHA-256 hash of the passphrase, the extended PAN ID and the network name, so the cache
+ * doesn't keep passphrases. A queued computation keeps a copy of its passphrase, which is wiped once it's computed.
+ *
+ */
+class PskcService
+{
+public:
+    /**
+     * This structure represents a PSKc computation request.
+     *
+     */
+    struct Request
+    {
+        uint8_t     mExtPanId[OT_EXTENDED_PAN_ID_LENGTH]; ///< The extended PAN ID.
+        std::string mNetworkName;                         ///< The network name.
+        std::string mPassphrase;                          ///< The passphrase.
+    };
+
+    /**
+     * The constructor initializes the PSKc service.
+     *
+     * Worker threads are created on the first computation.
+     *
+     * @param[in]  aWorkerCount  The number of worker threads, zero to use one per CPU core.
+     *
+     */
+    explicit PskcService(size_t aWorkerCount = 0);
+
+    /**
+     * The destructor waits for the outstanding computations and stops the worker threads.
+     *
+     */
+    ~PskcService(void);
+
+    /**
+     * This method returns the process-wide PSKc service.
+     *
+     * @returns A reference to the PSKc service.
+     *
+     */
+    static PskcService &Get(void);
+
+    /**
+     * This method computes the PSKc asynchronously.
+     *
+     * @param[in]  aExtPanId      A pointer to extended PAN ID.
+     * @param[in]  aNetworkName   A pointer to network name.
+     * @param[in]  aPassphrase    A pointer to passphrase.
+     *
+     * @returns A future of the PSKc value, which is immediately ready on a cache hit.
+     *
+     */
+    std::shared_future<PskcValue> ComputeAsync(const uint8_t *aExtPanId,
+                                               const char *   aNetworkName,
+                                               const char *   aPassphrase);
+
+    /**
+     * This method computes PSKc values of many requests in parallel and waits for all of them.
+     *
+     * @param[in]  aRequests  The requests.
+     *
+     * @returns The PSKc values in the same order as @p aRequests.
+     *
+     */
+    std::vector<PskcValue> ComputeBatch(const std::vector<Request> &aRequests);
+
+    /**
+     * This method clears the cached PSKc values.
+     *
+     */
+    void ClearCache(void);
+
+private:
+    enum
+    {
+        kCacheSize = 64,
+    };
+
+    struct Job
+    {
+        Request                 mRequest;
+        std::promise<PskcValue> mPromise;
+    };
+
+    static std::string MakeCacheKey(const uint8_t *aExtPanId, const char *aNetworkName, const char *aPassphrase);
+
+    void StartWorkers(void);
+    void RunWorker(void);
+
+    size_t                                                         mWorkerCount;
+    std::vector<std::thread>                                       mWorkers;
+    std::mutex                                                     mMutex;
+    std::condition_variable                                        mCondVar;
+    std::deque<Job>                                                mJobs;
+    bool                                                           mStopping;
+    std::unordered_map<std::string, std::shared_future<PskcValue>> mCache;
+    std::deque<std::string>                                        mCacheOrder;
+};
+
 } // namespace Psk
 } // namespace otbr
 
@@ -28,6 +28,10 @@
 
 #include "utils/steering_data.hpp"
 
+#include <algorithm>
+#include <thread>
+#include <vector>
+
 #include <assert.h>
 #include <mbedtls/sha256.h>
 
@@ -35,6 +39,9 @@
 
 namespace otbr {
 
+// Hashing fewer joiners than this on a thread costs less than creating the thread.
+static const size_t kMinJoinersPerThread = 256;
+
 void SteeringData::Init(uint8_t aLength)
 {
     assert(aLength <= kMaxSizeOfBloomFilter);
@@ -60,18 +67,90 @@ void SteeringData::ComputeJoinerId(const uint8_t *aEui64, uint8_t *aJoinerId)
     aJoinerId[0] |= 2;
 }
 
+void SteeringData::ComputeJoinerIds(const uint8_t *aEui64s, uint8_t *aJoinerIds, size_t aCount)
+{
+    size_t                   threadCount = std::max(1u, std::thread::hardware_concurrency());
+    size_t                   chunkSize;
+    std::vector<std::thread> threads;
+
+    auto computeChunk = [aEui64s, aJoinerIds, aCount](size_t aBegin, size_t aEnd) {
+        for (size_t i = aBegin; i < std::min(aEnd, aCount); i++)
+        {
+            ComputeJoinerId(aEui64s + i * kSizeJoinerId, aJoinerIds + i * kSizeJoinerId);
+        }
+    };
+
+    threadCount = std::max<size_t>(1, std::min(threadCount, aCount / kMinJoinersPerThread));
+    chunkSize   = (aCount + threadCount - 1) / threadCount;
+
+    for (size_t begin = chunkSize; begin < aCount; begin += chunkSize)
+    {
+        threads.emplace_back(computeChunk, begin, begin + chunkSize);
+    }
+
+    // The calling thread takes the first chunk.
+    computeChunk(0, chunkSize);
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+}
+
+void SteeringData::ComputeBloomFilter(const uint8_t *aJoinerIds, size_t aCount)
+{
+    for (size_t i = 0; i < aCount; i++)
+    {
+        ComputeBloomFilter(aJoinerIds + i * kSizeJoinerId);
+    }
+}
+
+double SteeringData::GetFillRatio(void) const
+{
+    uint16_t setBits = 0;
+
+    for (uint8_t i = 0; i < mLength; i++)
+    {
+        setBits += __builtin_popcount(mBloomFilter[i]);
+    }
+
+    return mLength == 0 ? 0 : static_cast<double>(setBits) / (mLength * 8);
+}
+
+double SteeringData::GetFalsePositiveRate(void) const
+{
+    double fillRatio = GetFillRatio();
+
+    return fillRatio * fillRatio;
+}
+
+uint8_t SteeringData::FindOptimalLength(const uint8_t *aJoinerIds, size_t aCount, double aTargetFpRate)
+{
+    uint8_t      length = 1;
+    SteeringData steeringData;
+
+    for (; length < kMaxSizeOfBloomFilter; length++)
+    {
+        steeringData.Init(length);
+        steeringData.ComputeBloomFilter(aJoinerIds, aCount);
+
+        if (steeringData.GetFalsePositiveRate() <= aTargetFpRate)
+        {
+            break;
+        }
+    }
+
+    return length;
+}
+
 void SteeringData::ComputeBloomFilter(const uint8_t *aJoinerId)
 {
     Crc16          ccitt(Crc16::kCcitt);
     Crc16          ansi(Crc16::kAnsi);
     const uint16_t numBits = mLength * 8;
 
-    for (size_t i = 0; i < kSizeJoinerId; i++)
-    {
-        uint8_t byte = aJoinerId[i];
-        ccitt.Update(byte);
-        ansi.Update(byte);
-    }
+    ccitt.Update(aJoinerId, kSizeJoinerId);
+    ansi.Update(aJoinerId, kSizeJoinerId);
 
     SetBit(static_cast<uint8_t>(ccitt.Get() % numBits));
     SetBit(static_cast<uint8_t>(ansi.Get() % numBits));
@@ -36,6 +36,7 @@
 
 #include "openthread-br/config.h"
 
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -90,6 +91,45 @@ public:
      */
     void ComputeBloomFilter(const uint8_t *aJoinerId);
 
+    /**
+     * This method adds many joiners to the Bloom Filter.
+     *
+     * @param[in]  aJoinerIds  A pointer to @p aCount consecutive joiner ids.
+     * @param[in]  aCount      The number of joiner ids.
+     *
+     */
+    void ComputeBloomFilter(const uint8_t *aJoinerIds, size_t aCount);
+
+    /**
+     * This method returns the ratio of bits set in the bloom filter.
+     *
+     * @returns The fill ratio between 0 and 1.
+     *
+     */
+    double GetFillRatio(void) const;
+
+    /**
+     * This method returns the probability that a joiner not added to the bloom filter is accepted.
+     *
+     * Each joiner sets two bits, so a joiner not added is accepted when both of its bits happen to be set.
+     *
+     * @returns The false positive rate between 0 and 1.
+     *
+     */
+    double GetFalsePositiveRate(void) const;
+
+    /**
+     * This method finds the shortest bloom filter length whose false positive rate is within the target.
+     *
+     * @param[in]  aJoinerIds       A pointer to @p aCount consecutive joiner ids.
+     * @param[in]  aCount           The number of joiner ids.
+     * @param[in]  aTargetFpRate    The target false positive rate.
+     *
+     * @returns The shortest length meeting @p aTargetFpRate, or kMaxSizeOfBloomFilter if none does.
+     *
+     */
+    static uint8_t FindOptimalLength(const uint8_t *aJoinerIds, size_t aCount, double aTargetFpRate);
+
     /**
      * This method computes joiner id from EUI64.
      *
@@ -99,6 +139,16 @@ public:
      */
     static void ComputeJoinerId(const uint8_t *aEui64, uint8_t *aJoinerId);
 
+    /**
+     * This method computes joiner ids from many EUI64s, spreading the work across all CPU cores.
+     *
+     * @param[in]   aEui64s     A pointer to @p aCount consecutive EUI64s.
+     * @param[out]  aJoinerIds  A pointer to receive @p aCount joiner ids. This pointer can be the same as @p aEui64s.
+     * @param[in]   aCount      The number of EUI64s.
+     *
+     */
+    static void ComputeJoinerIds(const uint8_t *aEui64s, uint8_t *aJoinerIds, size_t aCount);
+
     /**
      * This method returns a pointer to the bloom filter.
      *
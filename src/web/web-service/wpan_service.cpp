@@ -187,7 +187,6 @@ std::string WpanService::HandleFormNetworkRequest(const std::string &aFormReques
     Json::FastWriter            jsonWriter;
     Json::Reader                reader;
     std::string                 response;
-    otbr::Psk::Pskc             psk;
     char                        pskcStr[OT_PSKC_MAX_LENGTH * 2 + 1];
     uint8_t                     extPanIdBytes[OT_EXTENDED_PANID_LENGTH];
     std::string                 masterKey;
@@ -216,8 +215,10 @@ std::string WpanService::HandleFormNetworkRequest(const std::string &aFormReques
     defaultRoute = root["defaultRoute"].asBool();
 
     otbr::Utils::Hex2Bytes(root["extPanId"].asString().c_str(), extPanIdBytes, OT_EXTENDED_PANID_LENGTH);
-    otbr::Utils::Bytes2Hex(psk.ComputePskc(extPanIdBytes, networkName.c_str(), passphrase.c_str()), OT_PSKC_MAX_LENGTH,
-                           pskcStr);
+    // The dataset needs the PSKc, so this blocks until it is computed. Only a repeated form is answered from the cache.
+    otbr::Utils::Bytes2Hex(
+        otbr::Psk::PskcService::Get().ComputeAsync(extPanIdBytes, networkName.c_str(), passphrase.c_str()).get().data(),
+        OT_PSKC_MAX_LENGTH, pskcStr);
 
     if (prefix.find('/') == std::string::npos)
     {
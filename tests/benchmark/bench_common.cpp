@@ -0,0 +1,148 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/dns_utils.hpp"
+#include "common/task_runner.hpp"
+#include "common/tlv.hpp"
+#include "common/types.hpp"
+
+#include <string>
+#include <vector>
+
+#include <sys/select.h>
+
+#include <benchmark/benchmark.h>
+
+static void BM_SplitFullDnsName(benchmark::State &aState)
+{
+    const std::vector<std::string> names = {
+        "host1.default.service.arpa.",
+        "_meshcop._udp.default.service.arpa.",
+        "OpenThread BR 1234._meshcop._udp.default.service.arpa.",
+    };
+    size_t i = 0;
+
+    for (auto _ : aState)
+    {
+        DnsNameInfo info = SplitFullDnsName(names[i++ % names.size()]);
+
+        benchmark::DoNotOptimize(info);
+    }
+
+    aState.SetItemsProcessed(aState.iterations());
+}
+BENCHMARK(BM_SplitFullDnsName);
+
+static void BM_Ip6AddressString(benchmark::State &aState)
+{
+    otbr::Ip6Address address;
+
+    otbr::Ip6Address::FromString("fd00:db8:0:1:a8e5:33ff:fe0e:1c4", address);
+
+    for (auto _ : aState)
+    {
+        otbr::Ip6AddressString str(address);
+
+        benchmark::DoNotOptimize(str);
+    }
+
+    aState.SetItemsProcessed(aState.iterations());
+}
+BENCHMARK(BM_Ip6AddressString);
+
+static void BM_Ip6AddressToString(benchmark::State &aState)
+{
+    otbr::Ip6Address address;
+
+    otbr::Ip6Address::FromString("fd00:db8:0:1:a8e5:33ff:fe0e:1c4", address);
+
+    for (auto _ : aState)
+    {
+        std::string str = address.ToString();
+
+        benchmark::DoNotOptimize(str);
+    }
+
+    aState.SetItemsProcessed(aState.iterations());
+}
+BENCHMARK(BM_Ip6AddressToString);
+
+static void BM_TlvReaderFind(benchmark::State &aState)
+{
+    uint8_t          buffer[1024];
+    otbr::TlvWriter  writer(buffer, sizeof(buffer));
+    otbr::TlvInfo    tlv;
+    const uint8_t    name[16] = {'O', 'p', 'e', 'n', 'T', 'h', 'r', 'e', 'a', 'd'};
+    const uint8_t    type     = static_cast<uint8_t>(aState.range(0));
+
+    // A dataset-sized TLV sequence, the searched type is at the end.
+    for (uint8_t i = 0; i < type; i++)
+    {
+        writer.Append(i, name, sizeof(name));
+    }
+    writer.AppendUint64(type, 0x0123456789abcdef);
+
+    for (auto _ : aState)
+    {
+        otbrError error = writer.GetReader().Find(type, tlv);
+
+        benchmark::DoNotOptimize(error);
+    }
+
+    aState.SetBytesProcessed(aState.iterations() * static_cast<int64_t>(writer.GetLength()));
+}
+BENCHMARK(BM_TlvReaderFind)->Arg(1)->Arg(16)->Arg(50);
+
+static void BM_TaskRunnerPostPop(benchmark::State &aState)
+{
+    otbr::TaskRunner      taskRunner;
+    otbr::MainloopContext mainloop;
+    const int64_t         batch   = aState.range(0);
+    int64_t               counter = 0;
+
+    for (auto _ : aState)
+    {
+        for (int64_t i = 0; i < batch; i++)
+        {
+            taskRunner.Post([&counter]() { ++counter; });
+        }
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = {0, 0};
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        taskRunner.Update(mainloop);
+        taskRunner.Process(mainloop);
+    }
+
+    benchmark::DoNotOptimize(counter);
+    aState.SetItemsProcessed(aState.iterations() * batch);
+}
+BENCHMARK(BM_TaskRunnerPostPop)->Arg(1)->Arg(64)->Arg(1024);
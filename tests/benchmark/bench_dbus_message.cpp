@@ -0,0 +1,85 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dbus/common/dbus_message_helper.hpp"
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+using otbr::DBus::ChildInfo;
+using otbr::DBus::DBusMessageEncode;
+using otbr::DBus::NeighborInfo;
+
+template <typename T> static void EncodeTable(benchmark::State &aState, const std::vector<T> &aTable)
+{
+    for (auto _ : aState)
+    {
+        DBusMessage *   message = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+        DBusMessageIter iter;
+        otbrError       error;
+
+        dbus_message_iter_init_append(message, &iter);
+        error = DBusMessageEncode(&iter, aTable);
+        benchmark::DoNotOptimize(error);
+        dbus_message_unref(message);
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * static_cast<int64_t>(aTable.size()));
+}
+
+static void BM_DBusMessageEncodeChildTable(benchmark::State &aState)
+{
+    std::vector<ChildInfo> table(static_cast<size_t>(aState.range(0)));
+
+    for (size_t i = 0; i < table.size(); i++)
+    {
+        table[i]             = ChildInfo{};
+        table[i].mExtAddress = 0x1122334455667700 + i;
+        table[i].mRloc16     = static_cast<uint16_t>(0x0401 + i);
+        table[i].mChildId    = static_cast<uint16_t>(i + 1);
+    }
+
+    EncodeTable(aState, table);
+}
+BENCHMARK(BM_DBusMessageEncodeChildTable)->Arg(10)->Arg(64)->Arg(511);
+
+static void BM_DBusMessageEncodeNeighborTable(benchmark::State &aState)
+{
+    std::vector<NeighborInfo> table(static_cast<size_t>(aState.range(0)));
+
+    for (size_t i = 0; i < table.size(); i++)
+    {
+        table[i]             = NeighborInfo{};
+        table[i].mExtAddress = 0x1122334455667700 + i;
+        table[i].mRloc16     = static_cast<uint16_t>(i << 10);
+    }
+
+    EncodeTable(aState, table);
+}
+BENCHMARK(BM_DBusMessageEncodeNeighborTable)->Arg(10)->Arg(32)->Arg(64);
@@ -0,0 +1,58 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mdns/mdns.hpp"
+
+#include <stdio.h>
+
+#include <benchmark/benchmark.h>
+
+static void BM_EncodeTxtData(benchmark::State &aState)
+{
+    otbr::Mdns::Publisher::TxtList txtList;
+    uint8_t                        txtData[1024];
+
+    for (int64_t i = 0; i < aState.range(0); i++)
+    {
+        char name[16];
+
+        snprintf(name, sizeof(name), "key%d", static_cast<int>(i));
+        txtList.emplace_back(name, "value-of-the-entry");
+    }
+
+    for (auto _ : aState)
+    {
+        uint16_t  txtLength = sizeof(txtData);
+        otbrError error     = otbr::Mdns::Publisher::EncodeTxtData(txtList, txtData, txtLength);
+
+        benchmark::DoNotOptimize(error);
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+BENCHMARK(BM_EncodeTxtData)->Arg(1)->Arg(8)->Arg(32);
@@ -0,0 +1,122 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rest/json.hpp"
+#include "rest/response.hpp"
+
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+static otNetworkDiagTlv MakeDiagTlv(uint8_t aType)
+{
+    otNetworkDiagTlv tlv;
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType = aType;
+
+    return tlv;
+}
+
+// A diagnostic response of a router with a few addresses and children.
+static std::vector<otNetworkDiagTlv> MakeRouterDiag(uint16_t aRloc16)
+{
+    std::vector<otNetworkDiagTlv> diag;
+    otNetworkDiagTlv              tlv;
+
+    tlv = MakeDiagTlv(OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS);
+    memset(tlv.mData.mExtAddress.m8, 0x5a, sizeof(tlv.mData.mExtAddress.m8));
+    diag.push_back(tlv);
+
+    tlv               = MakeDiagTlv(OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS);
+    tlv.mData.mAddr16 = aRloc16;
+    diag.push_back(tlv);
+
+    diag.push_back(MakeDiagTlv(OT_NETWORK_DIAGNOSTIC_TLV_MODE));
+    diag.push_back(MakeDiagTlv(OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY));
+    diag.push_back(MakeDiagTlv(OT_NETWORK_DIAGNOSTIC_TLV_ROUTE));
+    diag.push_back(MakeDiagTlv(OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA));
+    diag.push_back(MakeDiagTlv(OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS));
+
+    tlv                              = MakeDiagTlv(OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA);
+    tlv.mData.mNetworkData.mCount = 64;
+    diag.push_back(tlv);
+
+    tlv                           = MakeDiagTlv(OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST);
+    tlv.mData.mIp6AddrList.mCount = 4;
+    diag.push_back(tlv);
+
+    tlv                          = MakeDiagTlv(OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE);
+    tlv.mData.mChildTable.mCount = 10;
+    diag.push_back(tlv);
+
+    return diag;
+}
+
+static void BM_Diag2JsonString(benchmark::State &aState)
+{
+    std::vector<std::vector<otNetworkDiagTlv>> diagSet;
+
+    for (int64_t i = 0; i < aState.range(0); i++)
+    {
+        diagSet.push_back(MakeRouterDiag(static_cast<uint16_t>(i << 10)));
+    }
+
+    for (auto _ : aState)
+    {
+        std::string json = otbr::rest::Json::Diag2JsonString(diagSet);
+
+        benchmark::DoNotOptimize(json);
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+BENCHMARK(BM_Diag2JsonString)->Arg(1)->Arg(16)->Arg(64);
+
+static void BM_ResponseSerialize(benchmark::State &aState)
+{
+    otbr::rest::Response response;
+    std::string          code = "200 OK";
+    std::string          body(static_cast<size_t>(aState.range(0)), 'x');
+
+    response.SetResponsCode(code);
+    response.SetBody(body);
+
+    for (auto _ : aState)
+    {
+        std::string serialized = response.Serialize();
+
+        benchmark::DoNotOptimize(serialized);
+    }
+
+    aState.SetBytesProcessed(aState.iterations() * aState.range(0));
+}
+BENCHMARK(BM_ResponseSerialize)->Arg(16)->Arg(1024)->Arg(65536);
@@ -0,0 +1,165 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "utils/crc16.hpp"
+#include "utils/hex.hpp"
+#include "utils/pskc.hpp"
+#include "utils/steering_data.hpp"
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+static std::vector<uint8_t> MakeBytes(size_t aLength)
+{
+    std::vector<uint8_t> bytes(aLength);
+
+    for (size_t i = 0; i < aLength; i++)
+    {
+        bytes[i] = static_cast<uint8_t>(i * 7 + 3);
+    }
+
+    return bytes;
+}
+
+static void BM_Bytes2Hex(benchmark::State &aState)
+{
+    std::vector<uint8_t> bytes = MakeBytes(static_cast<size_t>(aState.range(0)));
+    std::vector<char>    hex(bytes.size() * 2 + 1);
+
+    for (auto _ : aState)
+    {
+        otbrError error = otbr::Utils::Bytes2Hex(bytes.data(), bytes.size(), hex.data(), hex.size());
+
+        benchmark::DoNotOptimize(error);
+    }
+
+    aState.SetBytesProcessed(aState.iterations() * aState.range(0));
+}
+BENCHMARK(BM_Bytes2Hex)->Arg(8)->Arg(64)->Arg(1024);
+
+static void BM_Hex2Bytes(benchmark::State &aState)
+{
+    std::vector<uint8_t> bytes = MakeBytes(static_cast<size_t>(aState.range(0)));
+    std::vector<char>    hex(bytes.size() * 2 + 1);
+    size_t               length;
+
+    otbr::Utils::Bytes2Hex(bytes.data(), bytes.size(), hex.data(), hex.size());
+
+    for (auto _ : aState)
+    {
+        otbrError error = otbr::Utils::Hex2Bytes(hex.data(), hex.size() - 1, bytes.data(), bytes.size(), length);
+
+        benchmark::DoNotOptimize(error);
+    }
+
+    aState.SetBytesProcessed(aState.iterations() * aState.range(0));
+}
+BENCHMARK(BM_Hex2Bytes)->Arg(8)->Arg(64)->Arg(1024);
+
+static void BM_Crc16(benchmark::State &aState)
+{
+    std::vector<uint8_t> bytes = MakeBytes(static_cast<size_t>(aState.range(0)));
+    otbr::Crc16          crc(otbr::Crc16::kCcitt);
+
+    for (auto _ : aState)
+    {
+        crc.Init();
+        crc.Update(bytes.data(), bytes.size());
+        benchmark::DoNotOptimize(crc.Get());
+    }
+
+    aState.SetBytesProcessed(aState.iterations() * aState.range(0));
+}
+BENCHMARK(BM_Crc16)->Arg(16)->Arg(256)->Arg(4096);
+
+static void BM_SteeringDataComputeBloomFilter(benchmark::State &aState)
+{
+    const size_t         count  = static_cast<size_t>(aState.range(0));
+    std::vector<uint8_t> eui64s = MakeBytes(count * 8);
+    std::vector<uint8_t> joinerIds(count * 8);
+    otbr::SteeringData   steeringData;
+
+    otbr::SteeringData::ComputeJoinerIds(eui64s.data(), joinerIds.data(), count);
+
+    for (auto _ : aState)
+    {
+        steeringData.Init(16);
+        steeringData.ComputeBloomFilter(joinerIds.data(), count);
+        benchmark::DoNotOptimize(steeringData.GetBloomFilter());
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+BENCHMARK(BM_SteeringDataComputeBloomFilter)->Arg(1)->Arg(32)->Arg(1024);
+
+static void BM_SteeringDataComputeJoinerIds(benchmark::State &aState)
+{
+    const size_t         count  = static_cast<size_t>(aState.range(0));
+    std::vector<uint8_t> eui64s = MakeBytes(count * 8);
+    std::vector<uint8_t> joinerIds(count * 8);
+
+    for (auto _ : aState)
+    {
+        otbr::SteeringData::ComputeJoinerIds(eui64s.data(), joinerIds.data(), count);
+        benchmark::DoNotOptimize(joinerIds.data());
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+BENCHMARK(BM_SteeringDataComputeJoinerIds)->Arg(1)->Arg(32)->Arg(1024);
+
+static void BM_SteeringDataFindOptimalLength(benchmark::State &aState)
+{
+    const size_t         count  = static_cast<size_t>(aState.range(0));
+    std::vector<uint8_t> eui64s = MakeBytes(count * 8);
+    std::vector<uint8_t> joinerIds(count * 8);
+
+    otbr::SteeringData::ComputeJoinerIds(eui64s.data(), joinerIds.data(), count);
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(otbr::SteeringData::FindOptimalLength(joinerIds.data(), count, 0.01));
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+BENCHMARK(BM_SteeringDataFindOptimalLength)->Arg(8)->Arg(128);
+
+static void BM_ComputePskc(benchmark::State &aState)
+{
+    const uint8_t   extPanId[] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07};
+    otbr::Psk::Pskc pskc;
+
+    // PBKDF2 with OT_ITERATION_COUNTS rounds, this is expected to be slow.
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(pskc.ComputePskc(extPanId, "OpenThread", "J01NME"));
+    }
+}
+BENCHMARK(BM_ComputePskc);
@@ -76,8 +76,9 @@ static bool operator==(const otbr::DBus::Ip6Prefix &aLhs, const otbr::DBus::Ip6P
 
 static void CheckExternalRoute(ThreadApiDBus *aApi, const Ip6Prefix &aPrefix)
 {
-    ExternalRoute              route;
-    std::vector<ExternalRoute> externalRouteTable;
+    ExternalRoute                              route;
+    std::vector<ExternalRoute>                 externalRouteTable;
+    std::array<uint8_t, OTBR_IP6_ADDRESS_SIZE> address = {};
 
     route.mPrefix     = aPrefix;
     route.mStable     = true;
@@ -90,7 +91,50 @@ static void CheckExternalRoute(ThreadApiDBus *aApi, const Ip6Prefix &aPrefix)
     TEST_ASSERT(externalRouteTable[0].mPreference == 0);
     TEST_ASSERT(externalRouteTable[0].mStable);
     TEST_ASSERT(externalRouteTable[0].mNextHopIsThisDevice);
+
+    std::copy(aPrefix.mPrefix.begin(), aPrefix.mPrefix.end(), address.begin());
+    address[OTBR_IP6_ADDRESS_SIZE - 1] = 1;
+    TEST_ASSERT(aApi->LookupRoute(address, route) == ClientError::ERROR_NONE);
+    TEST_ASSERT(route.mPrefix == aPrefix);
+
     TEST_ASSERT(aApi->RemoveExternalRoute(aPrefix) == OTBR_ERROR_NONE);
+    TEST_ASSERT(aApi->LookupRoute(address, route) == ClientError::OT_ERROR_NOT_FOUND);
+}
+
+static void CheckUpdateNetworkData(ThreadApiDBus *aApi, const OnMeshPrefix &aOnMeshPrefix)
+{
+    ExternalRoute              route = {};
+    std::vector<ClientError>   results;
+    std::vector<OnMeshPrefix>  onMeshPrefixes;
+    std::vector<ExternalRoute> externalRoutes;
+
+    route.mPrefix = aOnMeshPrefix.mPrefix;
+    route.mStable = true;
+
+    TEST_ASSERT(aApi->UpdateNetworkData({aOnMeshPrefix}, {}, {route}, {}, results) == ClientError::ERROR_NONE);
+    TEST_ASSERT(results.size() == 2);
+    TEST_ASSERT(results[0] == ClientError::ERROR_NONE && results[1] == ClientError::ERROR_NONE);
+    TEST_ASSERT(aApi->GetOnMeshPrefixes(onMeshPrefixes) == ClientError::ERROR_NONE);
+    TEST_ASSERT(onMeshPrefixes.size() == 1);
+    TEST_ASSERT(aApi->GetExternalRoutes(externalRoutes) == ClientError::ERROR_NONE);
+    TEST_ASSERT(externalRoutes.size() == 1);
+
+    // Removing the external route twice fails, so the removal of the on-mesh prefix is rolled back too.
+    TEST_ASSERT(aApi->UpdateNetworkData({}, {aOnMeshPrefix.mPrefix}, {}, {route.mPrefix, route.mPrefix}, results) ==
+                ClientError::ERROR_NONE);
+    TEST_ASSERT(results.size() == 3);
+    TEST_ASSERT(results[0] == ClientError::OT_ERROR_ABORT);
+    TEST_ASSERT(results[1] == ClientError::OT_ERROR_ABORT);
+    TEST_ASSERT(results[2] == ClientError::OT_ERROR_NOT_FOUND);
+    TEST_ASSERT(aApi->GetOnMeshPrefixes(onMeshPrefixes) == ClientError::ERROR_NONE);
+    TEST_ASSERT(onMeshPrefixes.size() == 1);
+
+    TEST_ASSERT(aApi->UpdateNetworkData({}, {aOnMeshPrefix.mPrefix}, {}, {route.mPrefix}, results) ==
+                ClientError::ERROR_NONE);
+    TEST_ASSERT(aApi->GetOnMeshPrefixes(onMeshPrefixes) == ClientError::ERROR_NONE);
+    TEST_ASSERT(onMeshPrefixes.empty());
+    TEST_ASSERT(aApi->GetExternalRoutes(externalRoutes) == ClientError::ERROR_NONE);
+    TEST_ASSERT(externalRoutes.empty());
 }
 
 int main()
@@ -216,7 +260,15 @@ int main()
 
                             CheckExternalRoute(api.get(), prefix);
                             TEST_ASSERT(api->AddOnMeshPrefix(onMeshPrefix) == OTBR_ERROR_NONE);
+                            {
+                                std::vector<OnMeshPrefix> onMeshPrefixes;
+
+                                TEST_ASSERT(api->GetOnMeshPrefixes(onMeshPrefixes) == ClientError::ERROR_NONE);
+                                TEST_ASSERT(onMeshPrefixes.size() == 1);
+                                TEST_ASSERT(onMeshPrefixes[0].mPrefix == prefix);
+                            }
                             TEST_ASSERT(api->RemoveOnMeshPrefix(onMeshPrefix.mPrefix) == OTBR_ERROR_NONE);
+                            CheckUpdateNetworkData(api.get(), onMeshPrefix);
 
                             api->FactoryReset(nullptr);
                             TEST_ASSERT(api->JoinerStart("ABCDEF", "", "", "", "", "", nullptr) ==
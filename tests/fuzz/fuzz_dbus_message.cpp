@@ -0,0 +1,90 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dbus/common/dbus_message_helper.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+using otbr::DBus::DBusMessageExtractFromVariant;
+using otbr::DBus::DBusMessageToTuple;
+using otbr::DBus::UniqueDBusMessage;
+
+template <typename... FieldTypes> static void DecodeArgs(DBusMessage &aMessage)
+{
+    std::tuple<FieldTypes...> args;
+
+    DBusMessageToTuple(aMessage, args);
+}
+
+template <typename ValueType> static void DecodeProperty(DBusMessage &aMessage)
+{
+    DBusMessageIter iter;
+    ValueType       value;
+
+    // org.freedesktop.DBus.Properties.Set carries the interface name, the property name and a variant.
+    if (dbus_message_iter_init(&aMessage, &iter) && dbus_message_iter_next(&iter) && dbus_message_iter_next(&iter))
+    {
+        DBusMessageExtractFromVariant(&iter, value);
+    }
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *aData, size_t aSize)
+{
+    const char *      buf = reinterpret_cast<const char *>(aData);
+    DBusError         error;
+    UniqueDBusMessage message;
+
+    dbus_error_init(&error);
+
+    VerifyOrExit(dbus_message_demarshal_bytes_needed(buf, static_cast<int>(aSize)) > 0);
+
+    message = UniqueDBusMessage(dbus_message_demarshal(buf, static_cast<int>(aSize), &error));
+    VerifyOrExit(message != nullptr);
+
+    // The argument lists of the methods of the Thread object.
+    DecodeArgs<std::vector<uint8_t>, uint16_t, std::string, uint64_t, std::vector<uint8_t>, uint32_t>(*message);
+    DecodeArgs<std::string, std::string, std::string, std::string, std::string, std::string>(*message);
+    DecodeArgs<uint16_t, uint32_t>(*message);
+    DecodeArgs<otbr::DBus::OnMeshPrefix>(*message);
+    DecodeArgs<otbr::DBus::Ip6Prefix>(*message);
+    DecodeArgs<otbr::DBus::ExternalRoute>(*message);
+    DecodeArgs<std::string>(*message);
+
+    DecodeProperty<otbr::DBus::LinkModeConfig>(*message);
+    DecodeProperty<std::vector<uint8_t>>(*message);
+    DecodeProperty<std::string>(*message);
+
+exit:
+    dbus_error_free(&error);
+    return 0;
+}
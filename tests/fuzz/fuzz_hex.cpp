@@ -0,0 +1,73 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "utils/hex.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *aData, size_t aSize)
+{
+    const char *hex = reinterpret_cast<const char *>(aData);
+    uint8_t     bytes[128];
+    uint8_t     decoded[sizeof(bytes)];
+    char        encoded[sizeof(bytes) * 2 + 1];
+    size_t      length;
+    size_t      decodedLength;
+
+    // The NUL-terminated flavor must agree with the length-delimited one.
+    {
+        std::string str(hex, aSize);
+        int         ret = otbr::Utils::Hex2Bytes(str.c_str(), bytes, sizeof(bytes));
+
+        if (ret >= 0 && strlen(str.c_str()) == aSize &&
+            otbr::Utils::Hex2Bytes(hex, aSize, decoded, sizeof(decoded), decodedLength) != OTBR_ERROR_NONE)
+        {
+            abort();
+        }
+    }
+
+    if (otbr::Utils::Hex2Bytes(hex, aSize, bytes, sizeof(bytes), length) != OTBR_ERROR_NONE)
+    {
+        return 0;
+    }
+
+    // Decoding the encoded bytes must give them back.
+    if (otbr::Utils::Bytes2Hex(bytes, length, encoded, sizeof(encoded)) != OTBR_ERROR_NONE ||
+        otbr::Utils::Hex2Bytes(encoded, strlen(encoded), decoded, sizeof(decoded), decodedLength) != OTBR_ERROR_NONE ||
+        decodedLength != length || memcmp(bytes, decoded, length) != 0)
+    {
+        abort();
+    }
+
+    return 0;
+}
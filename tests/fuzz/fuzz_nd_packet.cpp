@@ -1,5 +1,5 @@
 /*
- *    Copyright (c) 2020, The OpenThread Authors.
+ *    Copyright (c) 2021, The OpenThread Authors.
  *    All rights reserved.
  *
  *    Redistribution and use in source and binary forms, with or without
@@ -26,20 +26,20 @@
  *    POSSIBILITY OF SUCH DAMAGE.
  */
 
-/**
- * @file
- *   The file implements the agent instance parameters.
- */
-
-#include "agent/instance_params.hpp"
+#include "backbone_router/nd_packet.hpp"
 
-namespace otbr {
+#include <stddef.h>
+#include <stdint.h>
 
-InstanceParams &InstanceParams::Get(void)
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *aData, size_t aSize)
 {
-    static InstanceParams sInstanceParams;
+    otbr::BackboneRouter::NeighborSolicitInfo info;
 
-    return sInstanceParams;
-}
+    if (otbr::BackboneRouter::ParseNeighborSolicitation(aData, aSize, info) == OTBR_ERROR_NONE)
+    {
+        info.mTarget.ToSolicitedNodeMulticastAddress();
+        info.mSource.ToString();
+    }
 
-} // namespace otbr
+    return 0;
+}
@@ -0,0 +1,72 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/tlv.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *aData, size_t aSize)
+{
+    otbr::TlvReader reader(aData, aSize);
+    otbr::TlvInfo   tlv;
+    uint64_t        value64;
+    uint32_t        value32;
+    uint16_t        value16;
+    uint8_t         value8;
+    size_t          total = 0;
+
+    for (const otbr::TlvInfo &info : reader)
+    {
+        // Every TLV exposed by the reader must lie within the buffer.
+        if (info.GetValue() < aData || info.GetValue() + info.GetLength() > aData + aSize)
+        {
+            abort();
+        }
+
+        total++;
+    }
+
+    if (reader.Validate() == OTBR_ERROR_NONE && total == 0 && aSize != 0)
+    {
+        abort();
+    }
+
+    for (uint16_t type = 0; type <= 0xff; type++)
+    {
+        reader.Find(static_cast<uint8_t>(type), tlv);
+    }
+
+    reader.FindUint8(otbr::Meshcop::kChannel, value8);
+    reader.FindUint16(otbr::Meshcop::kPanId, value16);
+    reader.FindUint32(otbr::Meshcop::kChannelMask, value32);
+    reader.FindUint64(otbr::Meshcop::kActiveTimestamp, value64);
+
+    return 0;
+}
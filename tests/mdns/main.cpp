@@ -234,6 +234,22 @@ exit:
     return error;
 }
 
+otbrError TestRenameSingleServiceWithCustomHost(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    Mdns::Publisher *pub =
+        Mdns::Publisher::Create(AF_UNSPEC, /* aDomain */ nullptr, PublishSingleServiceWithCustomHost, &sContext);
+    sContext.mPublisher = pub;
+    pub->SetConflictPolicy(Mdns::Publisher::ConflictPolicy::kRename);
+    SuccessOrExit(error = pub->Start());
+    Mainloop(*pub);
+
+exit:
+    Mdns::Publisher::Destroy(pub);
+    return error;
+}
+
 otbrError TestMultipleServicesWithCustomHost(void)
 {
     otbrError error = OTBR_ERROR_NONE;
@@ -349,6 +365,10 @@ int main(int argc, char *argv[])
         ret = argv[1][1] == 'c' ? TestMultipleServicesWithCustomHost() : TestMultipleServices();
         break;
 
+    case 'r':
+        ret = TestRenameSingleServiceWithCustomHost();
+        break;
+
     case 'u':
         ret = TestUpdateService();
         break;
@@ -0,0 +1,644 @@
+#!/usr/bin/env python3
+#
+#  Copyright (c) 2021, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+"""Drive scripted load against a running otbr-agent and write a JSON report.
+
+Each scenario runs for a fixed duration while the CPU time and RSS of the agent are sampled. Scenarios whose
+prerequisites are missing are reported as skipped rather than failed.
+"""
+
+import argparse
+import json
+import os
+import random
+import re
+import select
+import socket
+import struct
+import subprocess
+import threading
+import time
+import urllib.error
+import urllib.request
+
+REST_PATHS = ["/node/state", "/node/rloc16", "/node/network-name", "/node/leader-data", "/node"]
+DBUS_PROPERTIES = ["DeviceRole", "Rloc16", "NetworkName", "LeaderData"]
+SRP_SERVICE_TYPE = "_perf._udp"
+SAMPLE_INTERVAL = 0.1
+
+
+def percentiles(samples):
+    """Returns nearest-rank percentiles of latency samples in milliseconds."""
+    if not samples:
+        return None
+
+    ordered = sorted(samples)
+
+    def rank(p):
+        return round(ordered[min(len(ordered) - 1, int(p / 100.0 * len(ordered)))] * 1000, 3)
+
+    return {"p50": rank(50), "p90": rank(90), "p99": rank(99), "max": round(ordered[-1] * 1000, 3)}
+
+
+class ProcessSampler(threading.Thread):
+    """Samples the CPU time and RSS of a process in the background."""
+
+    def __init__(self, pid):
+        super().__init__(daemon=True)
+        self._pid = pid
+        self._ticks = os.sysconf("SC_CLK_TCK")
+        self._lock = threading.Lock()
+        self._samples = []
+        self._stopped = threading.Event()
+
+    def _read(self):
+        with open("/proc/%d/stat" % self._pid) as f:
+            # The command name may contain spaces, the fields after it are fixed.
+            fields = f.read().rsplit(")", 1)[1].split()
+        cpu = (int(fields[11]) + int(fields[12])) / self._ticks
+
+        rss = 0
+        with open("/proc/%d/status" % self._pid) as f:
+            for line in f:
+                if line.startswith("VmRSS:"):
+                    rss = int(line.split()[1])
+
+        return time.monotonic(), cpu, rss
+
+    def run(self):
+        while not self._stopped.wait(SAMPLE_INTERVAL):
+            sample = self._read()
+            with self._lock:
+                self._samples.append(sample)
+
+    def stop(self):
+        self._stopped.set()
+
+    def mark(self):
+        with self._lock:
+            return len(self._samples)
+
+    def summary(self, start):
+        """Summarizes the samples taken since `start`, a value returned by `mark()`."""
+        with self._lock:
+            window = self._samples[max(0, start - 1):]
+
+        if len(window) < 2:
+            return None
+
+        usage = []
+        for prev, cur in zip(window, window[1:]):
+            usage.append((cur[1] - prev[1]) / (cur[0] - prev[0]) * 100)
+
+        elapsed = window[-1][0] - window[0][0]
+        rss = [sample[2] for sample in window]
+
+        return {
+            "cpu_percent": {
+                "avg": round((window[-1][1] - window[0][1]) / elapsed * 100, 2),
+                "max": round(max(usage), 2),
+            },
+            "rss_kb": {
+                "avg": int(sum(rss) / len(rss)),
+                "max": max(rss),
+            },
+        }
+
+
+class Metrics(object):
+    """Reads the Prometheus metrics exposed by the REST server."""
+
+    def __init__(self, rest_url):
+        self._url = rest_url + "/metrics"
+
+    def read(self):
+        values = {}
+        body = urllib.request.urlopen(self._url, timeout=5).read().decode()
+
+        for line in body.splitlines():
+            if line.startswith("#") or not line.strip():
+                continue
+            name, value = line.rsplit(" ", 1)
+            values[name] = float(value)
+
+        return values
+
+    @staticmethod
+    def histogram_delta(before, after, name):
+        """Returns the count and bucket percentiles, in milliseconds, of a histogram between two reads."""
+        buckets = []
+        pattern = re.compile(r'^%s_bucket\{le="([^"]+)"\}$' % re.escape(name))
+
+        for key, value in after.items():
+            match = pattern.match(key)
+            if match:
+                bound = float("inf") if match.group(1) == "+Inf" else float(match.group(1))
+                buckets.append((bound, value - before.get(key, 0)))
+
+        buckets.sort()
+        count = after.get(name + "_count", 0) - before.get(name + "_count", 0)
+        result = {"count": int(count)}
+
+        if count > 0:
+            for p in (50, 90, 99):
+                for bound, cumulative in buckets:
+                    if cumulative >= count * p / 100.0:
+                        result["p%d_upper_bound_ms" % p] = None if bound == float("inf") else bound * 1000
+                        break
+
+        return result
+
+
+class Scenario(object):
+    """The base of a load scenario."""
+
+    name = None
+
+    def __init__(self, args):
+        self.args = args
+
+    def prepare(self):
+        """Returns the reason to skip the scenario, or None to run it."""
+        return None
+
+    def run(self, deadline):
+        raise NotImplementedError
+
+    def cleanup(self):
+        pass
+
+
+class RestScenario(Scenario):
+    """Issues REST requests from several threads at a target total rate."""
+
+    name = "rest"
+
+    def run(self, deadline):
+        latencies = []
+        errors = [0]
+        lock = threading.Lock()
+        interval = self.args.rest_threads / self.args.rest_rate if self.args.rest_rate > 0 else 0
+
+        def worker(index):
+            next_time = time.monotonic()
+            i = index
+
+            while time.monotonic() < deadline:
+                start = time.monotonic()
+                try:
+                    urllib.request.urlopen(self.args.rest_url + REST_PATHS[i % len(REST_PATHS)], timeout=5).read()
+                    with lock:
+                        latencies.append(time.monotonic() - start)
+                except (urllib.error.URLError, socket.timeout, ConnectionError):
+                    with lock:
+                        errors[0] += 1
+                i += 1
+
+                if interval > 0:
+                    next_time += interval
+                    time.sleep(max(0, next_time - time.monotonic()))
+
+        start = time.monotonic()
+        threads = [threading.Thread(target=worker, args=(i,)) for i in range(self.args.rest_threads)]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+        elapsed = time.monotonic() - start
+
+        return {
+            "requests": len(latencies),
+            "errors": errors[0],
+            "throughput_rps": round(len(latencies) / elapsed, 2),
+            "latency_ms": percentiles(latencies),
+        }
+
+
+class DBusScenario(Scenario):
+    """Polls D-Bus properties of the agent as fast as one client can."""
+
+    name = "dbus"
+
+    def prepare(self):
+        try:
+            import dbus
+        except ImportError:
+            return "python3-dbus is not installed"
+
+        bus = dbus.SystemBus()
+        service = "io.openthread.BorderRouter." + self.args.thread_ifname
+        if not bus.name_has_owner(service):
+            return "%s is not on the system bus" % service
+
+        self._interface = dbus.Interface(
+            bus.get_object(service, "/io/openthread/BorderRouter/" + self.args.thread_ifname),
+            "org.freedesktop.DBus.Properties")
+        self._exception = dbus.exceptions.DBusException
+        return None
+
+    def run(self, deadline):
+        latencies = []
+        errors = 0
+        i = 0
+        start = time.monotonic()
+
+        while time.monotonic() < deadline:
+            call_start = time.monotonic()
+            try:
+                self._interface.Get("io.openthread.BorderRouter", DBUS_PROPERTIES[i % len(DBUS_PROPERTIES)])
+                latencies.append(time.monotonic() - call_start)
+            except self._exception:
+                errors += 1
+            i += 1
+
+        return {
+            "calls": len(latencies),
+            "errors": errors,
+            "throughput_cps": round(len(latencies) / (time.monotonic() - start), 2),
+            "latency_ms": percentiles(latencies),
+        }
+
+
+class CliNode(object):
+    """A simulated Thread node driven through the OpenThread CLI."""
+
+    def __init__(self, path, node_id):
+        self._proc = subprocess.Popen([path, str(node_id)],
+                                      stdin=subprocess.PIPE,
+                                      stdout=subprocess.PIPE,
+                                      stderr=subprocess.STDOUT,
+                                      bufsize=0)
+        self._buffer = b""
+
+    def _read_line(self, deadline):
+        while b"\n" not in self._buffer:
+            remaining = deadline - time.monotonic()
+            if remaining <= 0 or not select.select([self._proc.stdout], [], [], remaining)[0]:
+                raise TimeoutError("CLI node did not respond")
+            data = os.read(self._proc.stdout.fileno(), 4096)
+            if not data:
+                raise EOFError("CLI node exited")
+            self._buffer += data
+
+        line, self._buffer = self._buffer.split(b"\n", 1)
+        return line.decode(errors="replace").strip().lstrip("> ")
+
+    def command(self, cmd, timeout=10):
+        """Runs a CLI command and returns its output lines."""
+        deadline = time.monotonic() + timeout
+        lines = []
+
+        self._proc.stdin.write((cmd + "\n").encode())
+
+        while True:
+            line = self._read_line(deadline)
+            if line == "Done":
+                return lines
+            if line.startswith("Error"):
+                raise RuntimeError("%s: %s" % (cmd, line))
+            if line and line != cmd:
+                lines.append(line)
+
+    def wait_attached(self, timeout=60):
+        deadline = time.monotonic() + timeout
+        while time.monotonic() < deadline:
+            if self.command("state")[0] in ("child", "router", "leader"):
+                return
+            time.sleep(1)
+        raise TimeoutError("CLI node did not attach")
+
+    def service_state(self, instance):
+        for line in self.command("srp client service"):
+            if 'instance:"%s"' % instance in line:
+                return re.search(r"state:(\w+)", line).group(1)
+        return None
+
+    def close(self):
+        self._proc.kill()
+        self._proc.wait()
+
+
+class SrpScenario(Scenario):
+    """Registers and removes SRP services from simulated nodes, end to end through the Advertising Proxy."""
+
+    name = "srp"
+
+    def prepare(self):
+        if not self.args.ot_cli or not self.args.dataset:
+            return "no ot-cli-ftd or active dataset"
+
+        self._nodes = []
+        for i in range(self.args.srp_clients):
+            node = CliNode(self.args.ot_cli, self.args.srp_first_node_id + i)
+            self._nodes.append(node)
+            node.command("dataset set active " + self.args.dataset)
+            node.command("ifconfig up")
+            node.command("thread start")
+
+        for i, node in enumerate(self._nodes):
+            node.wait_attached()
+            node.command("srp client host name perf-host-%d" % i)
+            node.command("srp client host address " + node.command("ipaddr mleid")[0])
+            node.command("srp client autostart enable")
+
+        return None
+
+    def _wait_state(self, node, instance, states, deadline):
+        while time.monotonic() < deadline:
+            if node.service_state(instance) in states:
+                return True
+            time.sleep(0.01)
+        return False
+
+    def run(self, deadline):
+        latencies = []
+        errors = [0]
+        lock = threading.Lock()
+
+        def worker(index, node):
+            i = 0
+            while time.monotonic() < deadline:
+                instance = "perf-%d-%d" % (index, i)
+                start = time.monotonic()
+
+                node.command("srp client service add %s %s %d" % (instance, SRP_SERVICE_TYPE, 10000 + i % 1000))
+                registered = self._wait_state(node, instance, ("Registered",), start + 30)
+                with lock:
+                    if registered:
+                        latencies.append(time.monotonic() - start)
+                    else:
+                        errors[0] += 1
+
+                node.command("srp client service remove %s %s" % (instance, SRP_SERVICE_TYPE))
+                self._wait_state(node, instance, ("Removed", None), time.monotonic() + 30)
+                node.command("srp client service clear %s %s" % (instance, SRP_SERVICE_TYPE))
+                i += 1
+
+        metrics = Metrics(self.args.rest_url)
+        before = metrics.read()
+        start = time.monotonic()
+        threads = [threading.Thread(target=worker, args=(i, node)) for i, node in enumerate(self._nodes)]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+        elapsed = time.monotonic() - start
+        after = metrics.read()
+
+        return {
+            "registrations": len(latencies),
+            "errors": errors[0],
+            "throughput_rps": round(len(latencies) / elapsed, 2),
+            "client_latency_ms": percentiles(latencies),
+            "proxy_updates": int(after.get("otbr_srp_updates_total", 0) - before.get("otbr_srp_updates_total", 0)),
+            "proxy_publish": Metrics.histogram_delta(before, after, "otbr_mdns_publish_duration_seconds"),
+        }
+
+    def cleanup(self):
+        for node in getattr(self, "_nodes", []):
+            node.close()
+
+
+class NsFloodScenario(Scenario):
+    """Floods Neighbor Solicitations for addresses of the domain prefix on the backbone link.
+
+    Most targets are random and must not be answered. Every tenth target is the Domain Unicast Address of a simulated
+    node, which the ND proxy of the agent must answer with a Neighbor Advertisement.
+    """
+
+    name = "ns_flood"
+
+    PROXIED_INTERVAL = 10
+
+    def prepare(self):
+        if not self.args.flood_ifname:
+            return "no flood interface"
+        if not self.args.ot_cli or not self.args.dataset:
+            return "no ot-cli-ftd or active dataset"
+
+        self._ifindex = socket.if_nametoindex(self.args.flood_ifname)
+        self._sock = socket.socket(socket.AF_INET6, socket.SOCK_RAW, socket.IPPROTO_ICMPV6)
+        self._sock.setsockopt(socket.SOL_SOCKET, socket.SO_BINDTODEVICE, self.args.flood_ifname.encode())
+        self._sock.setsockopt(socket.IPPROTO_IPV6, socket.IPV6_MULTICAST_IF, self._ifindex)
+        self._sock.setsockopt(socket.IPPROTO_IPV6, socket.IPV6_MULTICAST_HOPS, 255)
+        self._sock.setsockopt(socket.IPPROTO_IPV6, socket.IPV6_UNICAST_HOPS, 255)
+        self._sock.setsockopt(socket.IPPROTO_IPV6, socket.IPV6_MULTICAST_LOOP, 0)
+        self._sock.setblocking(False)
+
+        with open("/sys/class/net/%s/address" % self.args.flood_ifname) as f:
+            self._mac = bytes.fromhex(f.read().strip().replace(":", ""))
+
+        self._prefix = socket.inet_pton(socket.AF_INET6, self.args.ns_prefix)[:8]
+
+        # The node registers its Domain Unicast Address with the Backbone Router, which makes the agent proxy it.
+        self._node = CliNode(self.args.ot_cli, self.args.srp_first_node_id + self.args.srp_clients)
+        self._node.command("dataset set active " + self.args.dataset)
+        self._node.command("ifconfig up")
+        self._node.command("thread start")
+        self._node.wait_attached()
+        self._dua = self._wait_dua(time.monotonic() + 60)
+
+        if not self._wait_answered(self._dua, time.monotonic() + 60):
+            raise TimeoutError("the ND proxy did not answer for the DUA")
+
+        return None
+
+    def _wait_dua(self, deadline):
+        while time.monotonic() < deadline:
+            for line in self._node.command("ipaddr"):
+                address = socket.inet_pton(socket.AF_INET6, line)
+                if address[:8] == self._prefix:
+                    return address
+            time.sleep(1)
+        raise TimeoutError("the node did not get a DUA")
+
+    def _send_ns(self, target):
+        group = bytes.fromhex("ff020000000000000000000001ff") + target[13:]
+        # The kernel fills in the ICMPv6 checksum of raw ICMPv6 sockets.
+        packet = struct.pack("!BBHI", 135, 0, 0, 0) + target + struct.pack("!BB", 1, 1) + self._mac
+        self._sock.sendto(packet, (socket.inet_ntop(socket.AF_INET6, group), 0, 0, self._ifindex))
+
+    def _receive_na(self, timeout):
+        """Returns the targets of the Neighbor Advertisements received within `timeout` seconds."""
+        targets = []
+
+        if select.select([self._sock], [], [], max(0, timeout))[0]:
+            while True:
+                try:
+                    data = self._sock.recv(1500)
+                except BlockingIOError:
+                    break
+                if len(data) >= 24 and data[0] == 136:
+                    targets.append(data[8:24])
+
+        return targets
+
+    def _wait_answered(self, target, deadline):
+        while time.monotonic() < deadline:
+            self._send_ns(target)
+            if target in self._receive_na(1):
+                return True
+        return False
+
+    def run(self, deadline):
+        interval = 1.0 / self.args.ns_rate
+        sent = 0
+        proxied_sent = 0
+        answered = {"proxied": 0, "unproxied": 0}
+        errors = 0
+        metrics = Metrics(self.args.rest_url)
+        before = metrics.read()
+        next_time = time.monotonic()
+        start = next_time
+
+        def receive_until(end):
+            while True:
+                remaining = end - time.monotonic()
+                for target in self._receive_na(remaining):
+                    answered["proxied" if target == self._dua else "unproxied"] += 1
+                if remaining <= 0:
+                    break
+
+        while time.monotonic() < deadline:
+            if (sent + errors) % self.PROXIED_INTERVAL == 0:
+                target = self._dua
+                proxied_sent += 1
+            else:
+                target = self._prefix + random.getrandbits(64).to_bytes(8, "big")
+
+            try:
+                self._send_ns(target)
+                sent += 1
+            except OSError:
+                errors += 1
+
+            next_time += interval
+            receive_until(next_time)
+
+        # Collects the answers still in flight.
+        receive_until(time.monotonic() + 1)
+
+        elapsed = time.monotonic() - start
+        after = metrics.read()
+
+        # Only the DUA may be answered, and the proxy must keep answering it under load.
+        errors += answered["unproxied"]
+        if answered["proxied"] == 0:
+            errors += 1
+
+        return {
+            "sent": sent,
+            "errors": errors,
+            "rate_pps": round(sent / elapsed, 2),
+            "proxied_sent": proxied_sent,
+            "proxied_answered": answered["proxied"],
+            "unproxied_answered": answered["unproxied"],
+            "proxy_ns_handled": int(
+                after.get("otbr_ndproxy_ns_handled_total", 0) - before.get("otbr_ndproxy_ns_handled_total", 0)),
+        }
+
+    def cleanup(self):
+        if hasattr(self, "_node"):
+            self._node.close()
+        if hasattr(self, "_sock"):
+            self._sock.close()
+
+
+SCENARIOS = [RestScenario, DBusScenario, SrpScenario, NsFloodScenario]
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--agent-pid", type=int, required=True, help="The process ID of otbr-agent.")
+    parser.add_argument("--rest-url", default="http://127.0.0.1:8081", help="The base URL of the REST server.")
+    parser.add_argument("--thread-ifname", default="wpan0", help="The Thread interface of the agent.")
+    parser.add_argument("--flood-ifname", help="The peer of the agent backbone interface to flood NS on.")
+    parser.add_argument("--ns-prefix", default="fd00:7d03:7d03:7d03::", help="The domain prefix of the NS targets.")
+    parser.add_argument("--ns-rate", type=float, default=2000, help="NS packets per second.")
+    parser.add_argument("--dataset", help="The active operational dataset in hex, for the SRP clients.")
+    parser.add_argument("--ot-cli", help="The path of the simulated ot-cli-ftd.")
+    parser.add_argument("--srp-clients", type=int, default=2, help="The number of simulated SRP clients.")
+    parser.add_argument("--srp-first-node-id", type=int, default=2, help="The node ID of the first SRP client.")
+    parser.add_argument("--rest-threads", type=int, default=4, help="The number of REST client threads.")
+    parser.add_argument("--rest-rate", type=float, default=0, help="REST requests per second, 0 for no limit.")
+    parser.add_argument("--duration", type=float, default=20, help="The duration of each scenario in seconds.")
+    parser.add_argument("--scenarios", default=",".join(s.name for s in SCENARIOS), help="Scenarios to run.")
+    parser.add_argument("--report", default="perf-report.json", help="The path of the JSON report.")
+    return parser.parse_args()
+
+
+def main():
+    args = parse_args()
+    names = args.scenarios.split(",")
+    sampler = ProcessSampler(args.agent_pid)
+    report = {
+        "version": 1,
+        "config": vars(args),
+        "idle": None,
+        "scenarios": {},
+    }
+
+    sampler.start()
+
+    mark = sampler.mark()
+    time.sleep(min(args.duration, 5))
+    report["idle"] = sampler.summary(mark)
+
+    for scenario_class in SCENARIOS:
+        if scenario_class.name not in names:
+            continue
+
+        scenario = scenario_class(args)
+        try:
+            skipped = scenario.prepare()
+            if skipped is not None:
+                report["scenarios"][scenario.name] = {"skipped": skipped}
+                continue
+
+            mark = sampler.mark()
+            result = scenario.run(time.monotonic() + args.duration)
+            result["process"] = sampler.summary(mark)
+            report["scenarios"][scenario.name] = result
+        finally:
+            scenario.cleanup()
+
+        print("%s: %s" % (scenario.name, json.dumps(report["scenarios"][scenario.name])))
+
+    sampler.stop()
+
+    with open(args.report, "w") as f:
+        json.dump(report, f, indent=2, sort_keys=True)
+
+    # Every scenario which ran must have done some work without errors.
+    for name, result in report["scenarios"].items():
+        if "skipped" not in result:
+            assert result.get("errors", 0) == 0, name
+
+
+if __name__ == "__main__":
+    main()
@@ -140,6 +140,10 @@ case "$(uname)" in
                 && make os=linux && sudo make install os=linux
         fi
 
+        if [ "${OTBR_MDNS-}" == 'native' ]; then
+            sudo apt-get install --no-install-recommends -y dnsutils iproute2
+        fi
+
         # Enable IPv6
         if [ "$BUILD_TARGET" == check ]; then
             echo 0 | sudo tee /proc/sys/net/ipv6/conf/all/disable_ipv6
@@ -0,0 +1,161 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "agent/auto_attacher.cpp"
+
+using otbr::Clock;
+using otbr::MainloopContext;
+using otbr::Milliseconds;
+using otbr::TaskRunner;
+using otbr::Ncp::AutoAttacher;
+
+// Runs the tasks which become due within @p aDuration.
+static void RunMainloop(TaskRunner &aTaskRunner, Milliseconds aDuration)
+{
+    otbr::Timepoint end = Clock::now() + aDuration;
+
+    while (Clock::now() < end)
+    {
+        MainloopContext mainloop;
+        Milliseconds    remaining = std::chrono::duration_cast<Milliseconds>(end - Clock::now());
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = otbr::ToTimeval(remaining);
+
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        aTaskRunner.Update(mainloop);
+        CHECK(select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                     &mainloop.mTimeout) >= 0);
+        aTaskRunner.Process(mainloop);
+    }
+}
+
+TEST_GROUP(AutoAttacher){};
+
+TEST(AutoAttacher, TestResumeOnStart)
+{
+    TaskRunner   taskRunner;
+    int          attempts = 0;
+    AutoAttacher autoAttacher(taskRunner, [&attempts]() {
+        attempts++;
+        return true;
+    });
+
+    CHECK_FALSE(autoAttacher.IsPending());
+
+    autoAttacher.Start();
+    CHECK_TRUE(autoAttacher.IsPending());
+    CHECK_EQUAL(0, attempts);
+
+    // The attempt runs from the mainloop.
+    RunMainloop(taskRunner, Milliseconds(10));
+    CHECK_EQUAL(1, attempts);
+    CHECK_FALSE(autoAttacher.IsPending());
+
+    // Dataset changes no longer trigger attempts.
+    autoAttacher.HandleDatasetChanged();
+    RunMainloop(taskRunner, Milliseconds(10));
+    CHECK_EQUAL(1, attempts);
+}
+
+TEST(AutoAttacher, TestRetryAfterFailure)
+{
+    TaskRunner   taskRunner;
+    int          attempts = 0;
+    AutoAttacher autoAttacher(taskRunner, [&attempts]() { return ++attempts == 2; });
+
+    autoAttacher.Start();
+    RunMainloop(taskRunner, Milliseconds(10));
+    CHECK_EQUAL(1, attempts);
+    CHECK_TRUE(autoAttacher.IsPending());
+
+    // A failed attempt is retried after the retry interval.
+    RunMainloop(taskRunner, AutoAttacher::kRetryInterval / 2);
+    CHECK_EQUAL(1, attempts);
+    RunMainloop(taskRunner, AutoAttacher::kRetryInterval);
+    CHECK_EQUAL(2, attempts);
+    CHECK_FALSE(autoAttacher.IsPending());
+
+    RunMainloop(taskRunner, AutoAttacher::kRetryInterval + Milliseconds(100));
+    CHECK_EQUAL(2, attempts);
+}
+
+TEST(AutoAttacher, TestRetryOnDatasetChanged)
+{
+    TaskRunner   taskRunner;
+    int          attempts = 0;
+    AutoAttacher autoAttacher(taskRunner, [&attempts]() {
+        attempts++;
+        return false;
+    });
+
+    autoAttacher.Start();
+    RunMainloop(taskRunner, Milliseconds(10));
+    CHECK_EQUAL(1, attempts);
+
+    // A dataset change retries right away and replaces the scheduled retry.
+    RunMainloop(taskRunner, AutoAttacher::kRetryInterval / 2);
+    autoAttacher.HandleDatasetChanged();
+    RunMainloop(taskRunner, Milliseconds(10));
+    CHECK_EQUAL(2, attempts);
+
+    RunMainloop(taskRunner, AutoAttacher::kRetryInterval * 3 / 4);
+    CHECK_EQUAL(2, attempts);
+    RunMainloop(taskRunner, AutoAttacher::kRetryInterval / 2);
+    CHECK_EQUAL(3, attempts);
+    CHECK_TRUE(autoAttacher.IsPending());
+}
+
+TEST(AutoAttacher, TestStop)
+{
+    TaskRunner   taskRunner;
+    int          attempts = 0;
+    AutoAttacher autoAttacher(taskRunner, [&attempts]() {
+        attempts++;
+        return false;
+    });
+
+    autoAttacher.Start();
+    autoAttacher.Stop();
+    CHECK_FALSE(autoAttacher.IsPending());
+
+    autoAttacher.HandleDatasetChanged();
+    RunMainloop(taskRunner, Milliseconds(10));
+    CHECK_EQUAL(0, attempts);
+
+    // It can be started again, as after a reset of the OpenThread instance.
+    autoAttacher.Start();
+    RunMainloop(taskRunner, Milliseconds(10));
+    CHECK_EQUAL(1, attempts);
+    CHECK_TRUE(autoAttacher.IsPending());
+}
@@ -0,0 +1,115 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "utils/crc16.hpp"
+
+#include <string.h>
+
+#include <vector>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::Crc16;
+
+static uint16_t ComputeCrc(Crc16::Polynomial aPolynomial, const uint8_t *aBuffer, size_t aLength)
+{
+    Crc16 crc(aPolynomial);
+
+    crc.Update(aBuffer, aLength);
+
+    return crc.Get();
+}
+
+TEST_GROUP(Crc16){};
+
+TEST(Crc16, TestKnownAnswers)
+{
+    const uint8_t check[]  = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    const uint8_t joiner[] = {0x18, 0xb4, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01};
+
+    // CRC-16/XMODEM and CRC-16/UMTS, both start from zero and are not reflected.
+    CHECK_EQUAL(0x31c3, ComputeCrc(Crc16::kCcitt, check, sizeof(check)));
+    CHECK_EQUAL(0xfee8, ComputeCrc(Crc16::kAnsi, check, sizeof(check)));
+
+    CHECK_EQUAL(0x0000, ComputeCrc(Crc16::kCcitt, check, 0));
+    CHECK_EQUAL(0x0000, ComputeCrc(Crc16::kAnsi, check, 0));
+    CHECK_EQUAL(0x2672, ComputeCrc(Crc16::kCcitt, check, 1));
+    CHECK_EQUAL(0x80a5, ComputeCrc(Crc16::kAnsi, check, 1));
+
+    CHECK_EQUAL(0x2f71, ComputeCrc(Crc16::kCcitt, joiner, sizeof(joiner)));
+    CHECK_EQUAL(0x3f23, ComputeCrc(Crc16::kAnsi, joiner, sizeof(joiner)));
+}
+
+TEST(Crc16, TestBytewiseMatchesBulk)
+{
+    const Crc16::Polynomial polynomials[] = {Crc16::kCcitt, Crc16::kAnsi};
+    std::vector<uint8_t>    buffer(67);
+
+    for (size_t i = 0; i < buffer.size(); i++)
+    {
+        buffer[i] = static_cast<uint8_t>(i * 37 + 11);
+    }
+
+    for (Crc16::Polynomial polynomial : polynomials)
+    {
+        // Odd offsets and lengths cover the bytes before and after the 8-byte slices.
+        for (size_t offset = 0; offset < 8; offset++)
+        {
+            for (size_t length = 0; offset + length <= buffer.size(); length++)
+            {
+                Crc16 bytewise(polynomial);
+                Crc16 bulk(polynomial);
+                Crc16 split(polynomial);
+
+                for (size_t i = 0; i < length; i++)
+                {
+                    bytewise.Update(buffer[offset + i]);
+                }
+
+                bulk.Update(&buffer[offset], length);
+
+                split.Update(&buffer[offset], length / 3);
+                split.Update(&buffer[offset + length / 3], length - length / 3);
+
+                CHECK_EQUAL(bytewise.Get(), bulk.Get());
+                CHECK_EQUAL(bytewise.Get(), split.Get());
+            }
+        }
+    }
+}
+
+TEST(Crc16, TestInit)
+{
+    const uint8_t data[] = {0x01, 0x02, 0x03};
+    Crc16         crc(Crc16::kCcitt);
+
+    crc.Update(data, sizeof(data));
+    crc.Init();
+    crc.Update(data, 0);
+    CHECK_EQUAL(0, crc.Get());
+}
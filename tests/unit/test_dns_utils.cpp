@@ -95,3 +95,18 @@ TEST(DnsUtils, TestSplitFullDnsName)
     CheckSplitFullDnsName("com", false, false, true, "", "", "com", ".");
     CheckSplitFullDnsName("", false, false, true, "", "", "", ".");
 }
+
+TEST(DnsUtils, TestMakeAlternativeName)
+{
+    CHECK_EQUAL(std::string("Printer (2)"), MakeAlternativeServiceName("Printer", 1));
+    CHECK_EQUAL(std::string("Printer (3)"), MakeAlternativeServiceName("Printer", 2));
+    CHECK_EQUAL(std::string("host-2"), MakeAlternativeHostName("host", 1));
+    CHECK_EQUAL(std::string("host-10"), MakeAlternativeHostName("host", 9));
+
+    // Check that the result fits in one label
+    CHECK_EQUAL(std::string(59, 'a') + " (2)", MakeAlternativeServiceName(std::string(63, 'a'), 1));
+    CHECK_EQUAL(std::string(61, 'a') + "-2", MakeAlternativeHostName(std::string(63, 'a'), 1));
+
+    // Check that a UTF-8 character is not split
+    CHECK_EQUAL(std::string(58, 'a') + " (2)", MakeAlternativeServiceName(std::string(58, 'a') + "\xc3\xa9", 1));
+}
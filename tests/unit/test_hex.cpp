@@ -0,0 +1,77 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "utils/hex.hpp"
+
+#include <string.h>
+
+#include <CppUTest/TestHarness.h>
+
+TEST_GROUP(Hex){};
+
+TEST(Hex, TestRoundTrip)
+{
+    uint8_t bytes[40];
+    uint8_t decoded[sizeof(bytes)];
+    char    hex[sizeof(bytes) * 2 + 1];
+    size_t  length;
+
+    for (size_t i = 0; i < sizeof(bytes); i++)
+    {
+        bytes[i] = static_cast<uint8_t>(i * 37);
+    }
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, otbr::Utils::Bytes2Hex(bytes, sizeof(bytes), hex, sizeof(hex)));
+    CHECK_EQUAL(sizeof(bytes) * 2, strlen(hex));
+    STRNCMP_EQUAL("00254A6F94B9DE03", hex, 16);
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, otbr::Utils::Hex2Bytes(hex, strlen(hex), decoded, sizeof(decoded), length));
+    CHECK_EQUAL(sizeof(bytes), length);
+    MEMCMP_EQUAL(bytes, decoded, sizeof(bytes));
+
+    CHECK_EQUAL(3, otbr::Utils::Hex2Bytes("aBcDe", decoded, sizeof(decoded)));
+    CHECK_EQUAL(0x0a, decoded[0]);
+    CHECK_EQUAL(0xbc, decoded[1]);
+    CHECK_EQUAL(0xde, decoded[2]);
+}
+
+TEST(Hex, TestErrors)
+{
+    const char kHex[] = "00112233445566778899aabbccddeeff00112233445566778899aabbccddeeff0g";
+    uint8_t    bytes[sizeof(kHex) / 2];
+    char       hex[8];
+    size_t     length;
+
+    CHECK_EQUAL(OTBR_ERROR_PARSE, otbr::Utils::Hex2Bytes(kHex, strlen(kHex), bytes, sizeof(bytes), length));
+    CHECK_EQUAL(strlen(kHex) - 1, length);
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, otbr::Utils::Hex2Bytes(kHex, strlen(kHex), bytes, 4, length));
+    CHECK_EQUAL(-1, otbr::Utils::Hex2Bytes("12 4", bytes, sizeof(bytes)));
+
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, otbr::Utils::Bytes2Hex(bytes, 4, hex, sizeof(hex)));
+    CHECK_EQUAL(OTBR_ERROR_NONE, otbr::Utils::Bytes2Hex(bytes, 3, hex, sizeof(hex)));
+}
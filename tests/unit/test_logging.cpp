@@ -30,10 +30,17 @@
 
 #include <CppUTest/TestHarness.h>
 
+#include <fcntl.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <time.h>
 #include <unistd.h>
 
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "common/logging.hpp"
 
 TEST_GROUP(Logging){};
@@ -112,3 +119,230 @@ TEST(Logging, TestLoggingDump)
     sprintf(cmd, "grep '%s.*: foobar: 0020: 6f 66 20 74 65 78 74 00' /var/log/syslog", ident);
     CHECK(0 == system(cmd));
 }
+
+TEST(Logging, TestLoggingFlushOnDeinit)
+{
+    char ident[32];
+    char cmd[128];
+
+    sprintf(ident, "otbr-test-%ld", clock());
+    otbrLogInit(ident, OTBR_LOG_INFO, true);
+    for (int i = 0; i < 16; i++)
+    {
+        otbrLogInfo("cool-flush-%d", i);
+    }
+    otbrLogDeinit();
+
+    // All messages must have been written once the logging service is deinitialized,
+    // even if they were queued to the asynchronous writer.
+    sprintf(cmd, "grep '%s.*cool-flush-15' /var/log/syslog", ident);
+    CHECK(0 == system(cmd));
+    CHECK(0 == otbrLogGetDroppedCount());
+}
+
+TEST(Logging, TestLoggingTagLevel)
+{
+    char ident[32];
+    char cmd[128];
+
+    sprintf(ident, "otbr-test-%ld", clock());
+    otbrLogInit(ident, OTBR_LOG_INFO, true);
+    CHECK(OTBR_ERROR_NONE == otbrLogSetTagLevel(OTBR_LOG_TAG, OTBR_LOG_DEBUG));
+    otbrLogDebug("cool-tag-debug");
+    otbrLog(OTBR_LOG_DEBUG, "OTHER", "cool-other-debug");
+    CHECK(OTBR_ERROR_NONE == otbrLogSetTagLevel(OTBR_LOG_TAG, OTBR_LOG_INFO));
+    otbrLogDeinit();
+    sleep(0);
+
+    sprintf(cmd, "grep '%s.*cool-tag-debug' /var/log/syslog", ident);
+    CHECK(0 == system(cmd));
+
+    sprintf(cmd, "grep '%s.*cool-other-debug' /var/log/syslog", ident);
+    CHECK(0 != system(cmd));
+
+    CHECK(OTBR_ERROR_INVALID_ARGS == otbrLogSetTagLevel("TOO-LONG-TAG", OTBR_LOG_DEBUG));
+}
+
+static int sEvaluatedCount = 0;
+
+static const char *CountEvaluation(void)
+{
+    sEvaluatedCount++;
+    return "evaluated";
+}
+
+TEST(Logging, TestLoggingLazyArguments)
+{
+    otbrLogInit("otbr-test-lazy", OTBR_LOG_INFO, false);
+
+    sEvaluatedCount = 0;
+    otbrLogDebug("%s", CountEvaluation());
+    CHECK_EQUAL(0, sEvaluatedCount);
+
+    otbrLogInfo("%s", CountEvaluation());
+    CHECK_EQUAL(1, sEvaluatedCount);
+
+    otbrLogDeinit();
+}
+
+#if OTBR_ENABLE_ASYNC_LOGGING
+
+// Log lines are echoed to stderr, which is redirected into a pipe so that the test reads back what the writer wrote.
+struct StderrCapture
+{
+    int         mPipe[2];
+    int         mStderr;
+    std::string mOutput;
+    std::thread mReader;
+
+    StderrCapture(void)
+    {
+        CHECK(0 == pipe2(mPipe, O_CLOEXEC));
+        mStderr = dup(STDERR_FILENO);
+        CHECK(mStderr >= 0);
+        CHECK(STDERR_FILENO == dup2(mPipe[1], STDERR_FILENO));
+        close(mPipe[1]);
+    }
+
+    void StartReading(void)
+    {
+        mReader = std::thread([this]() {
+            char    buffer[4096];
+            ssize_t length;
+
+            while ((length = read(mPipe[0], buffer, sizeof(buffer))) > 0)
+            {
+                mOutput.append(buffer, static_cast<size_t>(length));
+            }
+        });
+    }
+
+    // Restores stderr and returns the captured lines.
+    std::vector<std::string> Finish(void)
+    {
+        std::vector<std::string> lines;
+        size_t                   begin = 0;
+        size_t                   end;
+
+        CHECK(STDERR_FILENO == dup2(mStderr, STDERR_FILENO));
+        close(mStderr);
+        mReader.join();
+        close(mPipe[0]);
+
+        while ((end = mOutput.find('\n', begin)) != std::string::npos)
+        {
+            lines.push_back(mOutput.substr(begin, end - begin));
+            begin = end + 1;
+        }
+
+        return lines;
+    }
+};
+
+TEST(Logging, TestLoggingAsyncOverflow)
+{
+    const int                kCount = 10000;
+    StderrCapture            capture;
+    std::vector<std::string> lines;
+    int                      written = 0;
+    int                      dropped = 0;
+    int                      last    = -1;
+    int                      index;
+    unsigned int             count;
+
+    otbrLogInit("otbr-test-overflow", OTBR_LOG_INFO, true);
+
+    // Nobody reads the pipe yet, so the writer blocks once it's full and the ring overflows.
+    for (int i = 0; i < kCount; i++)
+    {
+        otbrLogInfo("cool-overflow-%d", i);
+    }
+    CHECK(otbrLogGetDroppedCount() > 0);
+
+    capture.StartReading();
+    otbrLogDeinit();
+    lines = capture.Finish();
+
+    for (const std::string &line : lines)
+    {
+        const char *message;
+
+        if ((message = strstr(line.c_str(), "cool-overflow-")) != nullptr &&
+            sscanf(message, "cool-overflow-%d", &index) == 1)
+        {
+            // Lines are written in the order they were logged, the dropped ones are skipped.
+            CHECK(index > last);
+            last = index;
+            written++;
+        }
+        else if ((message = strstr(line.c_str(), "Dropped ")) != nullptr &&
+                 sscanf(message, "Dropped %u log messages", &count) == 1)
+        {
+            dropped += static_cast<int>(count);
+        }
+    }
+
+    CHECK(dropped > 0);
+    CHECK_EQUAL(kCount, written + dropped);
+    CHECK_EQUAL(0, otbrLogGetDroppedCount());
+}
+
+TEST(Logging, TestLoggingAsyncOrdering)
+{
+    const int                kThreadCount = 4;
+    const int                kCount       = 1000;
+    StderrCapture            capture;
+    std::vector<std::string> lines;
+    std::vector<std::thread> producers;
+    std::vector<int>         last(kThreadCount, -1);
+    int                      written = 0;
+    int                      dropped = 0;
+    int                      thread;
+    int                      index;
+    unsigned int             count;
+
+    capture.StartReading();
+    otbrLogInit("otbr-test-ordering", OTBR_LOG_INFO, true);
+
+    for (int i = 0; i < kThreadCount; i++)
+    {
+        producers.emplace_back([i]() {
+            for (int j = 0; j < kCount; j++)
+            {
+                otbrLogInfo("cool-order-%d-%d", i, j);
+            }
+        });
+    }
+
+    for (std::thread &producer : producers)
+    {
+        producer.join();
+    }
+
+    otbrLogDeinit();
+    lines = capture.Finish();
+
+    for (const std::string &line : lines)
+    {
+        const char *message;
+
+        if ((message = strstr(line.c_str(), "cool-order-")) != nullptr &&
+            sscanf(message, "cool-order-%d-%d", &thread, &index) == 2)
+        {
+            CHECK(thread >= 0 && thread < kThreadCount);
+            // The lines of each producer keep their order through the ring.
+            CHECK(index > last[thread]);
+            last[thread] = index;
+            written++;
+        }
+        else if ((message = strstr(line.c_str(), "Dropped ")) != nullptr &&
+                 sscanf(message, "Dropped %u log messages", &count) == 1)
+        {
+            dropped += static_cast<int>(count);
+        }
+    }
+
+    CHECK_EQUAL(kThreadCount * kCount, written + dropped);
+}
+
+#endif // OTBR_ENABLE_ASYNC_LOGGING
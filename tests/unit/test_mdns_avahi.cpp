@@ -0,0 +1,208 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <string.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+
+#include "common/code_utils.hpp"
+#include "mdns/mdns_avahi.hpp"
+
+using otbr::MainloopContext;
+using otbr::Mdns::Publisher;
+using otbr::Mdns::PublisherAvahi;
+
+// The client, the browser and the resolver are faked, so that the tests report results without an Avahi daemon.
+// These definitions take precedence over the ones of libavahi-client, which otbr-mdns links.
+static AvahiServiceBrowserCallback  sBrowseCallback;
+static void *                       sBrowseContext;
+static AvahiServiceResolverCallback sResolveCallback;
+static void *                       sResolveContext;
+static int                          sResolverCount;
+static int                          sClient;
+static int                          sBrowser;
+static int                          sResolver;
+
+AvahiClient *avahi_client_new(const AvahiPoll *, AvahiClientFlags, AvahiClientCallback, void *, int *aError)
+{
+    *aError = 0;
+
+    return reinterpret_cast<AvahiClient *>(&sClient);
+}
+
+void avahi_client_free(AvahiClient *)
+{
+}
+
+AvahiServiceBrowser *avahi_service_browser_new(AvahiClient *,
+                                               AvahiIfIndex,
+                                               AvahiProtocol,
+                                               const char *,
+                                               const char *,
+                                               AvahiLookupFlags,
+                                               AvahiServiceBrowserCallback aCallback,
+                                               void *                      aContext)
+{
+    sBrowseCallback = aCallback;
+    sBrowseContext  = aContext;
+
+    return reinterpret_cast<AvahiServiceBrowser *>(&sBrowser);
+}
+
+int avahi_service_browser_free(AvahiServiceBrowser *)
+{
+    sBrowseCallback = nullptr;
+
+    return 0;
+}
+
+AvahiServiceResolver *avahi_service_resolver_new(AvahiClient *,
+                                                 AvahiIfIndex,
+                                                 AvahiProtocol,
+                                                 const char *,
+                                                 const char *,
+                                                 const char *,
+                                                 AvahiProtocol,
+                                                 AvahiLookupFlags,
+                                                 AvahiServiceResolverCallback aCallback,
+                                                 void *                       aContext)
+{
+    sResolveCallback = aCallback;
+    sResolveContext  = aContext;
+    sResolverCount++;
+
+    return reinterpret_cast<AvahiServiceResolver *>(&sResolver);
+}
+
+int avahi_service_resolver_free(AvahiServiceResolver *)
+{
+    sResolverCount--;
+
+    return 0;
+}
+
+static void HandleState(void *, Publisher::State)
+{
+}
+
+static void ProcessMainloop(PublisherAvahi &aPublisher)
+{
+    MainloopContext mainloop;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {0, 0};
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    aPublisher.Update(mainloop);
+    select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+           &mainloop.mTimeout);
+    aPublisher.Process(mainloop);
+}
+
+// Browses "_test._udp" and resolves the instance "inst" for the browsing subscription.
+static void BrowseAndResolve(PublisherAvahi &aPublisher)
+{
+    AvahiAddress address;
+
+    SuccessOrDie(aPublisher.Start(), "failed to start the publisher");
+    aPublisher.SubscribeService("_test._udp", "");
+    CHECK(sBrowseCallback != nullptr);
+    sBrowseCallback(reinterpret_cast<AvahiServiceBrowser *>(&sBrowser), 1, AVAHI_PROTO_INET6, AVAHI_BROWSER_NEW,
+                    "inst", "_test._udp", "local", static_cast<AvahiLookupResultFlags>(0), sBrowseContext);
+    CHECK_EQUAL(1, sResolverCount);
+
+    memset(&address, 0, sizeof(address));
+    address.proto                      = AVAHI_PROTO_INET6;
+    address.data.ipv6.address[0]       = 0x20;
+    address.data.ipv6.address[1]       = 0x01;
+    address.data.ipv6.address[15]      = 0x01;
+    sResolveCallback(reinterpret_cast<AvahiServiceResolver *>(&sResolver), 1, AVAHI_PROTO_INET6, AVAHI_RESOLVER_FOUND,
+                     "inst", "_test._udp", "local", "host.local", &address, 1234, nullptr,
+                     static_cast<AvahiLookupResultFlags>(0), sResolveContext);
+}
+
+TEST_GROUP(MdnsAvahi){};
+
+TEST(MdnsAvahi, TestSharedResolutionIsReportedFromMainloop)
+{
+    PublisherAvahi publisher(AF_INET6, nullptr, HandleState, nullptr, 0);
+    int            reportCount   = 0;
+    int            subscriptions = 0;
+
+    // Like OpenThread, unsubscribes every query of the instance once it's answered.
+    publisher.SetSubscriptionCallbacks(
+        [&](const std::string &aType, const Publisher::DiscoveredInstanceInfo &aInstanceInfo) {
+            reportCount++;
+            for (; aInstanceInfo.mName == "inst" && subscriptions > 0; subscriptions--)
+            {
+                publisher.UnsubscribeService(aType, aInstanceInfo.mName);
+            }
+        },
+        nullptr);
+
+    BrowseAndResolve(publisher);
+    CHECK_EQUAL(1, reportCount);
+
+    // The instance is already resolved, so its subscriptions share the resolver of the browser.
+    subscriptions = 2;
+    publisher.SubscribeService("_test._udp", "inst");
+    publisher.SubscribeService("_test._udp", "inst");
+    CHECK_EQUAL(1, reportCount);
+    CHECK_EQUAL(1, sResolverCount);
+
+    ProcessMainloop(publisher);
+    CHECK_EQUAL(2, reportCount);
+    CHECK_EQUAL(0, subscriptions);
+
+    // The resolver is freed along with the browser.
+    CHECK_EQUAL(1, sResolverCount);
+    publisher.UnsubscribeService("_test._udp", "");
+    CHECK_EQUAL(0, sResolverCount);
+}
+
+TEST(MdnsAvahi, TestSharedResolutionIsDroppedAfterUnsubscribing)
+{
+    PublisherAvahi publisher(AF_INET6, nullptr, HandleState, nullptr, 0);
+    int            reportCount = 0;
+
+    publisher.SetSubscriptionCallbacks(
+        [&](const std::string &, const Publisher::DiscoveredInstanceInfo &) { reportCount++; }, nullptr);
+
+    BrowseAndResolve(publisher);
+    publisher.SubscribeService("_test._udp", "inst");
+    publisher.UnsubscribeService("_test._udp", "inst");
+    publisher.UnsubscribeService("_test._udp", "");
+    CHECK_EQUAL(0, sResolverCount);
+
+    ProcessMainloop(publisher);
+    CHECK_EQUAL(1, reportCount);
+}
@@ -0,0 +1,627 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <algorithm>
+
+#include <net/if.h>
+#include <string.h>
+
+#include "mdns/mdns_native.hpp"
+
+namespace otbr {
+
+namespace Mdns {
+
+// Drives the native responder with crafted messages and a fake clock, without sockets.
+class PublisherNativeTest : public Utest
+{
+public:
+    PublisherNativeTest(void)
+        : mPublisher(AF_INET6, nullptr, HandleState, nullptr, /* aInterfaceIndex */ 0)
+    {
+    }
+
+    void setup() override
+    {
+        mPublisher.mIsStarted  = true;
+        mPublisher.mHostName   = "ot";
+        mPublisher.mInterfaces = {kInterface1, kInterface2};
+        mPublisher.SetPublishServiceHandler(HandlePublishService, this);
+        mPublisher.SetPublishHostHandler(HandlePublishHost, this);
+        mNow = Clock::now();
+    }
+
+    void teardown() override { mPublisher.Stop(); }
+
+protected:
+    static constexpr uint32_t kInterface1 = 1;
+    static constexpr uint32_t kInterface2 = 2;
+    static constexpr uint16_t kPort       = 1234;
+
+    typedef std::pair<std::string, otbrError> Result;
+
+    static std::string MakeName(const char *aDotted)
+    {
+        std::string name;
+
+        CHECK_EQUAL(OTBR_ERROR_NONE, AppendDottedName(name, aDotted));
+
+        return name;
+    }
+
+    static Record MakeRecord(const char *aName, uint16_t aType, std::vector<uint8_t> aData, uint32_t aTtl)
+    {
+        Record record;
+
+        record.mName       = MakeName(aName);
+        record.mType       = aType;
+        record.mClass      = kClassIn;
+        record.mCacheFlush = aType != kTypePtr;
+        record.mTtl        = aTtl;
+        record.mData       = std::move(aData);
+
+        return record;
+    }
+
+    static Record MakePtr(uint32_t aTtl = 4500)
+    {
+        std::vector<uint8_t> data;
+
+        AppendNameData(data, MakeName("svc._test._udp.local."));
+
+        return MakeRecord("_test._udp.local.", kTypePtr, std::move(data), aTtl);
+    }
+
+    static Record MakeSrv(uint16_t aPort)
+    {
+        std::vector<uint8_t> data = {0, 0, 0, 0, static_cast<uint8_t>(aPort >> 8), static_cast<uint8_t>(aPort & 0xff)};
+
+        AppendNameData(data, MakeName("ot.local."));
+
+        return MakeRecord("svc._test._udp.local.", kTypeSrv, std::move(data), 120);
+    }
+
+    static Record MakeTxt(void) { return MakeRecord("svc._test._udp.local.", kTypeTxt, {0}, 4500); }
+
+    static Record MakeAaaa(const char *aName, uint8_t aLastByte, uint32_t aTtl = 120)
+    {
+        std::vector<uint8_t> data = {0xfd, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, aLastByte};
+
+        return MakeRecord(aName, kTypeAaaa, std::move(data), aTtl);
+    }
+
+    void Publish(void)
+    {
+        CHECK_EQUAL(OTBR_ERROR_NONE, mPublisher.PublishService(nullptr, kPort, "svc", "_test._udp", {}));
+    }
+
+    // Publishes the local host with a different address on each interface.
+    void PublishLocalHost(void)
+    {
+        uint32_t entryId = mPublisher.AddEntry("ot", "", MakeName("ot.local.")).mId;
+
+        mPublisher.mLocalHostEntryId = entryId;
+        mPublisher.AddRecord(entryId, MakeName("ot.local."), kTypeAaaa, /* aUnique */ true,
+                             std::move(MakeAaaa("ot.local.", 1).mData), kInterface1);
+        mPublisher.AddRecord(entryId, MakeName("ot.local."), kTypeAaaa, /* aUnique */ true,
+                             std::move(MakeAaaa("ot.local.", 2).mData), kInterface2);
+        mPublisher.StartProbing(*mPublisher.FindEntry(entryId), Milliseconds(0));
+    }
+
+    void ChangeAddress(uint32_t aInterfaceIndex, int aFamily, const void *aAddress, bool aIsDeleted)
+    {
+        mPublisher.HandleAddressChange(aInterfaceIndex, aFamily, aAddress, aIsDeleted);
+    }
+
+    void ChangeLink(uint32_t aInterfaceIndex, unsigned int aFlags, bool aIsDeleted)
+    {
+        mPublisher.HandleLinkChange(aInterfaceIndex, aFlags, aIsDeleted);
+    }
+
+    bool IsInterface(uint32_t aInterfaceIndex) const { return mPublisher.IsInterface(aInterfaceIndex); }
+
+    // Returns the interfaces of the published records, 0 for all interfaces.
+    std::vector<uint32_t> GetRecordInterfaces(void) const
+    {
+        std::vector<uint32_t> interfaces;
+
+        for (const PublisherNative::LocalRecord &record : mPublisher.mRecords)
+        {
+            interfaces.push_back(record.mInterfaceIndex);
+        }
+
+        return interfaces;
+    }
+
+    // Runs the timers of the responder up to @p aDelay later.
+    void Advance(Milliseconds aDelay)
+    {
+        mNow += aDelay;
+        mPublisher.ExpireCache(mNow);
+        mPublisher.RefreshCache(mNow);
+        mPublisher.SendProbes(mNow);
+        mPublisher.SendAnnouncements(mNow);
+        mPublisher.SendQueries(mNow);
+        mPublisher.ReportResults();
+    }
+
+    // Sends the aggregated multicast response.
+    void Flush(void) { mPublisher.SendMulticastResponse(); }
+
+    // Probes and announces all entries, and lifts the rate limit of the announced records.
+    void Register(void)
+    {
+        for (int i = 0; i <= 3; i++)
+        {
+            Advance(Milliseconds(300));
+        }
+
+        Flush();
+        Advance(Milliseconds(1000));
+        Flush();
+        LiftRateLimit();
+    }
+
+    void LiftRateLimit(void)
+    {
+        for (PublisherNative::LocalRecord &record : mPublisher.mRecords)
+        {
+            record.mMulticastTime = Timepoint::min();
+        }
+    }
+
+    bool IsProbing(void) const
+    {
+        const PublisherNative::Entry *entry = FindService();
+
+        return entry != nullptr && entry->mState == PublisherNative::EntryState::kProbing;
+    }
+
+    bool IsRegistered(void) const
+    {
+        const PublisherNative::Entry *entry = FindService();
+
+        return entry != nullptr && entry->mState == PublisherNative::EntryState::kRegistered;
+    }
+
+    uint8_t GetProbeCount(void) const { return FindService()->mTxCount; }
+
+    std::string GetServiceName(void) const { return NameToString(FindService()->mFullName); }
+
+    const PublisherNative::Entry *FindService(void) const
+    {
+        return const_cast<PublisherNative &>(mPublisher).FindEntry("svc", "_test._udp");
+    }
+
+    void Query(const Record &aQuestion, uint32_t aInterfaceIndex, const std::vector<Record> &aKnownAnswers = {})
+    {
+        Message message = MakeMessage(0);
+
+        message.mQuestions.push_back({aQuestion.mName, aQuestion.mType, kClassIn, /* mUnicastResponse */ false});
+        message.mAnswers = aKnownAnswers;
+        HandleQuery(message, aInterfaceIndex);
+    }
+
+    void Probe(const std::vector<Record> &aAuthorities, uint32_t aInterfaceIndex)
+    {
+        Message message = MakeMessage(0);
+
+        message.mQuestions.push_back({aAuthorities[0].mName, kTypeAny, kClassIn, /* mUnicastResponse */ false});
+        message.mAuthorities = aAuthorities;
+        HandleQuery(message, aInterfaceIndex);
+    }
+
+    void Respond(const std::vector<Record> &aAnswers, uint32_t aInterfaceIndex)
+    {
+        Message message = MakeMessage(Message::kFlagResponse | Message::kFlagAuthoritative);
+
+        message.mAnswers = aAnswers;
+        mPublisher.HandleResponse(message, aInterfaceIndex);
+        mPublisher.ReportResults();
+    }
+
+    // Returns the answers or additionals queued to be sent on exactly @p aInterfaceIndex.
+    std::vector<Record> GetQueued(uint32_t aInterfaceIndex, bool aIsAnswer = true) const
+    {
+        std::vector<Record> records;
+
+        for (const PublisherNative::QueuedRecord &queued :
+             aIsAnswer ? mPublisher.mMulticastAnswers : mPublisher.mMulticastAdditionals)
+        {
+            if (queued.mInterfaceIndex == aInterfaceIndex)
+            {
+                records.push_back(queued.mRecord);
+            }
+        }
+
+        return records;
+    }
+
+    static bool Contains(const std::vector<Record> &aRecords, const Record &aRecord)
+    {
+        return std::any_of(aRecords.begin(), aRecords.end(),
+                           [&aRecord](const Record &aOther) { return aOther.IsSameAs(aRecord); });
+    }
+
+    const PublisherNative::CacheRecord *FindCacheRecord(const char *aName, uint16_t aType) const
+    {
+        return mPublisher.FindCacheRecord(MakeName(aName), aType);
+    }
+
+    Milliseconds GetQueryInterval(void)
+    {
+        Milliseconds interval(0);
+
+        mPublisher.mSubscribedServices.ForEach([&interval](PublisherNative::ServiceSubscription &aSubscription) {
+            interval = aSubscription.mQueryInterval;
+        });
+
+        return interval;
+    }
+
+    PublisherNative     mPublisher;
+    Timepoint           mNow;
+    std::vector<Result> mResults;
+
+private:
+    static Message MakeMessage(uint16_t aFlags)
+    {
+        Message message;
+
+        message.mId    = 0;
+        message.mFlags = aFlags;
+
+        return message;
+    }
+
+    void HandleQuery(const Message &aMessage, uint32_t aInterfaceIndex)
+    {
+        PublisherNative::Socket socket = {-1, AF_INET6};
+        sockaddr_storage        source;
+
+        memset(&source, 0, sizeof(source));
+        mPublisher.HandleQuery(aMessage, socket, source, /* aIsLegacy */ false, aInterfaceIndex);
+    }
+
+    static void HandleState(void *, Publisher::State) {}
+
+    static void HandlePublishService(const char *aName, const char *, otbrError aError, void *aContext)
+    {
+        static_cast<PublisherNativeTest *>(aContext)->mResults.emplace_back(aName, aError);
+    }
+
+    static void HandlePublishHost(const char *aName, otbrError aError, void *aContext)
+    {
+        static_cast<PublisherNativeTest *>(aContext)->mResults.emplace_back(aName, aError);
+    }
+};
+
+} // namespace Mdns
+
+} // namespace otbr
+
+using otbr::Milliseconds;
+using otbr::Mdns::kTypeAaaa;
+using otbr::Mdns::PublisherNativeTest;
+using otbr::Mdns::Record;
+
+TEST_GROUP_BASE(MdnsNative, PublisherNativeTest){};
+
+TEST(MdnsNative, TestProbeAndAnnounce)
+{
+    Publish();
+    CHECK_TRUE(IsProbing());
+
+    // Three probes, then the service is reported and announced twice on all interfaces.
+    for (int i = 1; i <= 3; i++)
+    {
+        Advance(Milliseconds(300));
+        CHECK_TRUE(IsProbing());
+        CHECK_EQUAL(i, GetProbeCount());
+    }
+    CHECK_TRUE(mResults.empty());
+
+    Advance(Milliseconds(300));
+    CHECK_FALSE(IsProbing());
+    CHECK_EQUAL(1u, mResults.size());
+    CHECK_EQUAL(std::string("svc"), mResults[0].first);
+    CHECK_EQUAL(OTBR_ERROR_NONE, mResults[0].second);
+    CHECK_TRUE(Contains(GetQueued(0), MakeSrv(kPort)));
+    CHECK_TRUE(Contains(GetQueued(0), MakePtr()));
+
+    Flush();
+    CHECK_FALSE(IsRegistered());
+    Advance(Milliseconds(1000));
+    CHECK_TRUE(IsRegistered());
+    CHECK_TRUE(Contains(GetQueued(0), MakeTxt()));
+}
+
+TEST(MdnsNative, TestProbeTiebreak)
+{
+    Publish();
+    Advance(Milliseconds(300));
+    CHECK_EQUAL(1, GetProbeCount());
+
+    // A simultaneous probe with lexicographically later records wins, and we probe again one second later.
+    Probe({MakeTxt(), MakeSrv(0xffff)}, kInterface1);
+    CHECK_TRUE(IsProbing());
+    CHECK_EQUAL(0, GetProbeCount());
+
+    Advance(Milliseconds(300));
+    CHECK_EQUAL(0, GetProbeCount());
+    Advance(Milliseconds(1000));
+    CHECK_EQUAL(1, GetProbeCount());
+
+    // A simultaneous probe with lexicographically earlier records loses.
+    Probe({MakeTxt(), MakeSrv(1)}, kInterface1);
+    CHECK_EQUAL(1, GetProbeCount());
+
+    // Our own probe ties.
+    Probe({MakeTxt(), MakeSrv(kPort)}, kInterface1);
+    CHECK_EQUAL(1, GetProbeCount());
+}
+
+TEST(MdnsNative, TestConflict)
+{
+    Publish();
+    Register();
+    CHECK_TRUE(IsRegistered());
+    mResults.clear();
+
+    // Our own records echoed back don't conflict.
+    Respond({MakeSrv(kPort), MakeTxt()}, kInterface1);
+    CHECK_TRUE(IsRegistered());
+    CHECK_TRUE(mResults.empty());
+
+    // Another SRV record of a published name conflicts.
+    Respond({MakeSrv(1)}, kInterface1);
+    CHECK_TRUE(FindService() == nullptr);
+    CHECK_EQUAL(1u, mResults.size());
+    CHECK_EQUAL(OTBR_ERROR_DUPLICATED, mResults[0].second);
+}
+
+TEST(MdnsNative, TestConflictRename)
+{
+    mPublisher.SetConflictPolicy(otbr::Mdns::Publisher::ConflictPolicy::kRename);
+    Publish();
+    Advance(Milliseconds(300));
+
+    // Any other record of a name being probed conflicts, and the service probes again under a new name.
+    Respond({MakeTxt(), MakeSrv(1)}, kInterface2);
+    CHECK_TRUE(IsProbing());
+    CHECK_EQUAL(0, GetProbeCount());
+    CHECK_EQUAL(std::string("svc (2)._test._udp.local."), GetServiceName());
+    CHECK_TRUE(mResults.empty());
+}
+
+TEST(MdnsNative, TestKnownAnswerSuppression)
+{
+    Publish();
+    Register();
+
+    // A known answer with at least half of the TTL suppresses the answer.
+    Query(MakePtr(), kInterface1, {MakePtr(4500)});
+    CHECK_TRUE(GetQueued(kInterface1).empty());
+    Query(MakePtr(), kInterface1, {MakePtr(2250)});
+    CHECK_TRUE(GetQueued(kInterface1).empty());
+
+    // A known answer with less than half of the TTL doesn't, and the answer comes with the SRV and TXT records.
+    Query(MakePtr(), kInterface1, {MakePtr(2249)});
+    CHECK_TRUE(Contains(GetQueued(kInterface1), MakePtr()));
+    CHECK_TRUE(Contains(GetQueued(kInterface1, /* aIsAnswer */ false), MakeSrv(kPort)));
+    CHECK_TRUE(Contains(GetQueued(kInterface1, /* aIsAnswer */ false), MakeTxt()));
+
+    // The continuation of a truncated query suppresses the pending answer, but only on its own interface.
+    Query(MakePtr(), kInterface2);
+    Query(MakeTxt(), kInterface1, {MakePtr()});
+    CHECK_FALSE(Contains(GetQueued(kInterface1), MakePtr()));
+    CHECK_TRUE(Contains(GetQueued(kInterface2), MakePtr()));
+
+    // The same answer from another responder on the same interface suppresses it too.
+    Respond({MakePtr()}, kInterface1);
+    CHECK_TRUE(Contains(GetQueued(kInterface2), MakePtr()));
+    Respond({MakePtr()}, kInterface2);
+    CHECK_TRUE(GetQueued(kInterface2).empty());
+}
+
+TEST(MdnsNative, TestRateLimit)
+{
+    Publish();
+    Register();
+
+    Query(MakePtr(), kInterface1);
+    CHECK_TRUE(Contains(GetQueued(kInterface1), MakePtr()));
+    Flush();
+
+    // A record is multicast at most once per second.
+    Query(MakePtr(), kInterface1);
+    Query(MakePtr(), kInterface2);
+    CHECK_TRUE(GetQueued(kInterface1).empty());
+    CHECK_TRUE(GetQueued(kInterface2).empty());
+
+    LiftRateLimit();
+    Query(MakePtr(), kInterface2);
+    CHECK_TRUE(Contains(GetQueued(kInterface2), MakePtr()));
+}
+
+TEST(MdnsNative, TestAnswerOnIngressInterface)
+{
+    PublishLocalHost();
+    Publish();
+
+    for (int i = 0; i <= 3; i++)
+    {
+        Advance(Milliseconds(300));
+    }
+
+    // Each address is announced only on its own interface.
+    CHECK_TRUE(Contains(GetQueued(kInterface1), MakeAaaa("ot.local.", 1)));
+    CHECK_FALSE(Contains(GetQueued(kInterface1), MakeAaaa("ot.local.", 2)));
+    CHECK_TRUE(Contains(GetQueued(kInterface2), MakeAaaa("ot.local.", 2)));
+    CHECK_TRUE(Contains(GetQueued(0), MakeSrv(kPort)));
+    CHECK_FALSE(Contains(GetQueued(0), MakeAaaa("ot.local.", 1)));
+
+    Flush();
+    Advance(Milliseconds(1000));
+    Flush();
+    LiftRateLimit();
+    CHECK_TRUE(IsRegistered());
+
+    // Queries are answered on the interface they came in on, with the addresses of that interface.
+    Query(MakeAaaa("ot.local.", 0), kInterface2);
+    CHECK_EQUAL(1u, GetQueued(kInterface2).size());
+    CHECK_TRUE(Contains(GetQueued(kInterface2), MakeAaaa("ot.local.", 2)));
+    CHECK_TRUE(GetQueued(kInterface1).empty());
+    CHECK_TRUE(GetQueued(0).empty());
+
+    Query(MakePtr(), kInterface1);
+    CHECK_TRUE(Contains(GetQueued(kInterface1), MakePtr()));
+    CHECK_TRUE(Contains(GetQueued(kInterface1, /* aIsAnswer */ false), MakeAaaa("ot.local.", 1)));
+    CHECK_FALSE(Contains(GetQueued(kInterface1, /* aIsAnswer */ false), MakeAaaa("ot.local.", 2)));
+}
+
+TEST(MdnsNative, TestAddressChange)
+{
+    const uint8_t address3[16] = {0xfd, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3};
+    const uint8_t address1[16] = {0xfd, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1};
+    const uint8_t address4[4]  = {192, 168, 0, 1};
+
+    PublishLocalHost();
+    Register();
+
+    // A new address is published on its interface, and the whole address set is announced again.
+    ChangeAddress(kInterface1, AF_INET6, address3, /* aIsDeleted */ false);
+    Advance(Milliseconds(0));
+    CHECK_TRUE(Contains(GetQueued(kInterface1), MakeAaaa("ot.local.", 3)));
+    CHECK_TRUE(Contains(GetQueued(kInterface1), MakeAaaa("ot.local.", 1)));
+    CHECK_TRUE(Contains(GetQueued(kInterface2), MakeAaaa("ot.local.", 2)));
+    CHECK_FALSE(Contains(GetQueued(kInterface2), MakeAaaa("ot.local.", 3)));
+    Flush();
+
+    // Addresses of other interfaces and of the unused family are ignored.
+    ChangeAddress(100, AF_INET6, address3, /* aIsDeleted */ false);
+    ChangeAddress(kInterface1, AF_INET, address4, /* aIsDeleted */ false);
+    CHECK_EQUAL(3u, GetRecordInterfaces().size());
+
+    // A removed address is said goodbye to on its interface.
+    ChangeAddress(kInterface1, AF_INET6, address1, /* aIsDeleted */ true);
+    CHECK_EQUAL(2u, GetRecordInterfaces().size());
+
+    std::vector<Record> goodbyes = GetQueued(kInterface1);
+
+    CHECK_EQUAL(1u, goodbyes.size());
+    CHECK_TRUE(goodbyes[0].IsSameAs(MakeAaaa("ot.local.", 1)));
+    CHECK_EQUAL(0u, goodbyes[0].mTtl);
+    CHECK_TRUE(GetQueued(kInterface2).empty());
+}
+
+TEST(MdnsNative, TestLinkChange)
+{
+    PublishLocalHost();
+    Register();
+
+    // The addresses of an interface going down are dropped without goodbyes, which couldn't be sent anyway.
+    ChangeLink(kInterface2, IFF_UP | IFF_MULTICAST, /* aIsDeleted */ true);
+    CHECK_FALSE(IsInterface(kInterface2));
+    CHECK_TRUE(GetRecordInterfaces() == std::vector<uint32_t>({kInterface1}));
+    CHECK_TRUE(GetQueued(kInterface2).empty());
+
+    // Only interfaces up and capable of multicast are used.
+    ChangeLink(100, IFF_UP | IFF_MULTICAST | IFF_LOOPBACK, /* aIsDeleted */ false);
+    CHECK_FALSE(IsInterface(100));
+    ChangeLink(100, IFF_UP | IFF_MULTICAST, /* aIsDeleted */ false);
+    CHECK_TRUE(IsInterface(100));
+    ChangeLink(100, IFF_MULTICAST, /* aIsDeleted */ false);
+    CHECK_FALSE(IsInterface(100));
+}
+
+TEST(MdnsNative, TestCacheExpiryAndRefresh)
+{
+    mNow = otbr::Clock::now();
+    Respond({MakeAaaa("peer.local.", 1, /* aTtl */ 10)}, kInterface1);
+    CHECK_TRUE(FindCacheRecord("peer.local.", kTypeAaaa) != nullptr);
+
+    // The record is queried again at 80% and 90% of its TTL, and expires at its TTL.
+    Advance(Milliseconds(7500));
+    CHECK_EQUAL(0, FindCacheRecord("peer.local.", kTypeAaaa)->mRefreshCount);
+    Advance(Milliseconds(1000));
+    CHECK_EQUAL(1, FindCacheRecord("peer.local.", kTypeAaaa)->mRefreshCount);
+    Advance(Milliseconds(1000));
+    CHECK_EQUAL(2, FindCacheRecord("peer.local.", kTypeAaaa)->mRefreshCount);
+    Advance(Milliseconds(1000));
+    CHECK_TRUE(FindCacheRecord("peer.local.", kTypeAaaa) == nullptr);
+
+    // A fresh answer restarts the TTL, and a goodbye keeps the record for one more second.
+    mNow = otbr::Clock::now();
+    Respond({MakeAaaa("peer.local.", 1, /* aTtl */ 10)}, kInterface1);
+    Respond({MakeAaaa("peer.local.", 1, /* aTtl */ 0)}, kInterface1);
+    Advance(Milliseconds(500));
+    CHECK_TRUE(FindCacheRecord("peer.local.", kTypeAaaa) != nullptr);
+    Advance(Milliseconds(1000));
+    CHECK_TRUE(FindCacheRecord("peer.local.", kTypeAaaa) == nullptr);
+}
+
+TEST(MdnsNative, TestSubscriptionBackoff)
+{
+    mPublisher.SubscribeService("_test._udp", "");
+    CHECK_EQUAL(1000, GetQueryInterval().count());
+
+    // The first query goes out within 120ms, and the interval doubles after each query.
+    Advance(Milliseconds(200));
+    CHECK_EQUAL(2000, GetQueryInterval().count());
+    Advance(Milliseconds(500));
+    CHECK_EQUAL(2000, GetQueryInterval().count());
+    Advance(Milliseconds(500));
+    CHECK_EQUAL(4000, GetQueryInterval().count());
+    Advance(Milliseconds(2000));
+    CHECK_EQUAL(8000, GetQueryInterval().count());
+
+    mPublisher.UnsubscribeService("_test._udp", "");
+}
+
+TEST(MdnsNative, TestStopReportsPendingResults)
+{
+    const uint8_t address[16] = {0xfd};
+
+    Publish();
+    Register();
+    mResults.clear();
+
+    // An update of a registered service is reported after announcing, and a new host after probing.
+    Publish();
+    CHECK_EQUAL(OTBR_ERROR_NONE, mPublisher.PublishHost("host", address, sizeof(address)));
+
+    mPublisher.Stop();
+    CHECK_EQUAL(2u, mResults.size());
+    CHECK_EQUAL(std::string("svc"), mResults[0].first);
+    CHECK_EQUAL(OTBR_ERROR_MDNS, mResults[0].second);
+    CHECK_EQUAL(std::string("host"), mResults[1].first);
+    CHECK_EQUAL(OTBR_ERROR_MDNS, mResults[1].second);
+}
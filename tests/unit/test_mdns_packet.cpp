@@ -0,0 +1,179 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "mdns/mdns_packet.hpp"
+
+using namespace otbr::Mdns;
+
+TEST_GROUP(MdnsPacket){};
+
+static std::string MakeName(const char *aDotted)
+{
+    std::string name;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, AppendDottedName(name, aDotted));
+
+    return name;
+}
+
+static Record MakePtrRecord(const char *aName, const char *aTarget)
+{
+    Record record;
+
+    record.mName       = MakeName(aName);
+    record.mType       = kTypePtr;
+    record.mClass      = kClassIn;
+    record.mCacheFlush = false;
+    record.mTtl        = 4500;
+    AppendNameData(record.mData, MakeName(aTarget));
+
+    return record;
+}
+
+TEST(MdnsPacket, TestNames)
+{
+    std::string name = MakeName("My Service._meshcop._udp.local.");
+
+    CHECK_EQUAL(std::string("My Service._meshcop._udp.local."), NameToString(name));
+    CHECK_EQUAL(std::string("My Service"), GetFirstNameLabel(name));
+    CHECK_EQUAL(std::string("_meshcop._udp.local."), NameToString(GetParentName(name)));
+    CHECK(IsNameEqual(name, MakeName("my service._MESHCOP._udp.local")));
+    CHECK_EQUAL(HashName(name), HashName(MakeName("MY SERVICE._meshcop._UDP.LOCAL.")));
+    CHECK(!IsNameEqual(name, MakeName("My Service._meshcop._tcp.local.")));
+
+    name.clear();
+    CHECK_EQUAL(OTBR_ERROR_NONE, AppendNameLabel(name, "a.b"));
+    CHECK_EQUAL(std::string("a.b"), GetFirstNameLabel(name));
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, AppendNameLabel(name, std::string(64, 'a')));
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, AppendDottedName(name, "a..b"));
+}
+
+TEST(MdnsPacket, TestWriteAndParse)
+{
+    uint8_t       buffer[512];
+    MessageWriter writer(buffer, sizeof(buffer));
+    Message       message;
+    Record        ptr = MakePtrRecord("_meshcop._udp.local", "br1._meshcop._udp.local");
+    Record        aaaa;
+    std::string   target;
+    uint16_t      length;
+
+    aaaa.mName       = MakeName("host.local");
+    aaaa.mType       = kTypeAaaa;
+    aaaa.mClass      = kClassIn;
+    aaaa.mCacheFlush = true;
+    aaaa.mTtl        = 120;
+    aaaa.mData.assign(16, 0xfd);
+
+    writer.Reset(0, Message::kFlagResponse | Message::kFlagAuthoritative);
+    CHECK(writer.AppendQuestion({ptr.mName, kTypePtr, kClassIn, /* mUnicastResponse */ true}));
+    CHECK(writer.AppendRecord(MessageWriter::kAnswer, ptr, ptr.mTtl));
+    CHECK(writer.AppendRecord(MessageWriter::kAdditional, aaaa, 0));
+    CHECK_EQUAL(3, writer.GetEntryCount());
+
+    // The name of the answer and the type and domain of the PTR target are compressed.
+    length = writer.GetLength();
+    CHECK(length < MessageWriter::kHeaderSize + 2 * (ptr.mName.size() + 1) + ptr.mData.size() + aaaa.mName.size());
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, message.Parse(writer.GetBuffer(), writer.GetLength()));
+    CHECK(message.IsResponse());
+    CHECK(!message.IsTruncated());
+    CHECK_EQUAL(1, message.mQuestions.size());
+    CHECK(IsNameEqual(ptr.mName, message.mQuestions[0].mName));
+    CHECK_EQUAL(kTypePtr, message.mQuestions[0].mType);
+    CHECK(message.mQuestions[0].mUnicastResponse);
+
+    CHECK_EQUAL(1, message.mAnswers.size());
+    CHECK(message.mAnswers[0].IsSameAs(ptr));
+    CHECK(!message.mAnswers[0].mCacheFlush);
+    CHECK_EQUAL(4500, message.mAnswers[0].mTtl);
+    CHECK_EQUAL(OTBR_ERROR_NONE, ReadNameData(message.mAnswers[0].mData, 0, target));
+    CHECK_EQUAL(std::string("br1._meshcop._udp.local."), NameToString(target));
+
+    CHECK_EQUAL(0, message.mAuthorities.size());
+    CHECK_EQUAL(1, message.mAdditionals.size());
+    CHECK(message.mAdditionals[0].IsSameAs(aaaa));
+    CHECK(message.mAdditionals[0].mCacheFlush);
+    CHECK_EQUAL(0, message.mAdditionals[0].mTtl);
+}
+
+TEST(MdnsPacket, TestWriteOverflow)
+{
+    uint8_t       buffer[64];
+    MessageWriter writer(buffer, sizeof(buffer));
+    Record        ptr = MakePtrRecord("_meshcop._udp.local", "a-long-instance-name._meshcop._udp.local");
+    uint16_t      length;
+
+    writer.Reset(0, Message::kFlagResponse);
+    CHECK(writer.AppendQuestion({ptr.mName, kTypePtr, kClassIn, false}));
+    length = writer.GetLength();
+
+    // A record which doesn't fit leaves the message unchanged.
+    CHECK(!writer.AppendRecord(MessageWriter::kAnswer, ptr, ptr.mTtl));
+    CHECK_EQUAL(length, writer.GetLength());
+    CHECK_EQUAL(1, writer.GetEntryCount());
+}
+
+TEST(MdnsPacket, TestCompare)
+{
+    Record first  = MakePtrRecord("a.local", "x.local");
+    Record second = MakePtrRecord("A.LOCAL", "y.local");
+
+    CHECK(first.IsSameAs(first));
+    CHECK(!first.IsSameAs(second));
+    CHECK(first.Compare(second) < 0);
+    CHECK(second.Compare(first) > 0);
+
+    second.mData = first.mData;
+    CHECK(first.IsSameAs(second));
+    CHECK_EQUAL(0, first.Compare(second));
+}
+
+TEST(MdnsPacket, TestParseMalformed)
+{
+    Message message;
+
+    // A truncated header.
+    const uint8_t kShort[] = {0, 0, 0x84, 0};
+    // A question count which can't fit in the message.
+    const uint8_t kBadCount[] = {0, 0, 0, 0, 0xff, 0xff, 0, 0, 0, 0, 0, 0};
+    // A question whose name points to itself.
+    const uint8_t kLoop[] = {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0xc0, 12, 0, 1, 0, 1};
+    // A question whose name points forwards.
+    const uint8_t kForward[] = {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0xc0, 18, 0, 1, 0, 1, 0};
+    // A record whose data length exceeds the message.
+    const uint8_t kBadLength[] = {0, 0, 0x84, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 'a', 0, 0, 1, 0, 1, 0, 0, 0, 120, 0, 16};
+
+    CHECK_EQUAL(OTBR_ERROR_PARSE, message.Parse(kShort, sizeof(kShort)));
+    CHECK_EQUAL(OTBR_ERROR_PARSE, message.Parse(kBadCount, sizeof(kBadCount)));
+    CHECK_EQUAL(OTBR_ERROR_PARSE, message.Parse(kLoop, sizeof(kLoop)));
+    CHECK_EQUAL(OTBR_ERROR_PARSE, message.Parse(kForward, sizeof(kForward)));
+    CHECK_EQUAL(OTBR_ERROR_PARSE, message.Parse(kBadLength, sizeof(kBadLength)));
+}
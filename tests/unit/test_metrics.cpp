@@ -0,0 +1,153 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/mainloop_profiler.hpp"
+#include "common/metrics.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <string.h>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::Microseconds;
+using namespace otbr::Metrics;
+
+TEST_GROUP(Metrics){};
+
+TEST(Metrics, TestCounterFromThreads)
+{
+    Counter                  counter("otbr_test_counter_total", "Test counter.");
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < 4; i++)
+    {
+        threads.emplace_back([&counter]() {
+            for (int j = 0; j < 1000; j++)
+            {
+                counter.Increment();
+            }
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    CHECK_EQUAL(4000, counter.GetValue());
+}
+
+TEST(Metrics, TestSerialize)
+{
+    std::string output;
+
+    {
+        Gauge     gauge("otbr_test_gauge", "Test gauge.");
+        Histogram histogram("otbr_test_duration_seconds", "Test histogram.", {Microseconds(1000), Microseconds(10000)});
+
+        gauge.Set(5);
+        gauge.Add(-2);
+        histogram.Observe(Microseconds(500));
+        histogram.Observe(Microseconds(5000));
+        histogram.Observe(Microseconds(50000));
+
+        output = Registry::Get().Serialize();
+
+        CHECK(output.find("# TYPE otbr_test_gauge gauge\notbr_test_gauge 3\n") != std::string::npos);
+        CHECK(output.find("otbr_test_duration_seconds_bucket{le=\"0.001\"} 1\n") != std::string::npos);
+        CHECK(output.find("otbr_test_duration_seconds_bucket{le=\"0.01\"} 2\n") != std::string::npos);
+        CHECK(output.find("otbr_test_duration_seconds_bucket{le=\"+Inf\"} 3\n") != std::string::npos);
+        CHECK(output.find("otbr_test_duration_seconds_sum 0.055500\n") != std::string::npos);
+        CHECK(output.find("otbr_test_duration_seconds_count 3\n") != std::string::npos);
+    }
+
+    output = Registry::Get().Serialize();
+    CHECK(output.find("otbr_test_gauge") == std::string::npos);
+}
+
+TEST(Metrics, TestMainloopProfiler)
+{
+    static otbr::MainloopProfiler::Site site("TestHandler");
+    otbr::MainloopProfiler &            profiler = otbr::MainloopProfiler::Get();
+    uint64_t                            count    = 0;
+
+    profiler.SetSlowThreshold(otbr::Milliseconds(1));
+    profiler.Record(site, Microseconds(500));
+    profiler.Record(site, Microseconds(2000));
+
+    for (const otbr::MainloopProfiler::HandlerStats &stats : profiler.GetStats())
+    {
+        if (strcmp(stats.mName, "TestHandler") == 0)
+        {
+            count = stats.mCount;
+            CHECK_EQUAL(1, stats.mSlowCount);
+            CHECK(stats.mMax == Microseconds(2000));
+            CHECK(stats.mTotal == Microseconds(2500));
+        }
+    }
+
+    CHECK_EQUAL(2, count);
+    CHECK(Registry::Get().Serialize().find(
+              "otbr_mainloop_handler_duration_seconds_count{handler=\"TestHandler\"} 2\n") != std::string::npos);
+}
+
+TEST(Metrics, TestMainloopProfilerNestedSections)
+{
+    otbr::MainloopProfiler &profiler = otbr::MainloopProfiler::Get();
+    Microseconds            outer    = Microseconds::zero();
+    Microseconds            inner    = Microseconds::zero();
+
+    profiler.SetSlowThreshold(otbr::Milliseconds(0));
+
+    {
+        OTBR_PROFILE_SECTION("TestOuterHandler");
+        {
+            OTBR_PROFILE_SECTION("TestInnerHandler");
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+    }
+
+    for (const otbr::MainloopProfiler::HandlerStats &stats : profiler.GetStats())
+    {
+        if (strcmp(stats.mName, "TestOuterHandler") == 0)
+        {
+            outer = stats.mTotal;
+        }
+        else if (strcmp(stats.mName, "TestInnerHandler") == 0)
+        {
+            inner = stats.mTotal;
+        }
+    }
+
+    // The time of the inner handler isn't counted again for the outer handler.
+    CHECK(inner >= otbr::Milliseconds(50));
+    CHECK(outer < otbr::Milliseconds(25));
+}
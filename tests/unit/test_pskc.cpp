@@ -46,3 +46,33 @@ TEST(Pskc, Test123456_0001020304050607_OpenThread)
     pskc = mPSKc.ComputePskc(extpanid, "OpenThread", "123456");
     MEMCMP_EQUAL(expected, pskc, sizeof(expected));
 }
+
+TEST(Pskc, TestPskcServiceBatchAndCache)
+{
+    uint8_t expected[] = {
+        0xb7, 0x83, 0x81, 0x27, 0x89, 0x91, 0x1e, 0xb4, 0xea, 0x76, 0x59, 0x6c, 0x9c, 0xed, 0x2a, 0x69,
+    };
+    otbr::Psk::PskcService                       service(2);
+    std::vector<otbr::Psk::PskcService::Request> requests(3);
+    std::vector<otbr::Psk::PskcValue>            pskcs;
+
+    for (otbr::Psk::PskcService::Request &request : requests)
+    {
+        const uint8_t extpanid[] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07};
+
+        memcpy(request.mExtPanId, extpanid, sizeof(extpanid));
+        request.mNetworkName = "OpenThread";
+        request.mPassphrase  = "123456";
+    }
+    requests[1].mPassphrase = "654321";
+
+    pskcs = service.ComputeBatch(requests);
+    CHECK_EQUAL(3, pskcs.size());
+    MEMCMP_EQUAL(expected, pskcs[0].data(), sizeof(expected));
+    MEMCMP_EQUAL(expected, pskcs[2].data(), sizeof(expected));
+    CHECK(pskcs[0] != pskcs[1]);
+
+    // A cached result is ready immediately.
+    CHECK(service.ComputeAsync(requests[1].mExtPanId, "OpenThread", "654321").wait_for(std::chrono::seconds(0)) ==
+          std::future_status::ready);
+}
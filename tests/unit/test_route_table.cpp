@@ -0,0 +1,269 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/route_table.hpp"
+
+#include <stdlib.h>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::Ip6Address;
+using otbr::Ip6Prefix;
+using otbr::Route;
+using otbr::RouteTable;
+
+TEST_GROUP(RouteTable){};
+
+static Route MakeRoute(const char *aPrefix, uint8_t aLength, uint16_t aRloc16, int8_t aPreference = 0)
+{
+    Route route;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, Ip6Address::FromString(aPrefix, route.mPrefix.mPrefix));
+    route.mPrefix.mLength = aLength;
+    route.mRloc16         = aRloc16;
+    route.mPreference     = aPreference;
+
+    return route;
+}
+
+static const Route *Lookup(const RouteTable &aTable, const char *aAddress)
+{
+    Ip6Address address;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, Ip6Address::FromString(aAddress, address));
+
+    return aTable.Lookup(address);
+}
+
+TEST(RouteTable, TestLongestPrefixMatch)
+{
+    RouteTable   table;
+    const Route *route;
+
+    CHECK(Lookup(table, "2001:db8::1") == nullptr);
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, table.Add(MakeRoute("::", 0, 0x1000)));
+    CHECK_EQUAL(OTBR_ERROR_NONE, table.Add(MakeRoute("2001:db8::", 32, 0x2000)));
+    CHECK_EQUAL(OTBR_ERROR_NONE, table.Add(MakeRoute("2001:db8:1::", 48, 0x3000)));
+    CHECK_EQUAL(OTBR_ERROR_NONE, table.Add(MakeRoute("fd00:1234::", 64, 0x4000)));
+    CHECK_EQUAL(4, table.GetSize());
+
+    route = Lookup(table, "2001:db8:1::1");
+    CHECK(route != nullptr);
+    CHECK_EQUAL(0x3000, route->mRloc16);
+
+    route = Lookup(table, "2001:db8:2::1");
+    CHECK(route != nullptr);
+    CHECK_EQUAL(0x2000, route->mRloc16);
+
+    route = Lookup(table, "fd00:1234::1");
+    CHECK(route != nullptr);
+    CHECK_EQUAL(0x4000, route->mRloc16);
+
+    route = Lookup(table, "fd00:1235::1");
+    CHECK(route != nullptr);
+    CHECK_EQUAL(0x1000, route->mRloc16);
+}
+
+TEST(RouteTable, TestPreference)
+{
+    RouteTable   table;
+    const Route *route;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, table.Add(MakeRoute("2001:db8::", 32, 0x1000, -1)));
+    CHECK_EQUAL(OTBR_ERROR_NONE, table.Add(MakeRoute("2001:db8::", 32, 0x2000, 1)));
+    CHECK_EQUAL(OTBR_ERROR_NONE, table.Add(MakeRoute("2001:db8::", 32, 0x3000, 0)));
+
+    route = Lookup(table, "2001:db8::1");
+    CHECK(route != nullptr);
+    CHECK_EQUAL(0x2000, route->mRloc16);
+
+    // Adding the same entry again replaces it.
+    CHECK_EQUAL(OTBR_ERROR_NONE, table.Add(MakeRoute("2001:db8::", 32, 0x2000, -1)));
+    CHECK_EQUAL(3, table.GetSize());
+
+    route = Lookup(table, "2001:db8::1");
+    CHECK(route != nullptr);
+    CHECK_EQUAL(0x3000, route->mRloc16);
+}
+
+TEST(RouteTable, TestOnMeshPrecedence)
+{
+    RouteTable   table;
+    Route        onMesh = MakeRoute("fd00:1234:5678::", 64, 0x2000, -1);
+    const Route *route;
+
+    onMesh.mOnMesh = true;
+    CHECK_EQUAL(OTBR_ERROR_NONE, table.Add(MakeRoute("fd00::", 16, 0x1000, 1)));
+    CHECK_EQUAL(OTBR_ERROR_NONE, table.Add(onMesh));
+
+    // A more specific on-mesh prefix wins over a covering external route of higher preference.
+    route = Lookup(table, "fd00:1234:5678::1");
+    CHECK(route != nullptr);
+    CHECK(route->mOnMesh);
+    CHECK_EQUAL(0x2000, route->mRloc16);
+
+    route = Lookup(table, "fd00:1234:5679::1");
+    CHECK(route != nullptr);
+    CHECK_FALSE(route->mOnMesh);
+
+    // On the same prefix, the on-mesh prefix wins whatever the preferences.
+    CHECK_EQUAL(OTBR_ERROR_NONE, table.Add(MakeRoute("fd00:1234:5678::", 64, 0x3000, 1)));
+    route = Lookup(table, "fd00:1234:5678::1");
+    CHECK(route != nullptr);
+    CHECK_EQUAL(0x2000, route->mRloc16);
+}
+
+TEST(RouteTable, TestAddMasksPrefix)
+{
+    RouteTable                table;
+    Ip6Prefix                 prefix;
+    const std::vector<Route> *routes;
+
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, table.Add(MakeRoute("2001:db8::", 129, 0x1000)));
+    CHECK_EQUAL(OTBR_ERROR_NONE, table.Add(MakeRoute("2001:db8:ffff::1", 36, 0x1000)));
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, Ip6Address::FromString("2001:db8:f000::", prefix.mPrefix));
+    prefix.mLength = 36;
+    routes = table.Find(prefix);
+    CHECK(routes != nullptr);
+    CHECK_EQUAL(1, routes->size());
+    STRCMP_EQUAL("2001:db8:f000::/36", routes->front().mPrefix.ToString().c_str());
+}
+
+TEST(RouteTable, TestRemove)
+{
+    RouteTable table;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, table.Add(MakeRoute("2001:db8::", 32, 0x1000)));
+    CHECK_EQUAL(OTBR_ERROR_NONE, table.Add(MakeRoute("2001:db8:1::", 48, 0x2000)));
+    CHECK_EQUAL(OTBR_ERROR_NONE, table.Add(MakeRoute("2001:db8:2::", 48, 0x3000)));
+
+    CHECK_EQUAL(OTBR_ERROR_NOT_FOUND, table.Remove(MakeRoute("2001:db8::", 32, 0x2000)));
+    CHECK_EQUAL(OTBR_ERROR_NOT_FOUND, table.Remove(MakeRoute("2001:db8:3::", 48, 0x1000)));
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, table.Remove(MakeRoute("2001:db8:1::", 48, 0x2000)));
+    CHECK_EQUAL(0x1000, Lookup(table, "2001:db8:1::1")->mRloc16);
+    CHECK_EQUAL(0x3000, Lookup(table, "2001:db8:2::1")->mRloc16);
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, table.Remove(MakeRoute("2001:db8::", 32, 0x1000)));
+    CHECK(Lookup(table, "2001:db8:1::1") == nullptr);
+    CHECK_EQUAL(0x3000, Lookup(table, "2001:db8:2::1")->mRloc16);
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, table.Remove(MakeRoute("2001:db8:2::", 48, 0x3000)));
+    CHECK_EQUAL(0, table.GetSize());
+    CHECK(table.GetRoutes().empty());
+}
+
+TEST(RouteTable, TestDiff)
+{
+    RouteTable         oldTable;
+    RouteTable         newTable;
+    std::vector<Route> added;
+    std::vector<Route> removed;
+
+    oldTable.Add(MakeRoute("2001:db8:1::", 48, 0x1000));
+    oldTable.Add(MakeRoute("2001:db8:2::", 48, 0x1000));
+    oldTable.Add(MakeRoute("2001:db8:3::", 48, 0x1000, 0));
+
+    newTable.Add(MakeRoute("2001:db8:1::", 48, 0x1000));
+    newTable.Add(MakeRoute("2001:db8:3::", 48, 0x1000, 1));
+    newTable.Add(MakeRoute("2001:db8:4::", 48, 0x1000));
+
+    RouteTable::Diff(oldTable, newTable, added, removed);
+
+    CHECK_EQUAL(2, added.size());
+    CHECK_EQUAL(1, removed.size());
+    STRCMP_EQUAL("2001:db8:2::/48", removed[0].mPrefix.ToString().c_str());
+}
+
+TEST(RouteTable, TestLookupMatchesLinearScan)
+{
+    RouteTable         table;
+    std::vector<Route> routes;
+
+    srand(0);
+
+    // Prefixes share the first bytes so that the trie gets deep and branchy.
+    for (int i = 0; i < 200; i++)
+    {
+        Route route;
+
+        route.mPrefix.mPrefix.m8[0] = 0xfd;
+        route.mPrefix.mPrefix.m8[1] = rand() % 4;
+        route.mPrefix.mPrefix.m8[2] = rand() % 256;
+        route.mPrefix.mLength       = 8 + rand() % 25;
+        route.mRloc16               = static_cast<uint16_t>(i);
+
+        CHECK_EQUAL(OTBR_ERROR_NONE, table.Add(route));
+    }
+
+    routes = table.GetRoutes();
+    CHECK_EQUAL(routes.size(), table.GetSize());
+
+    for (int i = 0; i < 1000; i++)
+    {
+        Ip6Address   address;
+        const Route *expected = nullptr;
+        const Route *actual;
+
+        address.m8[0] = 0xfd;
+        address.m8[1] = rand() % 4;
+        address.m8[2] = rand() % 256;
+        address.m8[3] = rand() % 256;
+
+        for (const Route &route : routes)
+        {
+            if (route.mPrefix.ContainsAddress(address) &&
+                (expected == nullptr || route.mPrefix.mLength > expected->mPrefix.mLength))
+            {
+                expected = &route;
+            }
+        }
+
+        actual = table.Lookup(address);
+
+        if (expected == nullptr)
+        {
+            CHECK(actual == nullptr);
+        }
+        else
+        {
+            CHECK(actual != nullptr);
+            CHECK_EQUAL(expected->mPrefix.mLength, actual->mPrefix.mLength);
+            CHECK(expected->mPrefix == actual->mPrefix);
+        }
+    }
+
+    for (const Route &route : routes)
+    {
+        CHECK_EQUAL(OTBR_ERROR_NONE, table.Remove(route));
+    }
+
+    CHECK_EQUAL(0, table.GetSize());
+}
@@ -0,0 +1,218 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "agent/srp_snapshot.cpp"
+
+using otbr::SrpSnapshot;
+
+// The offsets of the two slots in the snapshot file.
+static constexpr long kSlotOffsets[] = {4096, 4096 + 64 * 1024};
+
+static std::vector<SrpSnapshot::Host> MakeHosts(size_t aCount)
+{
+    std::vector<SrpSnapshot::Host> hosts;
+
+    for (size_t i = 0; i < aCount; i++)
+    {
+        hosts.push_back({"host" + std::to_string(i), std::vector<uint8_t>(16, static_cast<uint8_t>(i)), 1000 + i});
+    }
+
+    return hosts;
+}
+
+static std::vector<SrpSnapshot::Service> MakeServices(size_t aCount, size_t aTxtLength = 32)
+{
+    std::vector<SrpSnapshot::Service> services;
+
+    for (size_t i = 0; i < aCount; i++)
+    {
+        services.push_back({"service" + std::to_string(i), "_test._udp", "host" + std::to_string(i),
+                            static_cast<uint16_t>(10000 + i), std::vector<uint8_t>(aTxtLength, 'a'), 2000 + i});
+    }
+
+    return services;
+}
+
+static void CorruptSlot(const char *aPath, uint8_t aIndex)
+{
+    FILE *file = fopen(aPath, "r+b");
+
+    CHECK(file != nullptr);
+    // Flip a byte of the payload, right after the slot header.
+    CHECK_EQUAL(0, fseek(file, kSlotOffsets[aIndex] + 20, SEEK_SET));
+    CHECK(fputc(0x55, file) != EOF);
+    CHECK_EQUAL(0, fclose(file));
+}
+
+TEST_GROUP(SrpSnapshot)
+{
+    char mPath[32];
+
+    void setup()
+    {
+        int fd;
+
+        strcpy(mPath, "/tmp/srp-snapshot-XXXXXX");
+        fd = mkstemp(mPath);
+        CHECK(fd != -1);
+        close(fd);
+    }
+
+    void teardown() { unlink(mPath); }
+};
+
+TEST(SrpSnapshot, TestLoadEmpty)
+{
+    SrpSnapshot                       snapshot;
+    std::vector<SrpSnapshot::Host>    hosts;
+    std::vector<SrpSnapshot::Service> services;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, snapshot.Open(mPath));
+    CHECK_EQUAL(OTBR_ERROR_NOT_FOUND, snapshot.Load(hosts, services));
+}
+
+TEST(SrpSnapshot, TestRoundTrip)
+{
+    SrpSnapshot                       snapshot;
+    std::vector<SrpSnapshot::Host>    hosts;
+    std::vector<SrpSnapshot::Service> services;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, snapshot.Open(mPath));
+    CHECK_EQUAL(OTBR_ERROR_NONE, snapshot.Save(MakeHosts(3), MakeServices(2)));
+    snapshot.Close();
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, snapshot.Open(mPath));
+    CHECK_EQUAL(OTBR_ERROR_NONE, snapshot.Load(hosts, services));
+
+    CHECK_EQUAL(3, hosts.size());
+    STRCMP_EQUAL("host2", hosts[2].mName.c_str());
+    CHECK(hosts[2].mAddress == std::vector<uint8_t>(16, 2));
+    CHECK_EQUAL(1002, hosts[2].mExpireTime);
+
+    CHECK_EQUAL(2, services.size());
+    STRCMP_EQUAL("service1", services[1].mName.c_str());
+    STRCMP_EQUAL("_test._udp", services[1].mType.c_str());
+    STRCMP_EQUAL("host1", services[1].mHostName.c_str());
+    CHECK_EQUAL(10001, services[1].mPort);
+    CHECK(services[1].mTxtData == std::vector<uint8_t>(32, 'a'));
+    CHECK_EQUAL(2001, services[1].mExpireTime);
+}
+
+TEST(SrpSnapshot, TestSlotAlternation)
+{
+    SrpSnapshot                       snapshot;
+    std::vector<SrpSnapshot::Host>    hosts;
+    std::vector<SrpSnapshot::Service> services;
+
+    // The saves go to slot 0, slot 1 and slot 0 again.
+    CHECK_EQUAL(OTBR_ERROR_NONE, snapshot.Open(mPath));
+    CHECK_EQUAL(OTBR_ERROR_NONE, snapshot.Save(MakeHosts(1), {}));
+    CHECK_EQUAL(OTBR_ERROR_NONE, snapshot.Save(MakeHosts(2), {}));
+    CHECK_EQUAL(OTBR_ERROR_NONE, snapshot.Save(MakeHosts(3), {}));
+    CHECK_EQUAL(OTBR_ERROR_NONE, snapshot.Load(hosts, services));
+    CHECK_EQUAL(3, hosts.size());
+    snapshot.Close();
+
+    // A corrupted latest slot falls back to the previous snapshot.
+    CorruptSlot(mPath, 0);
+    hosts.clear();
+    CHECK_EQUAL(OTBR_ERROR_NONE, snapshot.Open(mPath));
+    CHECK_EQUAL(OTBR_ERROR_NONE, snapshot.Load(hosts, services));
+    CHECK_EQUAL(2, hosts.size());
+
+    // The next save replaces the corrupted slot rather than the valid one.
+    CHECK_EQUAL(OTBR_ERROR_NONE, snapshot.Save(MakeHosts(4), {}));
+    snapshot.Close();
+    CorruptSlot(mPath, 0);
+    hosts.clear();
+    CHECK_EQUAL(OTBR_ERROR_NONE, snapshot.Open(mPath));
+    CHECK_EQUAL(OTBR_ERROR_NONE, snapshot.Load(hosts, services));
+    CHECK_EQUAL(2, hosts.size());
+
+    // With both slots corrupted there is no snapshot.
+    snapshot.Close();
+    CorruptSlot(mPath, 1);
+    CHECK_EQUAL(OTBR_ERROR_NONE, snapshot.Open(mPath));
+    CHECK_EQUAL(OTBR_ERROR_NOT_FOUND, snapshot.Load(hosts, services));
+}
+
+TEST(SrpSnapshot, TestOverflow)
+{
+    SrpSnapshot                       snapshot;
+    std::vector<SrpSnapshot::Host>    hosts;
+    std::vector<SrpSnapshot::Service> services;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, snapshot.Open(mPath));
+    CHECK_EQUAL(OTBR_ERROR_NONE, snapshot.Save(MakeHosts(1), {}));
+    CHECK_EQUAL(OTBR_ERROR_NONE, snapshot.Save(MakeHosts(2), {}));
+
+    // The services don't fit into a slot, and neither of the stale snapshots is restored.
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, snapshot.Save({}, MakeServices(300, 300)));
+    CHECK_EQUAL(OTBR_ERROR_NOT_FOUND, snapshot.Load(hosts, services));
+    snapshot.Close();
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, snapshot.Open(mPath));
+    CHECK_EQUAL(OTBR_ERROR_NOT_FOUND, snapshot.Load(hosts, services));
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, snapshot.Save(MakeHosts(1), {}));
+    CHECK_EQUAL(OTBR_ERROR_NONE, snapshot.Load(hosts, services));
+    CHECK_EQUAL(1, hosts.size());
+}
+
+TEST(SrpSnapshot, TestFindLeftOutServices)
+{
+    std::map<SrpSnapshot::ServiceKey, SrpSnapshot::Service> restored;
+    std::vector<SrpSnapshot::ServiceKey>                    leftOut;
+
+    // host0 had three services and host1 one when the snapshot was taken.
+    for (const char *name : {"a", "b", "c"})
+    {
+        restored[{name, "_test._udp"}] = {name, "_test._udp", "host0", 1234, {}, 2000};
+    }
+    restored[{"d", "_test._udp"}] = {"d", "_test._udp", "host1", 1234, {}, 2000};
+
+    // host0 registers again with one of its services only.
+    leftOut = SrpSnapshot::FindLeftOutServices(restored, "host0", {{"a", "_test._udp"}});
+    CHECK_EQUAL(2, leftOut.size());
+    CHECK(leftOut[0] == SrpSnapshot::ServiceKey("b", "_test._udp"));
+    CHECK(leftOut[1] == SrpSnapshot::ServiceKey("c", "_test._udp"));
+
+    // A service of the same name but of another type is a different service.
+    leftOut = SrpSnapshot::FindLeftOutServices(restored, "host1", {{"d", "_other._udp"}});
+    CHECK_EQUAL(1, leftOut.size());
+
+    CHECK(SrpSnapshot::FindLeftOutServices(restored, "host1", {{"d", "_test._udp"}}).empty());
+    CHECK(SrpSnapshot::FindLeftOutServices(restored, "host2", {}).empty());
+}
@@ -0,0 +1,139 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <vector>
+
+#include "utils/steering_data.hpp"
+
+using otbr::SteeringData;
+
+// The joiner ids of EUI64s 18:b4:30:00:00:00:00:01 to 18:b4:30:00:00:00:00:0a.
+static std::vector<uint8_t> MakeJoinerIds(size_t aCount)
+{
+    std::vector<uint8_t> joinerIds(aCount * SteeringData::kSizeJoinerId);
+
+    for (size_t i = 0; i < aCount; i++)
+    {
+        uint8_t *eui64 = &joinerIds[i * SteeringData::kSizeJoinerId];
+
+        eui64[0] = 0x18;
+        eui64[1] = 0xb4;
+        eui64[2] = 0x30;
+        eui64[6] = static_cast<uint8_t>((i + 1) >> 8);
+        eui64[7] = static_cast<uint8_t>(i + 1);
+    }
+
+    SteeringData::ComputeJoinerIds(joinerIds.data(), joinerIds.data(), aCount);
+
+    return joinerIds;
+}
+
+TEST_GROUP(SteeringData){};
+
+TEST(SteeringData, TestComputeJoinerId)
+{
+    const uint8_t eui64[]    = {0x18, 0xb4, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01};
+    const uint8_t expected[] = {0xcf, 0xe0, 0xd8, 0xdd, 0x4e, 0xfc, 0x29, 0x73};
+    uint8_t       joinerId[SteeringData::kSizeJoinerId];
+
+    SteeringData::ComputeJoinerId(eui64, joinerId);
+    MEMCMP_EQUAL(expected, joinerId, sizeof(expected));
+}
+
+TEST(SteeringData, TestComputeJoinerIds)
+{
+    // Enough EUI64s to be split across threads.
+    const size_t         kCount = 1000;
+    std::vector<uint8_t> eui64s(kCount * SteeringData::kSizeJoinerId);
+    std::vector<uint8_t> joinerIds(eui64s.size());
+
+    for (size_t i = 0; i < eui64s.size(); i++)
+    {
+        eui64s[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    SteeringData::ComputeJoinerIds(eui64s.data(), joinerIds.data(), kCount);
+
+    for (size_t i = 0; i < kCount; i++)
+    {
+        uint8_t joinerId[SteeringData::kSizeJoinerId];
+
+        SteeringData::ComputeJoinerId(&eui64s[i * SteeringData::kSizeJoinerId], joinerId);
+        MEMCMP_EQUAL(joinerId, &joinerIds[i * SteeringData::kSizeJoinerId], sizeof(joinerId));
+    }
+
+    // The joiner ids can be computed in place.
+    SteeringData::ComputeJoinerIds(eui64s.data(), eui64s.data(), kCount);
+    CHECK(eui64s == joinerIds);
+}
+
+TEST(SteeringData, TestComputeBloomFilter)
+{
+    // CRC16-CCITT of the joiner id sets bit 97, CRC16-ANSI sets bit 2.
+    const uint8_t        expected[] = {0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+                                0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04};
+    std::vector<uint8_t> joinerIds = MakeJoinerIds(1);
+    SteeringData         steeringData;
+
+    steeringData.Init(sizeof(expected));
+    steeringData.ComputeBloomFilter(joinerIds.data());
+    MEMCMP_EQUAL(expected, steeringData.GetBloomFilter(), sizeof(expected));
+    CHECK_EQUAL(2.0 / 128, steeringData.GetFillRatio());
+    CHECK_EQUAL(2.0 / 128 * 2.0 / 128, steeringData.GetFalsePositiveRate());
+}
+
+TEST(SteeringData, TestFillRatio)
+{
+    std::vector<uint8_t> joinerIds = MakeJoinerIds(10);
+    SteeringData         steeringData;
+
+    steeringData.Init(0);
+    CHECK_EQUAL(0.0, steeringData.GetFillRatio());
+
+    steeringData.Init(8);
+    CHECK_EQUAL(0.0, steeringData.GetFillRatio());
+    steeringData.ComputeBloomFilter(joinerIds.data(), 10);
+    CHECK_EQUAL(17.0 / 64, steeringData.GetFillRatio());
+    CHECK_EQUAL(17.0 / 64 * 17.0 / 64, steeringData.GetFalsePositiveRate());
+
+    steeringData.Set();
+    CHECK_EQUAL(1.0, steeringData.GetFillRatio());
+}
+
+TEST(SteeringData, TestFindOptimalLength)
+{
+    std::vector<uint8_t> joinerIds = MakeJoinerIds(10);
+
+    // The false positive rate of the 10 joiners is 0.103 with 7 bytes, 0.071 with 8 bytes and 0.045 with 10 bytes.
+    CHECK_EQUAL(1, SteeringData::FindOptimalLength(joinerIds.data(), 10, 1.0));
+    CHECK_EQUAL(8, SteeringData::FindOptimalLength(joinerIds.data(), 10, 0.1));
+    CHECK_EQUAL(10, SteeringData::FindOptimalLength(joinerIds.data(), 10, 0.05));
+    CHECK_EQUAL(SteeringData::kMaxSizeOfBloomFilter, SteeringData::FindOptimalLength(joinerIds.data(), 10, 0.01));
+}
@@ -0,0 +1,124 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mdns/subscription_pool.hpp"
+
+#include <string>
+#include <vector>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::Mdns::SubscriptionPool;
+
+namespace {
+
+struct TestSubscription
+{
+    explicit TestSubscription(std::string aName, int &aCount)
+        : mName(std::move(aName))
+        , mCount(aCount)
+    {
+        mCount++;
+    }
+
+    ~TestSubscription(void) { mCount--; }
+
+    std::string mName;
+    int &       mCount;
+};
+
+typedef SubscriptionPool<std::string, TestSubscription> TestPool;
+
+} // namespace
+
+TEST_GROUP(SubscriptionPool){};
+
+TEST(SubscriptionPool, TestSharedSubscription)
+{
+    TestPool         pool;
+    int              count = 0;
+    bool             isNew;
+    TestPool::Handle first;
+    TestPool::Handle second;
+
+    first = pool.Acquire("a", [&]() { return new TestSubscription("a", count); }, isNew);
+    CHECK_TRUE(isNew);
+    second = pool.Acquire("a", [&]() { return new TestSubscription("a", count); }, isNew);
+    CHECK_FALSE(isNew);
+
+    CHECK_EQUAL(1, count);
+    CHECK_EQUAL(1u, pool.GetSize());
+    CHECK_TRUE(&TestPool::Get(first) == &TestPool::Get(second));
+    CHECK_EQUAL(2u, TestPool::GetRefCount(first));
+
+    CHECK_TRUE(pool.Release(first) == nullptr);
+    CHECK_EQUAL(1, count);
+    CHECK_TRUE(pool.IsValid(pool.Find("a")));
+
+    {
+        std::unique_ptr<TestSubscription> last = pool.Release(second);
+
+        CHECK_TRUE(last != nullptr);
+        CHECK_EQUAL("a", last->mName);
+        CHECK_FALSE(pool.IsValid(pool.Find("a")));
+        CHECK_EQUAL(0u, pool.GetSize());
+    }
+    CHECK_EQUAL(0, count);
+}
+
+TEST(SubscriptionPool, TestStableAddresses)
+{
+    TestPool                        pool;
+    int                             count = 0;
+    bool                            isNew;
+    std::vector<TestPool::Handle>   handles;
+    std::vector<TestSubscription *> subscriptions;
+
+    for (int i = 0; i < 100; i++)
+    {
+        std::string name = std::to_string(i);
+
+        handles.push_back(pool.Acquire(name, [&]() { return new TestSubscription(name, count); }, isNew));
+        subscriptions.push_back(&TestPool::Get(handles.back()));
+    }
+
+    // Releasing every other subscription must not move the remaining ones.
+    for (size_t i = 0; i < handles.size(); i += 2)
+    {
+        pool.Release(handles[i]);
+    }
+    CHECK_EQUAL(50, count);
+
+    for (size_t i = 1; i < handles.size(); i += 2)
+    {
+        CHECK_TRUE(&TestPool::Get(pool.Find(std::to_string(i))) == subscriptions[i]);
+        CHECK_TRUE(&TestPool::Get(handles[i]) == subscriptions[i]);
+    }
+
+    pool.ForEach([](TestSubscription &aSubscription) { CHECK_TRUE(std::stoi(aSubscription.mName) % 2 == 1); });
+}
@@ -0,0 +1,136 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/tlv.hpp"
+
+#include <string.h>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::TlvInfo;
+using otbr::TlvReader;
+using otbr::TlvWriter;
+
+TEST_GROUP(Tlv){};
+
+TEST(Tlv, TestWriteAndRead)
+{
+    uint8_t   buffer[600];
+    uint8_t   name[300];
+    TlvWriter writer(buffer, sizeof(buffer));
+    TlvInfo   tlv;
+    uint16_t  panId;
+    uint64_t  timestamp;
+    size_t    count = 0;
+
+    memset(name, 'x', sizeof(name));
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, writer.AppendUint16(otbr::Meshcop::kPanId, 0xface));
+    CHECK_EQUAL(OTBR_ERROR_NONE, writer.AppendUint64(otbr::Meshcop::kActiveTimestamp, 0x0102030405060708ULL));
+    CHECK_EQUAL(OTBR_ERROR_NONE, writer.Append(otbr::Meshcop::kNetworkName, name, sizeof(name)));
+    CHECK_EQUAL(OTBR_ERROR_NONE, writer.Append(otbr::Meshcop::kSteeringData, nullptr, 0));
+    CHECK_EQUAL(4 + 10 + 4 + sizeof(name) + 2, writer.GetLength());
+    CHECK_EQUAL(0xfa, buffer[2]);
+    CHECK_EQUAL(0xce, buffer[3]);
+
+    TlvReader reader = writer.GetReader();
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, reader.Validate());
+    CHECK_EQUAL(OTBR_ERROR_NONE, reader.FindUint16(otbr::Meshcop::kPanId, panId));
+    CHECK_EQUAL(0xface, panId);
+    CHECK_EQUAL(OTBR_ERROR_NONE, reader.FindUint64(otbr::Meshcop::kActiveTimestamp, timestamp));
+    CHECK_EQUAL(0x0102030405060708ULL, timestamp);
+    CHECK_EQUAL(OTBR_ERROR_NONE, reader.Find(otbr::Meshcop::kNetworkName, tlv));
+    CHECK_EQUAL(sizeof(name), tlv.GetLength());
+    MEMCMP_EQUAL(name, tlv.GetValue(), sizeof(name));
+    CHECK_EQUAL(OTBR_ERROR_PARSE, reader.FindUint16(otbr::Meshcop::kSteeringData, panId));
+    CHECK_EQUAL(OTBR_ERROR_NOT_FOUND, reader.Find(otbr::Meshcop::kChannel, tlv));
+
+    for (const TlvInfo &info : reader)
+    {
+        (void)info;
+        count++;
+    }
+    CHECK_EQUAL(4, count);
+}
+
+TEST(Tlv, TestWriterOverflow)
+{
+    uint8_t   buffer[6];
+    TlvWriter writer(buffer, sizeof(buffer));
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, writer.AppendUint16(otbr::Meshcop::kPanId, 1));
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, writer.AppendUint8(otbr::Meshcop::kChannel, 11));
+    CHECK_EQUAL(4, writer.GetLength());
+    CHECK_EQUAL(OTBR_ERROR_NONE, writer.Append(otbr::Meshcop::kSteeringData, nullptr, 0));
+    CHECK_EQUAL(6, writer.GetLength());
+}
+
+TEST(Tlv, TestMalformed)
+{
+    const uint8_t truncatedValue[]  = {0x01, 0x02, 0xfa, 0xce, 0x03, 0x05, 'a'};
+    const uint8_t truncatedHeader[] = {0x01, 0x02, 0xfa, 0xce, 0x03, 0xff, 0x01};
+    const uint8_t oneByte[]         = {0x01};
+    TlvInfo       tlv;
+    uint16_t      panId;
+    size_t        count = 0;
+
+    TlvReader reader(truncatedValue, sizeof(truncatedValue));
+
+    CHECK_EQUAL(OTBR_ERROR_PARSE, reader.Validate());
+    CHECK_EQUAL(OTBR_ERROR_NONE, reader.FindUint16(otbr::Meshcop::kPanId, panId));
+    CHECK_EQUAL(0xface, panId);
+    CHECK_EQUAL(OTBR_ERROR_PARSE, reader.Find(otbr::Meshcop::kNetworkName, tlv));
+
+    for (TlvReader::Iterator it = reader.begin(); it != reader.end(); ++it)
+    {
+        count++;
+    }
+    CHECK_EQUAL(1, count);
+
+    CHECK_EQUAL(OTBR_ERROR_PARSE, TlvReader(truncatedHeader, sizeof(truncatedHeader)).Validate());
+    CHECK_EQUAL(OTBR_ERROR_PARSE, TlvReader(oneByte, sizeof(oneByte)).Validate());
+    CHECK_EQUAL(OTBR_ERROR_NONE, TlvReader(nullptr, 10).Validate());
+    CHECK(TlvReader(oneByte, sizeof(oneByte)).begin() == TlvReader(oneByte, 0).end());
+}
+
+TEST(Tlv, TestSetValue)
+{
+    uint8_t    buffer[8];
+    otbr::Tlv *tlv = reinterpret_cast<otbr::Tlv *>(buffer);
+    uint8_t    value;
+
+    tlv->SetType(otbr::Meshcop::kState);
+    tlv->SetValue(static_cast<int8_t>(otbr::Meshcop::kStateRejected));
+    CHECK_EQUAL(1, tlv->GetLength());
+    CHECK_EQUAL(0xff, tlv->GetValueUInt8());
+
+    tlv->SetValue(static_cast<uint8_t>(0x5a));
+    CHECK_EQUAL(OTBR_ERROR_NONE, TlvReader(buffer, 3).FindUint8(otbr::Meshcop::kState, value));
+    CHECK_EQUAL(0x5a, value);
+}
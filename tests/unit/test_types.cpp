@@ -0,0 +1,134 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/types.hpp"
+
+#include <arpa/inet.h>
+#include <stdlib.h>
+
+#include <unordered_set>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::Ip6Address;
+using otbr::Ip6AddressString;
+using otbr::Ip6Prefix;
+
+TEST_GROUP(Ip6Address){};
+
+static void CheckIp6AddressString(const char *aText)
+{
+    Ip6Address address;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, Ip6Address::FromString(aText, address));
+    STRCMP_EQUAL(aText, Ip6AddressString(address).AsCString());
+    CHECK_EQUAL(strlen(aText), Ip6AddressString(address).GetLength());
+    STRCMP_EQUAL(aText, address.ToString().c_str());
+}
+
+TEST(Ip6Address, TestToString)
+{
+    CheckIp6AddressString("::");
+    CheckIp6AddressString("::1");
+    CheckIp6AddressString("fe80::1");
+    CheckIp6AddressString("fd00:db8:0:1::");
+    CheckIp6AddressString("2001:db8::1:0:0:1");
+    CheckIp6AddressString("2001:db8:0:1:1:1:1:1");
+    CheckIp6AddressString("ff02::1:ff00:1234");
+    CheckIp6AddressString("ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff");
+    CheckIp6AddressString("::ffff:192.168.1.10");
+}
+
+TEST(Ip6Address, TestToStringMatchesInetNtop)
+{
+    char ref[INET6_ADDRSTRLEN];
+
+    srand(0);
+
+    for (int i = 0; i < 10000; i++)
+    {
+        Ip6Address address;
+
+        // Mostly zero groups, so that every way of compressing runs of zeros is covered.
+        for (uint16_t &group : address.m16)
+        {
+            group = (rand() % 2 == 0) ? 0 : htons(static_cast<uint16_t>(rand()));
+        }
+
+        CHECK(inet_ntop(AF_INET6, address.m8, ref, sizeof(ref)) != nullptr);
+        STRCMP_EQUAL(ref, Ip6AddressString(address).AsCString());
+    }
+}
+
+TEST(Ip6Address, TestHash)
+{
+    std::unordered_set<Ip6Address> addresses;
+    Ip6Address                     address;
+
+    for (uint16_t i = 0; i < 1000; i++)
+    {
+        CHECK_EQUAL(OTBR_ERROR_NONE, Ip6Address::FromString("fd00:db8::", address));
+        address.m16[7] = htons(i);
+        CHECK(addresses.insert(address).second);
+    }
+
+    CHECK(!addresses.insert(address).second);
+    CHECK_EQUAL(1000, addresses.size());
+    CHECK_EQUAL(1, addresses.count(address));
+}
+
+TEST_GROUP(Ip6Prefix){};
+
+TEST(Ip6Prefix, TestMatch)
+{
+    Ip6Prefix  prefix;
+    Ip6Prefix  subnet;
+    Ip6Address address;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, Ip6Address::FromString("fd00:db8:1::", prefix.mPrefix));
+    prefix.mLength = 32;
+    STRCMP_EQUAL("fd00:db8:1::/32", prefix.ToString().c_str());
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, Ip6Address::FromString("fd00:db8:2::1", address));
+    CHECK_EQUAL(46, Ip6Prefix::PrefixMatch(prefix.mPrefix, address));
+    CHECK_EQUAL(128, Ip6Prefix::PrefixMatch(address, address));
+    CHECK(prefix.ContainsAddress(address));
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, Ip6Address::FromString("fd00:db9::1", address));
+    CHECK(!prefix.ContainsAddress(address));
+
+    subnet.mPrefix = prefix.mPrefix;
+    subnet.mLength = 64;
+    CHECK(prefix.ContainsPrefix(subnet));
+    CHECK(!subnet.ContainsPrefix(prefix));
+    CHECK(!(prefix == subnet));
+
+    // Bits beyond the prefix length don't matter.
+    subnet.mLength = 32;
+    CHECK(prefix == subnet);
+}
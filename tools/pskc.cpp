@@ -32,8 +32,12 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 #include <sysexits.h>
 
+#include <string>
+#include <vector>
+
 #include "common/code_utils.hpp"
 #include "utils/hex.hpp"
 #include "utils/pskc.hpp"
@@ -46,6 +50,7 @@ enum
     kMaxNetworkName = 16,
     kMaxPassphrase  = 255,
     kSizeExtPanId   = 8,
+    kMaxLineLength  = 512,
 };
 
 void help(void)
@@ -53,18 +58,20 @@ void help(void)
     printf("pskc - compute PSKc\n"
            "SYNTAX:\n"
            "    pskc <PASSPHRASE> <EXTPANID> <NETWORK_NAME>\n"
+           "    pskc --batch\n"
+           "        Reads one '<PASSPHRASE> <EXTPANID> <NETWORK_NAME>' per line from stdin and computes\n"
+           "        the PSKc values on all CPU cores, printing them in input order.\n"
            "EXAMPLE:\n"
            "    pskc 654321 1122334455667788 OpenThread\n");
 }
 
-int printPSKc(const char *aPassphrase, const char *aExtPanId, const char *aNetworkName)
+int parseRequest(const char *                     aPassphrase,
+                 const char *                     aExtPanId,
+                 const char *                     aNetworkName,
+                 otbr::Psk::PskcService::Request &aRequest)
 {
-    uint8_t extpanid[kSizeExtPanId];
-    size_t  length;
-    int     ret = -1;
-
-    otbr::Psk::Pskc pskcComputer;
-    const uint8_t * pskc;
+    size_t length;
+    int    ret = -1;
 
     length = strlen(aPassphrase);
     VerifyOrExit(length > 0, printf("PASSPHRASE must not be empty.\n"));
@@ -79,20 +86,82 @@ int printPSKc(const char *aPassphrase, const char *aExtPanId, const char *aNetwo
                          (aExtPanId[i] <= 'F' && aExtPanId[i] >= 'A'),
                      printf("EXTPANID must be encoded in hex.\n"));
     }
-    otbr::Utils::Hex2Bytes(aExtPanId, extpanid, sizeof(extpanid));
+    otbr::Utils::Hex2Bytes(aExtPanId, aRequest.mExtPanId, sizeof(aRequest.mExtPanId));
 
     length = strlen(aNetworkName);
     VerifyOrExit(length > 0, printf("NETWORK_NAME must not be empty.\n"));
     VerifyOrExit(length <= kMaxNetworkName,
                  printf("NETWOR_KNAME length must be no more than %d bytes.\n", kMaxNetworkName));
 
-    pskc = pskcComputer.ComputePskc(extpanid, aNetworkName, aPassphrase);
-    for (int i = 0; i < 16; i++)
+    aRequest.mPassphrase  = aPassphrase;
+    aRequest.mNetworkName = aNetworkName;
+    ret                   = 0;
+
+exit:
+    return ret;
+}
+
+void printPSKc(const otbr::Psk::PskcValue &aPskc)
+{
+    for (uint8_t byte : aPskc)
     {
-        printf("%02x", pskc[i]);
+        printf("%02x", byte);
     }
     printf("\n");
-    ret = 0;
+}
+
+int printPSKc(const char *aPassphrase, const char *aExtPanId, const char *aNetworkName)
+{
+    otbr::Psk::PskcService::Request request;
+    otbr::Psk::Pskc                 pskcComputer;
+    otbr::Psk::PskcValue            pskc;
+    int                             ret;
+
+    SuccessOrExit(ret = parseRequest(aPassphrase, aExtPanId, aNetworkName, request));
+    memcpy(pskc.data(), pskcComputer.ComputePskc(request.mExtPanId, aNetworkName, aPassphrase), pskc.size());
+    printPSKc(pskc);
+
+exit:
+    return ret;
+}
+
+int printPSKcBatch(void)
+{
+    std::vector<otbr::Psk::PskcService::Request> requests;
+    char                                         line[kMaxLineLength];
+    int                                          lineNumber = 0;
+    int                                          ret        = 0;
+
+    while (fgets(line, sizeof(line), stdin) != nullptr)
+    {
+        char *passphrase;
+        char *extPanId;
+        char *networkName;
+
+        lineNumber++;
+        passphrase  = strtok(line, " \t\r\n");
+        extPanId    = strtok(nullptr, " \t\r\n");
+        networkName = strtok(nullptr, "\r\n");
+
+        if (passphrase == nullptr)
+        {
+            // Skip empty lines.
+            continue;
+        }
+
+        VerifyOrExit(extPanId != nullptr && networkName != nullptr,
+                     printf("Line %d: expected <PASSPHRASE> <EXTPANID> <NETWORK_NAME>.\n", lineNumber),
+                     ret = EX_DATAERR);
+
+        requests.emplace_back();
+        VerifyOrExit(parseRequest(passphrase, extPanId, networkName, requests.back()) == 0,
+                     printf("Line %d: invalid request.\n", lineNumber), ret = EX_DATAERR);
+    }
+
+    for (const otbr::Psk::PskcValue &pskc : otbr::Psk::PskcService().ComputeBatch(requests))
+    {
+        printPSKc(pskc);
+    }
 
 exit:
     return ret;
@@ -102,6 +171,11 @@ int main(int argc, char *argv[])
 {
     int ret = 0;
 
+    if (argc == 2 && strcmp(argv[1], "--batch") == 0)
+    {
+        ExitNow(ret = printPSKcBatch());
+    }
+
     VerifyOrExit(argc == 4, help(), ret = EX_USAGE);
     ret = printPSKc(argv[1], argv[2], argv[3]);
 
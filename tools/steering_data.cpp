@@ -35,36 +35,81 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <sysexits.h>
+#include <unistd.h>
+
+#include <vector>
 
 #include "common/code_utils.hpp"
 #include "utils/hex.hpp"
 #include "utils/steering_data.hpp"
 
+/**
+ * Constants.
+ */
+enum
+{
+    kMaxLineLength = 64,
+};
+
 void help(void)
 {
     printf("steering-data - compute steering data\n"
            "SYNTAX:\n"
            "    steering-data [LENGTH] <JOINER_ID> ...\n"
+           "    steering-data [-l LENGTH | -p FP_RATE] -f <FILE>\n"
+           "        Reads one EUI64 per line from FILE, or stdin if FILE is '-', and prints the steering data.\n"
+           "        The fill ratio and false positive rate are printed to stderr. With -p, the shortest length\n"
+           "        whose false positive rate is within FP_RATE is used.\n"
            "EXAMPLE:\n"
            "    steering-data 18b4300000000001\n"
            "    steering-data 15 18b4300000000001\n"
-           "    steering-data 18b4300000000001 18b4300000000002\n");
+           "    steering-data 18b4300000000001 18b4300000000002\n"
+           "    steering-data -p 0.01 -f eui64s.txt\n");
 }
 
-int ComputeJoinerId(const char *aEui64, uint8_t *aJoinerId)
+int ParseEui64(const char *aEui64, uint8_t *aEui64Bytes)
 {
     int ret = -1;
 
     VerifyOrExit(strlen(aEui64) == otbr::SteeringData::kSizeJoinerId * 2);
-    VerifyOrExit(otbr::Utils::Hex2Bytes(aEui64, aJoinerId, otbr::SteeringData::kSizeJoinerId) ==
+    VerifyOrExit(otbr::Utils::Hex2Bytes(aEui64, aEui64Bytes, otbr::SteeringData::kSizeJoinerId) ==
                  otbr::SteeringData::kSizeJoinerId);
-    otbr::SteeringData::ComputeJoinerId(aJoinerId, aJoinerId);
     ret = 0;
 
 exit:
-    if (ret != 0)
+    return ret;
+}
+
+int ReadEui64s(const char *aFileName, std::vector<uint8_t> &aEui64s)
+{
+    FILE *file = (strcmp(aFileName, "-") == 0) ? stdin : fopen(aFileName, "r");
+    char  line[kMaxLineLength];
+    int   lineNumber = 0;
+    int   ret        = EX_OK;
+
+    VerifyOrExit(file != nullptr, fprintf(stderr, "Failed to open %s\n", aFileName), ret = EX_NOINPUT);
+
+    while (fgets(line, sizeof(line), file) != nullptr)
+    {
+        char *eui64 = strtok(line, " \t\r\n");
+
+        lineNumber++;
+
+        if (eui64 == nullptr)
+        {
+            // Skip empty lines.
+            continue;
+        }
+
+        aEui64s.resize(aEui64s.size() + otbr::SteeringData::kSizeJoinerId);
+        VerifyOrExit(ParseEui64(eui64, &aEui64s[aEui64s.size() - otbr::SteeringData::kSizeJoinerId]) == 0,
+                     fprintf(stderr, "Line %d: invalid EUI64: %s\n", lineNumber, eui64), ret = EX_DATAERR);
+    }
+
+exit:
+    if (file != nullptr && file != stdin)
     {
-        fprintf(stderr, "Invalid EUI64: %s", aEui64);
+        fclose(file);
     }
 
     return ret;
@@ -72,41 +117,92 @@ exit:
 
 int main(int argc, char *argv[])
 {
-    otbr::SteeringData computer;
-    int                ret    = EX_USAGE;
-    int                length = 16;
-    int                i      = 1;
+    otbr::SteeringData   computer;
+    std::vector<uint8_t> joinerIds;
+    const char *         fileName = nullptr;
+    double               fpRate   = 0;
+    int                  ret      = EX_USAGE;
+    int                  length   = 16;
+    int                  opt;
+    int                  i;
 
     if (argc < 2)
     {
         ExitNow(help());
     }
 
-    if (strlen(argv[i]) != otbr::SteeringData::kSizeJoinerId * 2)
+    while ((opt = getopt(argc, argv, "f:l:p:")) != -1)
     {
-        length = atoi(argv[i]);
-        VerifyOrExit(length > 0 && length <= otbr::SteeringData::kMaxSizeOfBloomFilter,
-                     fprintf(stderr, "Invalid bloom filter length: %d\n", length));
+        switch (opt)
+        {
+        case 'f':
+            fileName = optarg;
+            break;
+
+        case 'l':
+            length = atoi(optarg);
+            break;
+
+        case 'p':
+            fpRate = atof(optarg);
+            VerifyOrExit(fpRate > 0 && fpRate < 1, fprintf(stderr, "Invalid false positive rate: %s\n", optarg));
+            break;
+
+        default:
+            ExitNow(help());
+        }
+    }
+
+    i = optind;
 
+    if (fileName == nullptr && i < argc && strlen(argv[i]) != otbr::SteeringData::kSizeJoinerId * 2)
+    {
+        length = atoi(argv[i]);
         ++i;
     }
 
-    computer.Init(static_cast<uint8_t>(length));
+    VerifyOrExit(length > 0 && length <= otbr::SteeringData::kMaxSizeOfBloomFilter,
+                 fprintf(stderr, "Invalid bloom filter length: %d\n", length));
+
+    if (fileName != nullptr)
+    {
+        VerifyOrExit(i == argc, help());
+        SuccessOrExit(ret = ReadEui64s(fileName, joinerIds));
+        ret = EX_USAGE;
+    }
 
     for (; i < argc; ++i)
     {
-        uint8_t joinerId[otbr::SteeringData::kSizeJoinerId];
+        joinerIds.resize(joinerIds.size() + otbr::SteeringData::kSizeJoinerId);
+        VerifyOrExit(ParseEui64(argv[i], &joinerIds[joinerIds.size() - otbr::SteeringData::kSizeJoinerId]) == 0,
+                     fprintf(stderr, "Invalid EUI64 : %s\n", argv[i]));
+    }
+
+    otbr::SteeringData::ComputeJoinerIds(joinerIds.data(), joinerIds.data(),
+                                         joinerIds.size() / otbr::SteeringData::kSizeJoinerId);
 
-        VerifyOrExit(ComputeJoinerId(argv[i], joinerId) == 0, fprintf(stderr, "Invalid EUI64 : %s\n", argv[i]));
-        computer.ComputeBloomFilter(joinerId);
+    if (fpRate > 0)
+    {
+        length = otbr::SteeringData::FindOptimalLength(joinerIds.data(),
+                                                       joinerIds.size() / otbr::SteeringData::kSizeJoinerId, fpRate);
     }
 
+    computer.Init(static_cast<uint8_t>(length));
+    computer.ComputeBloomFilter(joinerIds.data(), joinerIds.size() / otbr::SteeringData::kSizeJoinerId);
+
     for (i = 0; i < length; i++)
     {
         printf("%02x", computer.GetBloomFilter()[i]);
     }
     printf("\n");
 
+    if (fileName != nullptr)
+    {
+        fprintf(stderr, "joiners: %zu, length: %d, fill ratio: %.4f, false positive rate: %.6f\n",
+                joinerIds.size() / otbr::SteeringData::kSizeJoinerId, length, computer.GetFillRatio(),
+                computer.GetFalsePositiveRate());
+    }
+
     ret = EX_OK;
 
 exit: